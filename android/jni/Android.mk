@@ -35,6 +35,7 @@ include $(CLEAR_VARS)
 LOCAL_MODULE := flatbuffers_extra
 LOCAL_SRC_FILES := src/idl_parser.cpp \
                    src/idl_gen_text.cpp \
+                   src/idl_json_ingest.cpp \
                    src/reflection.cpp \
                    src/util.cpp \
                    src/code_generators.cpp
@@ -0,0 +1,193 @@
+/*
+ * Copyright 2018 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_ARENA_H_
+#define FLATBUFFERS_ARENA_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Arena allocation for the object API. Code generated with --cpp-arena
+// allocates native tables, their vectors and strings with ArenaAllocator,
+// which takes memory from the Arena made current on this thread by an
+// ArenaScope (or from the heap, if there is none):
+//
+//   flatbuffers::Arena arena;
+//   auto monster = flatbuffers::UnPackInArena(GetMonster(buf), &arena);
+//   ...
+//   arena.Reset();  // Frees monster and everything in it.
+//
+// Objects in an arena don't need to be destroyed: Reset() (or destroying the
+// Arena) releases them all at once. They may still be destroyed or resized
+// before that, which never frees arena memory, and memory they allocate
+// while no arena is current comes from the heap and is freed normally.
+
+namespace flatbuffers {
+
+// A monotonic memory arena: allocations are carved out of large blocks, and
+// are only released together by Reset(), which keeps the blocks for reuse.
+// Not thread-safe, use one per thread.
+class Arena {
+ public:
+  // All allocations are aligned to this.
+  static const size_t kAlignment = 16;
+
+  explicit Arena(size_t block_size = 64 * 1024)
+      : block_size_(block_size), current_(0), used_(0), allocated_(0) {}
+
+  ~Arena() {
+    for (auto it = blocks_.begin(); it != blocks_.end(); ++it) {
+      ::operator delete(it->memory);
+    }
+  }
+
+  void *Allocate(size_t size) {
+    size = (size + kAlignment - 1) & ~(kAlignment - 1);
+    if (current_ == blocks_.size() || used_ + size > blocks_[current_].size) {
+      NextBlock(size);
+    }
+    auto p = blocks_[current_].data + used_;
+    used_ += size;
+    allocated_ += size;
+    return p;
+  }
+
+  // Release all allocations.
+  void Reset() {
+    current_ = 0;
+    used_ = 0;
+    allocated_ = 0;
+  }
+
+  // The number of bytes allocated since the last Reset().
+  size_t allocated() const { return allocated_; }
+
+ private:
+  struct Block {
+    void *memory;
+    uint8_t *data;  // memory, aligned to kAlignment.
+    size_t size;
+  };
+
+  // Move on to the next block (kept from before a Reset) with room for size
+  // bytes, or allocate a new one.
+  void NextBlock(size_t size) {
+    if (current_ < blocks_.size()) current_++;
+    while (current_ < blocks_.size() && blocks_[current_].size < size) {
+      current_++;
+    }
+    if (current_ == blocks_.size()) {
+      Block block;
+      block.size = std::max(block_size_, size);
+      block.memory = ::operator new(block.size + kAlignment);
+      auto address = reinterpret_cast<size_t>(block.memory);
+      block.data = static_cast<uint8_t *>(block.memory) +
+                   ((kAlignment - address % kAlignment) % kAlignment);
+      blocks_.push_back(block);
+    }
+    used_ = 0;
+  }
+
+  Arena(const Arena &);
+  Arena &operator=(const Arena &);
+
+  size_t block_size_;
+  std::vector<Block> blocks_;
+  size_t current_;  // Index into blocks_, or blocks_.size() if there's none.
+  size_t used_;     // Of the current block.
+  size_t allocated_;
+};
+
+// The arena ArenaAllocator allocates from on this thread, if any.
+inline Arena *&CurrentArena() {
+  static thread_local Arena *arena = nullptr;
+  return arena;
+}
+
+// Makes an arena current on this thread for as long as it exists.
+class ArenaScope {
+ public:
+  explicit ArenaScope(Arena *arena) : previous_(CurrentArena()) {
+    CurrentArena() = arena;
+  }
+  ~ArenaScope() { CurrentArena() = previous_; }
+
+ private:
+  ArenaScope(const ArenaScope &);
+  ArenaScope &operator=(const ArenaScope &);
+
+  Arena *previous_;
+};
+
+// Allocate from the current arena, or the heap. Each allocation starts with
+// a header recording which, so it can be freed correctly whichever arena is
+// current by then.
+inline void *ArenaAllocate(size_t size) {
+  auto arena = CurrentArena();
+  auto p = arena ? arena->Allocate(size + Arena::kAlignment)
+                 : ::operator new(size + Arena::kAlignment);
+  *static_cast<Arena **>(p) = arena;
+  return static_cast<uint8_t *>(p) + Arena::kAlignment;
+}
+
+inline void ArenaDeallocate(void *p) {
+  if (!p) return;
+  auto header = static_cast<uint8_t *>(p) - Arena::kAlignment;
+  if (!*reinterpret_cast<Arena **>(header)) ::operator delete(header);
+}
+
+// A standard allocator using ArenaAllocate. All instances are
+// interchangeable, so containers using it can be moved and swapped freely.
+template<typename T> class ArenaAllocator {
+ public:
+  typedef T value_type;
+
+  ArenaAllocator() {}
+  template<typename U> ArenaAllocator(const ArenaAllocator<U> &) {}
+
+  T *allocate(size_t n) {
+    return static_cast<T *>(ArenaAllocate(n * sizeof(T)));
+  }
+  void deallocate(T *p, size_t) { ArenaDeallocate(p); }
+
+  template<typename U> struct rebind { typedef ArenaAllocator<U> other; };
+};
+
+template<typename T, typename U>
+bool operator==(const ArenaAllocator<T> &, const ArenaAllocator<U> &) {
+  return true;
+}
+template<typename T, typename U>
+bool operator!=(const ArenaAllocator<T> &, const ArenaAllocator<U> &) {
+  return false;
+}
+
+// The string type of native tables generated with --cpp-arena.
+typedef std::basic_string<char, std::char_traits<char>, ArenaAllocator<char>>
+    ArenaString;
+
+// Unpack table (e.g. GetMonster(buf)) into a native table allocated, along
+// with everything in it, from arena.
+template<typename T>
+auto UnPackInArena(const T *table, Arena *arena,
+                   const resolver_function_t *resolver = nullptr)
+    -> decltype(table->UnPack(resolver)) {
+  ArenaScope scope(arena);
+  return table->UnPack(resolver);
+}
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_ARENA_H_
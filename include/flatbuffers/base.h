@@ -230,6 +230,13 @@ typedef uintmax_t largest_scalar_t;
 // We support aligning the contents of buffers up to this size.
 #define FLATBUFFERS_MAX_ALIGNMENT 16
 
+// Hint that the memory at address p is about to be read.
+#if defined(__GNUC__) || defined(__clang__)
+  #define FLATBUFFERS_PREFETCH(p) __builtin_prefetch(p)
+#else
+  #define FLATBUFFERS_PREFETCH(p) ((void)(p))
+#endif
+
 #if defined(_MSC_VER)
   #pragma warning(push)
   #pragma warning(disable: 4127) // C4127: conditional expression is constant
@@ -181,6 +181,47 @@ template<typename T, typename IT> struct VectorIterator {
 
 struct String;
 
+// The type of the key field of T: what its GetKey() returns, or void for code
+// generated by an older flatc, which has no GetKey(). Such keys are found by
+// plain binary search.
+template<typename T> struct KeyTypeOf {
+  template<typename U>
+  static auto Check(const U *u, int) -> decltype(u->GetKey());
+  template<typename U> static void Check(...);
+  typedef decltype(Check<T>(nullptr, 0)) type;
+};
+
+// The hash of a key in the index FlatBufferBuilder::CreateHashIndex writes:
+// FNV-1a over its little endian bytes, then mixed so the low bits, which pick
+// the slot, depend on all of them. As it's stored in buffers, it must never
+// change.
+inline uint32_t HashKey(const char *data, size_t size) {
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < size; i++) {
+    h ^= static_cast<uint8_t>(data[i]);
+    h *= 16777619u;
+  }
+  h ^= h >> 16;
+  h *= 0x85ebca6bu;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35u;
+  h ^= h >> 16;
+  return h;
+}
+
+inline uint32_t HashKey(const char *str) { return HashKey(str, strlen(str)); }
+
+inline uint32_t HashKey(const String *str);
+
+template<typename T> uint32_t HashKey(T key) {
+  static_assert(flatbuffers::is_arithmetic<T>::value ||
+                    flatbuffers::is_enum<T>::value,
+                "Keys are strings or scalars");
+  if (key == T(0)) key = T(0);  // -0.0 == 0.0.
+  key = EndianScalar(key);
+  return HashKey(reinterpret_cast<const char *>(&key), sizeof(T));
+}
+
 // This is used as a helper type for accessing vectors.
 // Vector::data() assumes the vector elements start after the length field.
 template<typename T> class Vector {
@@ -197,6 +238,8 @@ template<typename T> class Vector {
 
   typedef typename IndirectHelper<T>::return_type return_type;
   typedef typename IndirectHelper<T>::mutable_return_type mutable_return_type;
+  // The table or struct type of elements, for vectors of those.
+  typedef typename flatbuffers::remove_pointer<return_type>::type element_type;
 
   return_type Get(uoffset_t i) const {
     FLATBUFFERS_ASSERT(i < size());
@@ -268,17 +311,63 @@ template<typename T> class Vector {
   const T *data() const { return reinterpret_cast<const T *>(Data()); }
   T *data() { return reinterpret_cast<T *>(Data()); }
 
+  // The element with the given key in a vector of tables or structs sorted
+  // by their key field, or nullptr. Integer keys are found by interpolation
+  // first, which takes far fewer steps when they're evenly spread.
   template<typename K> return_type LookupByKey(K key) const {
-    void *search_result = std::bsearch(
-        &key, Data(), size(), IndirectHelper<T>::element_stride, KeyCompare<K>);
-
-    if (!search_result) {
-      return nullptr;  // Key not found.
+    typedef typename KeyTypeOf<element_type>::type key_type;
+    auto i = KeyLowerBound(key, flatbuffers::is_integral<key_type>());
+    return i < size() && KeyCompare(i, key) == 0 ? Get(i) : nullptr;
+  }
+
+  // Look up count keys, which must be sorted too, storing the element with
+  // each (or nullptr) in results. Like a merge join, each search starts where
+  // the last one ended, so this is much faster than calling LookupByKey for
+  // each key when there are many.
+  template<typename K>
+  void LookupByKeys(const K *keys, size_t count, return_type *results) const {
+    uoffset_t first = 0;
+    for (size_t k = 0; k < count; k++) {
+      // Gallop ahead to a range that must hold the key, then search it.
+      size_t last = first;
+      for (size_t step = 1; last < size() && KeyCompare(
+                                static_cast<uoffset_t>(last), keys[k]) < 0;
+           step *= 2) {
+        first = static_cast<uoffset_t>(last + 1);
+        last += step;
+      }
+      first = KeyLowerBound(
+          first, static_cast<uoffset_t>(std::min<size_t>(last, size())),
+          keys[k]);
+      results[k] = first < size() && KeyCompare(first, keys[k]) == 0
+                       ? Get(first)
+                       : nullptr;
     }
+  }
 
-    const uint8_t *element = reinterpret_cast<const uint8_t *>(search_result);
-
-    return IndirectHelper<T>::Read(element, 0);
+  // Like LookupByKey, but in O(1) through a hash index for this vector,
+  // written by FlatBufferBuilder::CreateHashIndex. Without one, this is
+  // LookupByKey.
+  template<typename K>
+  return_type LookupByKeyHashed(K key, const Vector<uint32_t> *index) const {
+    if (!index || !index->size()) return LookupByKey(key);
+    typedef typename KeyTypeOf<element_type>::type key_type;
+    // Hashed as the key field is, so a key of another integer type finds it.
+    typedef typename flatbuffers::conditional<
+        flatbuffers::is_arithmetic<key_type>::value ||
+            flatbuffers::is_enum<key_type>::value,
+        key_type, K>::type hash_type;
+    auto mask = index->size() - 1;
+    auto slot = HashKey(static_cast<hash_type>(key));
+    // Linear probing, up to an empty slot (of which the verifier ensures
+    // there's at least one). Bounding the probes to the number of slots
+    // still ends the loop for an index that wasn't verified.
+    for (uoffset_t probes = 0; probes <= mask; probes++, slot++) {
+      auto i = index->Get(slot & mask);
+      if (!i || i > size()) break;
+      if (KeyCompare(i - 1, key) == 0) return Get(i - 1);
+    }
+    return nullptr;
   }
 
  protected:
@@ -293,14 +382,68 @@ template<typename T> class Vector {
   // Private and unimplemented copy constructor.
   Vector(const Vector &);
 
-  template<typename K> static int KeyCompare(const void *ap, const void *bp) {
-    const K *key = reinterpret_cast<const K *>(ap);
-    const uint8_t *data = reinterpret_cast<const uint8_t *>(bp);
-    auto table = IndirectHelper<T>::Read(data, 0);
-
-    // std::bsearch compares with the operands transposed, so we negate the
-    // result here.
-    return -table->KeyCompareWithValue(*key);
+  // The sign of the key of element i minus key.
+  template<typename K> int KeyCompare(uoffset_t i, const K &key) const {
+    return IndirectHelper<T>::Read(Data(), i)->KeyCompareWithValue(key);
+  }
+
+  // The index of the first element in [first, last) whose key isn't less
+  // than key, or last. This binary search is branchless: it always takes
+  // log2(last - first) steps, each choosing a half with a conditional move
+  // rather than a hard to predict branch, and prefetching the elements the
+  // next step may compare with.
+  template<typename K>
+  uoffset_t KeyLowerBound(uoffset_t first, uoffset_t last, const K &key) const {
+    if (first == last) return first;
+    auto n = last - first;
+    while (n > 1) {
+      auto half = n / 2;
+      auto next_half = (n - half) / 2;
+      FLATBUFFERS_PREFETCH(
+          Data() + (first + next_half) * IndirectHelper<T>::element_stride);
+      FLATBUFFERS_PREFETCH(Data() + (first + half + next_half) *
+                                        IndirectHelper<T>::element_stride);
+      first = KeyCompare(first + half, key) < 0 ? first + half : first;
+      n -= half;
+    }
+    return first + (KeyCompare(first, key) < 0 ? 1 : 0);
+  }
+
+  template<typename K>
+  uoffset_t KeyLowerBound(const K &key, flatbuffers::false_type) const {
+    return KeyLowerBound(0, size(), key);
+  }
+
+  // Integer keys narrow the range by interpolating between the keys at its
+  // ends first. That's only done a few times, after which the binary search
+  // bounds the cost when keys are unevenly spread.
+  template<typename K>
+  uoffset_t KeyLowerBound(const K &key, flatbuffers::true_type) const {
+    typedef typename KeyTypeOf<element_type>::type key_type;
+    // Converted like KeyCompareWithValue converts it.
+    auto value = static_cast<key_type>(key);
+    uoffset_t first = 0;
+    uoffset_t last = size();
+    for (int i = 0; i < 8 && last - first > 32; i++) {
+      auto low = IndirectHelper<T>::Read(Data(), first)->GetKey();
+      auto high = IndirectHelper<T>::Read(Data(), last - 1)->GetKey();
+      if (!(low < value)) return first;
+      if (high < value) return last;
+      // The differences are taken as integers, since as doubles they may
+      // round to 0 for 64 bit keys. low < value <= high, so 0 < span and
+      // offset <= span.
+      auto offset = static_cast<uint64_t>(value) - static_cast<uint64_t>(low);
+      auto span = static_cast<uint64_t>(high) - static_cast<uint64_t>(low);
+      auto guess = first + static_cast<uoffset_t>(
+                               static_cast<double>(offset) /
+                               static_cast<double>(span) * (last - 1 - first));
+      if (IndirectHelper<T>::Read(Data(), guess)->GetKey() < value) {
+        first = guess + 1;
+      } else {
+        last = guess;
+      }
+    }
+    return KeyLowerBound(first, last, key);
   }
 };
 
@@ -344,6 +487,29 @@ template<typename T> static inline size_t VectorLength(const Vector<T> *v) {
   return v ? v->Length() : 0;
 }
 
+// Unpack a vector of scalars into a std::vector of the object API. This
+// is a single memcpy where the buffer has the same layout as native memory,
+// i.e. on little-endian machines.
+template<typename T, typename Alloc>
+void UnPackVector(const Vector<T> &v, std::vector<T, Alloc> *dest) {
+  // clang-format off
+  #if FLATBUFFERS_LITTLEENDIAN
+    dest->assign(v.data(), v.data() + v.size());
+  #else
+    dest->resize(v.size());
+    for (uoffset_t i = 0; i < v.size(); i++) (*dest)[i] = v.Get(i);
+  #endif
+  // clang-format on
+}
+
+// Same for a vector of structs, which are laid out in the buffer as they are
+// in memory on any machine.
+template<typename T, typename Alloc>
+void UnPackVector(const Vector<const T *> &v, std::vector<T, Alloc> *dest) {
+  auto structs = reinterpret_cast<const T *>(v.Data());
+  dest->assign(structs, structs + v.size());
+}
+
 struct String : public Vector<char> {
   const char *c_str() const { return reinterpret_cast<const char *>(Data()); }
   std::string str() const { return std::string(c_str(), Length()); }
@@ -361,6 +527,10 @@ struct String : public Vector<char> {
   }
 };
 
+inline uint32_t HashKey(const String *str) {
+  return HashKey(str->c_str(), str->size());
+}
+
 // Convenience function to get std::string from a String returning an empty
 // string on null pointer.
 static inline std::string GetString(const String * str) {
@@ -373,6 +543,68 @@ static inline const char * GetCstring(const String * str) {
   return str ? str->c_str() : "";
 }
 
+// Non-owning views of a string and of a vector of scalars, which object API
+// types generated with --cpp-views use to refer to the buffer they were
+// unpacked from instead of copying it. That buffer must outlive them.
+
+// Like a String, the viewed characters must be followed by a 0.
+class StringView {
+ public:
+  StringView() : data_(""), size_(0) {}
+  StringView(const char *data, size_t size) : data_(data), size_(size) {}
+  explicit StringView(const char *str) : data_(str), size_(strlen(str)) {}
+  explicit StringView(const std::string &str)
+      : data_(str.c_str()), size_(str.size()) {}
+
+  const char *c_str() const { return data_; }
+  const char *data() const { return data_; }
+  size_t length() const { return size_; }
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  std::string str() const { return std::string(data_, size_); }
+  void clear() { *this = StringView(); }
+
+  bool operator==(const StringView &o) const {
+    return size_ == o.size_ && memcmp(data_, o.data_, size_) == 0;
+  }
+  bool operator!=(const StringView &o) const { return !(*this == o); }
+
+ private:
+  const char *data_;
+  size_t size_;
+};
+
+// Like a Vector, the viewed scalars are little endian.
+template<typename T> class VectorView {
+ public:
+  typedef T value_type;
+
+  VectorView() : data_(nullptr), size_(0) {}
+  VectorView(const T *data, size_t size) : data_(data), size_(size) {}
+  explicit VectorView(const Vector<T> &v) : data_(v.data()), size_(v.size()) {}
+
+  T Get(size_t i) const {
+    FLATBUFFERS_ASSERT(i < size_);
+    return EndianScalar(data_[i]);
+  }
+  T operator[](size_t i) const { return Get(i); }
+
+  const T *data() const { return data_; }
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  void clear() { *this = VectorView(); }
+
+  bool operator==(const VectorView &o) const {
+    return size_ == o.size_ &&
+           (!size_ || memcmp(data_, o.data_, size_ * sizeof(T)) == 0);
+  }
+  bool operator!=(const VectorView &o) const { return !(*this == o); }
+
+ private:
+  const T *data_;
+  size_t size_;
+};
+
 // Allocator interface. This is flatbuffers-specific and meant only for
 // `vector_downward` usage.
 class Allocator {
@@ -928,6 +1160,7 @@ class FlatBufferBuilder {
     swap(force_defaults_, other.force_defaults_);
     swap(dedup_vtables_, other.dedup_vtables_);
     swap(string_pool, other.string_pool);
+    offset_stack_.swap(other.offset_stack_);
   }
 
   ~FlatBufferBuilder() {
@@ -954,6 +1187,16 @@ class FlatBufferBuilder {
   /// @return Returns an `uoffset_t` with the current size of the buffer.
   uoffset_t GetSize() const { return buf_.size(); }
 
+  /// @brief Make room for `size` more bytes of data (and scratch space), plus
+  /// what `Finish()` adds, so building that much won't need to grow the buffer.
+  /// Generated `Pack` functions taking a reference to an object do this with
+  /// `GetPackedSizeUpperBound()` of that object.
+  /// @param[in] size The number of bytes to make room for.
+  void Reserve(size_t size) {
+    buf_.ensure_space(size + 3 * sizeof(uoffset_t) +
+                      2 * FLATBUFFERS_MAX_ALIGNMENT);
+  }
+
   /// @brief Get the serialized buffer (after you call `Finish()`).
   /// @return Returns an `uint8_t` pointer to the FlatBuffer data inside the
   /// buffer.
@@ -1417,10 +1660,24 @@ class FlatBufferBuilder {
   /// buffer as a `vector`.
   /// @return Returns a typed `Offset` into the serialized data indicating
   /// where the vector is stored.
-  template<typename T> Offset<Vector<T>> CreateVector(const std::vector<T> &v) {
+  template<typename T, typename Alloc>
+  Offset<Vector<T>> CreateVector(const std::vector<T, Alloc> &v) {
     return CreateVector(data(v), v.size());
   }
 
+  /// @brief Serialize a `VectorView` into a FlatBuffer `vector`.
+  /// @tparam T The data type of the elements, which are already stored in
+  /// buffer (little endian) order and so are copied as-is.
+  /// @param v A const reference to the `VectorView` to serialize.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename T> Offset<Vector<T>> CreateVector(const VectorView<T> &v) {
+    uint8_t *buf = nullptr;
+    auto offset = CreateUninitializedVector(v.size(), sizeof(T), &buf);
+    if (v.size()) memcpy(buf, v.data(), v.size() * sizeof(T));
+    return Offset<Vector<T>>(offset);
+  }
+
   // vector<bool> may be implemented using a bit-set, so we can't access it as
   // an array. Instead, read elements manually.
   // Background: https://isocpp.org/blog/2012/11/on-vectorbool
@@ -1461,9 +1718,7 @@ class FlatBufferBuilder {
   /// where the vector is stored.
   template<typename T, typename F, typename S>
   Offset<Vector<T>> CreateVector(size_t vector_size, F f, S *state) {
-    std::vector<T> elems(vector_size);
-    for (size_t i = 0; i < vector_size; i++) elems[i] = f(i, state);
-    return CreateVector(elems);
+    return CreateVectorFrom(vector_size, f, state, static_cast<T *>(nullptr));
   }
 
   /// @brief Serialize a `std::vector<std::string>` into a FlatBuffer `vector`.
@@ -1474,9 +1729,23 @@ class FlatBufferBuilder {
   /// where the vector is stored.
   Offset<Vector<Offset<String>>> CreateVectorOfStrings(
       const std::vector<std::string> &v) {
-    std::vector<Offset<String>> offsets(v.size());
-    for (size_t i = 0; i < v.size(); i++) offsets[i] = CreateString(v[i]);
-    return CreateVector(offsets);
+    auto base = offset_stack_.size();
+    for (size_t i = 0; i < v.size(); i++) {
+      offset_stack_.push_back(CreateString(v[i]).o);
+    }
+    return PopOffsetVector<String>(base);
+  }
+
+  /// @brief Same as above, for a `std::vector` of any string type supported
+  /// by CreateString, with any allocator.
+  template<typename S, typename Alloc>
+  Offset<Vector<Offset<String>>> CreateVectorOfStrings(
+      const std::vector<S, Alloc> &v) {
+    auto base = offset_stack_.size();
+    for (size_t i = 0; i < v.size(); i++) {
+      offset_stack_.push_back(CreateString(v[i]).o);
+    }
+    return PopOffsetVector<String>(base);
   }
 
   /// @brief Serialize an array of structs into a FlatBuffer `vector`.
@@ -1692,6 +1961,32 @@ class FlatBufferBuilder {
     return CreateVectorOfSortedTables(data(*v), v->size());
   }
 
+  /// @brief Serialize a hash index for a `vector` of `table`s with a key
+  /// field, for `Vector::LookupByKeyHashed` to find them by key in O(1).
+  /// @tparam T The data type that the offsets in the vector refer to.
+  /// @param[in] tables The `vector`, typically created with
+  /// `CreateVectorOfSortedTables`.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the index is stored, or a null one if the `vector` is empty.
+  template<typename T>
+  Offset<Vector<uint32_t>> CreateHashIndex(Offset<Vector<Offset<T>>> tables) {
+    if (tables.IsNull()) return 0;
+    auto vec = reinterpret_cast<const Vector<Offset<T>> *>(
+        buf_.data_at(tables.o));
+    if (!vec->size()) return 0;
+    // Open addressing with linear probing, at a load factor of at most 2/3.
+    // Each slot holds an element index + 1, or 0 if empty.
+    uoffset_t slots = 1;
+    while (slots < vec->size() + vec->size() / 2 + 1) slots *= 2;
+    std::vector<uint32_t> index(slots, 0);
+    for (uoffset_t i = 0; i < vec->size(); i++) {
+      auto slot = HashKey(vec->Get(i)->GetKey()) & (slots - 1);
+      while (index[slot]) slot = (slot + 1) & (slots - 1);
+      index[slot] = i + 1;
+    }
+    return CreateVector(index);
+  }
+
   /// @brief Specialized version of `CreateVector` for non-copying use cases.
   /// Write the data any time later to the returned buffer pointer `buf`.
   /// @param[in] len The number of elements to store in the `vector`.
@@ -1844,7 +2139,44 @@ protected:
   typedef std::set<Offset<String>, StringOffsetCompare> StringOffsetMap;
   StringOffsetMap *string_pool;
 
+  // Offsets of the elements of vectors of tables and strings under
+  // construction, kept until all of them exist. Elements may make vectors of
+  // their own, which push theirs on top. Its capacity is kept from one
+  // buffer to the next, so this doesn't allocate once it has grown.
+  std::vector<uoffset_t> offset_stack_;
+
  private:
+  template<typename T, typename F, typename S>
+  Offset<Vector<T>> CreateVectorFrom(size_t vector_size, F f, S *state, T *) {
+    std::vector<T> elems(vector_size);
+    for (size_t i = 0; i < vector_size; i++) elems[i] = f(i, state);
+    return CreateVector(elems);
+  }
+
+  template<typename T, typename F, typename S>
+  Offset<Vector<Offset<T>>> CreateVectorFrom(size_t vector_size, F f,
+                                             S *state, Offset<T> *) {
+    auto base = offset_stack_.size();
+    for (size_t i = 0; i < vector_size; i++) {
+      // f may push to offset_stack_ itself.
+      auto element = f(i, state);
+      offset_stack_.push_back(element.o);
+    }
+    return PopOffsetVector<T>(base);
+  }
+
+  // Create a vector of the offsets pushed on offset_stack_ since it had base
+  // elements, and pop them.
+  template<typename T> Offset<Vector<Offset<T>>> PopOffsetVector(size_t base) {
+    auto len = offset_stack_.size() - base;
+    StartVector(len, sizeof(Offset<T>));
+    for (auto i = len; i > 0;) {
+      PushElement(Offset<T>(offset_stack_[base + --i]));
+    }
+    offset_stack_.resize(base);
+    return Offset<Vector<Offset<T>>>(EndVector(len));
+  }
+
   // Allocates space for a vector of structures.
   // Must be completed with EndVectorOfStructs().
   template<typename T> T *StartVectorOfStructs(size_t vector_size) {
@@ -2039,6 +2371,25 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
     return true;
   }
 
+  // Verify a hash index (may be NULL) for a vector (may be NULL), both
+  // verified already: it must have a power of two slots, at least one of
+  // them empty, and each referring to an element of the vector or empty.
+  template<typename T>
+  bool VerifyHashIndex(const Vector<T> *vec,
+                       const Vector<uint32_t> *index) const {
+    if (!index || !index->size()) return true;
+    auto slots = index->size();
+    auto size = vec ? vec->size() : 0;
+    if (!Check(!(slots & (slots - 1)) && slots > size)) return false;
+    auto has_empty = false;
+    for (uoffset_t i = 0; i < slots; i++) {
+      auto slot = index->Get(i);
+      if (!Check(slot <= size)) return false;
+      if (!slot) has_empty = true;
+    }
+    return Check(has_empty);
+  }
+
   bool VerifyTableStart(const uint8_t *table) {
     // Check the vtable offset.
     auto tableo = static_cast<size_t>(table - buf_);
@@ -2303,6 +2654,229 @@ class Table {
   uint8_t data_[1];
 };
 
+// Caches the decoded vtable of the table it was last bound to, for fast
+// access to many tables that share the same vtable, e.g. when scanning a
+// vector of tables (since by default FlatBufferBuilder deduplicates vtables,
+// most such vectors only use a handful of different ones).
+// As long as consecutive tables share their vtable, accessing their fields
+// through this cache does not read the vtable at all, avoiding the dependent
+// loads that Table::GetOptionalFieldOffset does for every field.
+// Use the field offsets from the generated code, for example:
+//   flatbuffers::VTableCache cache;
+//   for (auto it = monsters->begin(); it != monsters->end(); ++it) {
+//     cache.Bind(*it);
+//     auto hp = cache.GetField<int16_t>(Monster::VT_HP, 100);
+//   }
+// Vtables are recognized by their address only, so call Reset() before
+// binding tables of another buffer: it may have a different vtable at the
+// same address (e.g. when a receive buffer is reused).
+class VTableCache {
+ public:
+  VTableCache() : table_(nullptr), vtable_(nullptr) {}
+
+  // Forget the decoded vtable, so the next Bind decodes it again.
+  void Reset() {
+    table_ = nullptr;
+    vtable_ = nullptr;
+    offsets_.clear();
+  }
+
+  // Points the cache at "table", decoding its vtable only if it is different
+  // from that of the previous table.
+  template<typename T> void Bind(const T *table) {
+    // Cast, since Table is a private baseclass of any table types.
+    auto t = reinterpret_cast<const Table *>(table);
+    table_ = reinterpret_cast<const uint8_t *>(t);
+    auto vtable = t->GetVTable();
+    if (vtable != vtable_) Decode(vtable);
+  }
+
+  // Same as Table::GetOptionalFieldOffset for the currently bound table.
+  voffset_t GetOptionalFieldOffset(voffset_t field) const {
+    auto idx = static_cast<size_t>(field / sizeof(voffset_t));
+    return idx < offsets_.size() ? offsets_[idx] : 0;
+  }
+
+  template<typename T> T GetField(voffset_t field, T defaultval) const {
+    auto field_offset = GetOptionalFieldOffset(field);
+    return field_offset ? ReadScalar<T>(table_ + field_offset) : defaultval;
+  }
+
+  template<typename P> P GetPointer(voffset_t field) const {
+    auto field_offset = GetOptionalFieldOffset(field);
+    auto p = table_ + field_offset;
+    return field_offset ? reinterpret_cast<P>(p + ReadScalar<uoffset_t>(p))
+                        : nullptr;
+  }
+
+  template<typename P> P GetStruct(voffset_t field) const {
+    auto field_offset = GetOptionalFieldOffset(field);
+    return field_offset ? reinterpret_cast<P>(table_ + field_offset) : nullptr;
+  }
+
+  bool CheckField(voffset_t field) const {
+    return GetOptionalFieldOffset(field) != 0;
+  }
+
+  const uint8_t *GetVTable() const { return vtable_; }
+
+ private:
+  void Decode(const uint8_t *vtable) {
+    vtable_ = vtable;
+    // Store the vtable in native endianness, including its size fields, so
+    // that field offsets can be used as index directly.
+    auto vtsize = ReadScalar<voffset_t>(vtable);
+    offsets_.resize(vtsize / sizeof(voffset_t));
+    for (size_t i = 0; i < offsets_.size(); i++) {
+      offsets_[i] = ReadScalar<voffset_t>(vtable + i * sizeof(voffset_t));
+    }
+  }
+
+  const uint8_t *table_;
+  const uint8_t *vtable_;
+  std::vector<voffset_t> offsets_;
+};
+
+// Which fields of a table are present, decoded from its vtable in one pass,
+// for checking many fields, or iterating only over the ones that are set,
+// without reading the vtable again for each field. N is the number of fields
+// of the table, as the generated PresenceMask() passes it: fields added by
+// newer schemas are left out. For example:
+//   auto mask = monster->PresenceMask();
+//   if (mask.CheckField(Monster::VT_HP)) { ... }
+//   for (auto id = mask.Next(0); id < mask.size(); id = mask.Next(id + 1)) {
+//     ...  // Field id is present.
+//   }
+template<size_t N> class FieldPresence {
+ public:
+  template<typename T> explicit FieldPresence(const T *table) {
+    memset(words_, 0, sizeof(words_));
+    // Cast, since Table is a private baseclass of any table types.
+    auto vtable = reinterpret_cast<const Table *>(table)->GetVTable();
+    // Skip the sizes of the vtable and the table.
+    auto offsets = vtable + 2 * sizeof(voffset_t);
+    size_t count = ReadScalar<voffset_t>(vtable) / sizeof(voffset_t);
+    count = count > 2 ? (std::min)(count - 2, N) : 0;
+    size_t id = 0;
+    // clang-format off
+    #if FLATBUFFERS_LITTLEENDIAN
+      // Wide vtables are decoded four offsets at a time. The top bit of each
+      // 16 bit lane of present is set if that offset isn't 0, then the
+      // multiplication gathers those four bits (without carries).
+      for (; id + 4 <= count; id += 4) {
+        uint64_t lanes;
+        memcpy(&lanes, offsets + id * sizeof(voffset_t), sizeof(lanes));
+        auto present = ((((lanes & 0x7FFF7FFF7FFF7FFFULL) +
+                         0x7FFF7FFF7FFF7FFFULL) | lanes) >> 15) &
+                       0x0001000100010001ULL;
+        words_[id / 64] |= (((present * 0x0001000200040008ULL) >> 48) & 0xF)
+                           << (id % 64);
+      }
+    #endif
+    // clang-format on
+    for (; id < count; id++) {
+      if (ReadScalar<voffset_t>(offsets + id * sizeof(voffset_t))) {
+        words_[id / 64] |= uint64_t(1) << (id % 64);
+      }
+    }
+  }
+
+  // The number of fields, present or not.
+  static size_t size() { return N; }
+
+  // Whether the field with the given id is present.
+  bool Test(size_t id) const {
+    return id < N && ((words_[id / 64] >> (id % 64)) & 1);
+  }
+
+  // Same as Table::CheckField, given the generated field offset.
+  bool CheckField(voffset_t field) const {
+    return Test(field / sizeof(voffset_t) - 2);
+  }
+
+  // The id of the first present field with an id of at least id, or size().
+  size_t Next(size_t id) const {
+    while (id < N) {
+      auto word = words_[id / 64] >> (id % 64);
+      if (word) return id + CountTrailingZeros(word);
+      id = (id / 64 + 1) * 64;
+    }
+    return N;
+  }
+
+  // The number of present fields.
+  size_t count() const {
+    size_t n = 0;
+    for (size_t i = 0; i < kWords; i++) n += PopCount(words_[i]);
+    return n;
+  }
+
+ private:
+  static const size_t kWords = (N + 63) / 64 ? (N + 63) / 64 : 1;
+
+  static size_t CountTrailingZeros(uint64_t x) {
+    // clang-format off
+    #if defined(__GNUC__) || defined(__clang__)
+      return static_cast<size_t>(__builtin_ctzll(x));
+    #else
+      size_t n = 0;
+      while (!(x & 1)) { x >>= 1; n++; }
+      return n;
+    #endif
+    // clang-format on
+  }
+
+  static size_t PopCount(uint64_t x) {
+    // clang-format off
+    #if defined(__GNUC__) || defined(__clang__)
+      return static_cast<size_t>(__builtin_popcountll(x));
+    #else
+      size_t n = 0;
+      for (; x; x &= x - 1) n++;
+      return n;
+    #endif
+    // clang-format on
+  }
+
+  uint64_t words_[kWords];
+};
+
+// A copy of a finished buffer, used as a template for buffers of the same
+// shape, i.e. with the same fields present and only scalars varying. Rather
+// than building each of those with a FlatBufferBuilder, copy the template and
+// patch its scalars in place, either with the mutate_ accessors of the copy's
+// root, or faster, with those of the XBufferTemplate generated with
+// --gen-templates, which resolves the positions of the scalar fields of
+// the root table once. Only fields present in the template can be patched, so
+// build it with FlatBufferBuilder::ForceDefaults(true).
+class BufferTemplate {
+ public:
+  BufferTemplate(const uint8_t *buf, size_t size) : buf_(buf, buf + size) {}
+
+  const uint8_t *data() const { return vector_data(buf_); }
+  size_t size() const { return buf_.size(); }
+
+  // Copies the template to dest, which must have room for size() bytes and
+  // be aligned to FLATBUFFERS_MAX_ALIGNMENT, like builder buffers are.
+  void CopyTo(uint8_t *dest) const { memcpy(dest, data(), size()); }
+
+  // The position in the buffer of a field of table (within the template),
+  // or 0 if the field is absent.
+  template<typename T>
+  uoffset_t FieldPosition(const T *table, voffset_t field) const {
+    // Cast, since Table is a private baseclass of any table types.
+    auto t = reinterpret_cast<const Table *>(table);
+    auto field_offset = t->GetOptionalFieldOffset(field);
+    return field_offset ? static_cast<uoffset_t>(
+                              reinterpret_cast<const uint8_t *>(t) - data() +
+                              field_offset)
+                        : 0;
+  }
+
+ private:
+  std::vector<uint8_t> buf_;
+};
+
 template<typename T> void FlatBufferBuilder::Required(Offset<T> table,
                                                       voffset_t field) {
   auto table_ptr = reinterpret_cast<const Table *>(buf_.data_at(table.o));
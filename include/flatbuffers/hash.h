@@ -19,6 +19,7 @@
 
 #include <cstdint>
 #include <cstring>
+#include <functional>
 
 #include "flatbuffers/flatbuffers.h"
 
@@ -122,6 +123,250 @@ inline NamedHashFunction<uint64_t>::HashFunction FindHashFunction64(
   return nullptr;
 }
 
+// Hashing and equality for the Hash() and Equals() functions generated with
+// --gen-hash. These hashes are fast and non-cryptographic, and only meant to
+// be used in memory (e.g. in hash tables): they may differ between versions
+// and platforms.
+
+// Mix value into the hash seed (using the MurmurHash3 finalizer).
+inline uint64_t HashCombine(uint64_t seed, uint64_t value) {
+  uint64_t h =
+      seed ^ (value + 0x9E3779B97F4A7C15ULL + (seed << 6) + (seed >> 2));
+  h ^= h >> 33;
+  h *= 0xFF51AFD7ED558CCDULL;
+  h ^= h >> 33;
+  h *= 0xC4CEB9FE1A85EC53ULL;
+  return h ^ (h >> 33);
+}
+
+inline uint64_t HashBytes(uint64_t seed, const void *data, size_t size) {
+  auto p = static_cast<const uint8_t *>(data);
+  auto h = HashCombine(seed, size);
+  for (; size >= sizeof(uint64_t);
+       p += sizeof(uint64_t), size -= sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, p, sizeof(uint64_t));
+    h = HashCombine(h, word);
+  }
+  if (size) {
+    uint64_t word = 0;
+    memcpy(&word, p, size);
+    h = HashCombine(h, word);
+  }
+  return h;
+}
+
+// The bits of a scalar, so floating point values are hashed and compared
+// exactly (which also makes a NaN equal to itself).
+template<typename T> uint64_t ScalarBits(T value) {
+  uint64_t bits = 0;
+  memcpy(&bits, &value, sizeof(T));
+  return bits;
+}
+
+template<typename T> uint64_t HashScalar(uint64_t seed, T value) {
+  return HashCombine(seed, ScalarBits(value));
+}
+
+template<typename T> bool ScalarEquals(T a, T b) {
+  return ScalarBits(a) == ScalarBits(b);
+}
+
+// Vectors of scalars hash the same whether they are in a buffer (in little
+// endian order) or in a native table.
+template<typename T>
+uint64_t HashScalars(uint64_t seed, const T *data, size_t size) {
+  // clang-format off
+  #if FLATBUFFERS_LITTLEENDIAN
+    return HashBytes(seed, data, size * sizeof(T));
+  #else
+    auto h = HashCombine(seed, size * sizeof(T));
+    for (size_t i = 0; i < size; i++) h = HashScalar(h, data[i]);
+    return h;
+  #endif
+  // clang-format on
+}
+
+template<typename T> uint64_t HashScalars(uint64_t seed, const Vector<T> &v) {
+  // clang-format off
+  #if FLATBUFFERS_LITTLEENDIAN
+    return HashBytes(seed, v.data(), v.size() * sizeof(T));
+  #else
+    auto h = HashCombine(seed, v.size() * sizeof(T));
+    for (uoffset_t i = 0; i < v.size(); i++) h = HashScalar(h, v.Get(i));
+    return h;
+  #endif
+  // clang-format on
+}
+
+template<typename T>
+uint64_t HashScalars(uint64_t seed, const VectorView<T> &v) {
+  // clang-format off
+  #if FLATBUFFERS_LITTLEENDIAN
+    return HashBytes(seed, v.data(), v.size() * sizeof(T));
+  #else
+    auto h = HashCombine(seed, v.size() * sizeof(T));
+    for (size_t i = 0; i < v.size(); i++) h = HashScalar(h, v.Get(i));
+    return h;
+  #endif
+  // clang-format on
+}
+
+template<typename T, typename Alloc>
+uint64_t HashScalars(uint64_t seed, const std::vector<T, Alloc> &v) {
+  return HashScalars(seed, v.data(), v.size());
+}
+
+// Vectors of native enums and booleans, which are stored as (and must be
+// hashed like) their underlying type T.
+template<typename T, typename E, typename Alloc>
+uint64_t HashScalarsAs(uint64_t seed, const std::vector<E, Alloc> &v) {
+  // clang-format off
+  #if FLATBUFFERS_LITTLEENDIAN
+    // Pack them into words as HashBytes reads them.
+    auto h = HashCombine(seed, v.size() * sizeof(T));
+    const size_t per_word = sizeof(uint64_t) / sizeof(T);
+    for (size_t i = 0; i < v.size(); i += per_word) {
+      uint64_t word = 0;
+      for (size_t j = i; j < v.size() && j < i + per_word; j++) {
+        auto value = static_cast<T>(v[j]);
+        memcpy(reinterpret_cast<uint8_t *>(&word) + (j - i) * sizeof(T),
+               &value, sizeof(T));
+      }
+      h = HashCombine(h, word);
+    }
+    return h;
+  #else
+    auto h = HashCombine(seed, v.size() * sizeof(T));
+    for (size_t i = 0; i < v.size(); i++) {
+      h = HashScalar(h, static_cast<T>(v[i]));
+    }
+    return h;
+  #endif
+  // clang-format on
+}
+
+inline uint64_t HashStrings(uint64_t seed, const Vector<Offset<String>> &v) {
+  auto h = HashCombine(seed, v.size());
+  for (auto it = v.begin(); it != v.end(); ++it) {
+    h = HashBytes(h, it->c_str(), it->size());
+  }
+  return h;
+}
+
+template<typename S, typename Alloc>
+uint64_t HashStrings(uint64_t seed, const std::vector<S, Alloc> &v) {
+  auto h = HashCombine(seed, v.size());
+  for (auto it = v.begin(); it != v.end(); ++it) {
+    h = HashBytes(h, it->c_str(), it->length());
+  }
+  return h;
+}
+
+// Tables is either a Vector of tables or a vector of pointers to native
+// tables, which have a Hash() that agrees with it.
+template<typename V> uint64_t HashTables(uint64_t seed, const V &tables) {
+  auto h = HashCombine(seed, tables.size());
+  for (auto it = tables.begin(); it != tables.end(); ++it) {
+    h = HashCombine(h, *it ? (*it)->Hash() : 0);
+  }
+  return h;
+}
+
+// The values of a vector of unions are hashed by the generated HashX(value,
+// type) of union X, and those of a native vector by XUnion::Hash().
+template<typename E>
+uint64_t HashUnions(uint64_t seed, const Vector<Offset<void>> &values,
+                    const Vector<uint8_t> &types,
+                    size_t (*hash)(const void *, E)) {
+  auto size = std::min(values.size(), types.size());
+  auto h = HashCombine(seed, size);
+  for (uoffset_t i = 0; i < size; i++) {
+    auto type = types.GetEnum<E>(i);
+    h = HashCombine(HashCombine(h, static_cast<uint64_t>(type)),
+                    hash(values.Get(i), type));
+  }
+  return h;
+}
+
+template<typename U, typename Alloc>
+uint64_t HashUnions(uint64_t seed, const std::vector<U, Alloc> &unions) {
+  auto h = HashCombine(seed, unions.size());
+  for (auto it = unions.begin(); it != unions.end(); ++it) {
+    h = HashCombine(HashCombine(h, static_cast<uint64_t>(it->type)),
+                    it->Hash());
+  }
+  return h;
+}
+
+// Absent strings and vectors are equal to empty ones.
+inline bool StringEquals(const String *a, const String *b) {
+  auto size = a ? a->size() : 0;
+  return size == (b ? b->size() : 0) &&
+         (!size || memcmp(a->c_str(), b->c_str(), size) == 0);
+}
+
+template<typename T> bool StructEquals(const T *a, const T *b) {
+  if (!a || !b) return a == b;
+  return memcmp(a, b, sizeof(T)) == 0;
+}
+
+template<typename T> bool TableEquals(const T *a, const T *b) {
+  if (!a || !b) return a == b;
+  return a->Equals(*b);
+}
+
+// Vectors of scalars and structs.
+template<typename T> bool VectorEquals(const Vector<T> *a, const Vector<T> *b) {
+  auto size = a ? a->size() : 0;
+  return size == (b ? b->size() : 0) &&
+         (!size || memcmp(a->Data(), b->Data(),
+                          size * IndirectHelper<T>::element_stride) == 0);
+}
+
+inline bool VectorEquals(const Vector<Offset<String>> *a,
+                         const Vector<Offset<String>> *b) {
+  auto size = a ? a->size() : 0;
+  if (size != (b ? b->size() : 0)) return false;
+  for (uoffset_t i = 0; i < size; i++) {
+    if (!StringEquals(a->Get(i), b->Get(i))) return false;
+  }
+  return true;
+}
+
+template<typename T>
+bool VectorEquals(const Vector<Offset<T>> *a, const Vector<Offset<T>> *b) {
+  auto size = a ? a->size() : 0;
+  if (size != (b ? b->size() : 0)) return false;
+  for (uoffset_t i = 0; i < size; i++) {
+    if (!TableEquals(a->Get(i), b->Get(i))) return false;
+  }
+  return true;
+}
+
+template<typename E>
+bool UnionsEqual(const Vector<Offset<void>> *a_values,
+                 const Vector<uint8_t> *a_types,
+                 const Vector<Offset<void>> *b_values,
+                 const Vector<uint8_t> *b_types,
+                 bool (*equals)(const void *, const void *, E)) {
+  auto size = a_values && a_types ? std::min(a_values->size(), a_types->size())
+                                  : 0;
+  if (size != (b_values && b_types
+                   ? std::min(b_values->size(), b_types->size())
+                   : 0)) {
+    return false;
+  }
+  for (uoffset_t i = 0; i < size; i++) {
+    auto type = a_types->GetEnum<E>(i);
+    if (type != b_types->GetEnum<E>(i) ||
+        !equals(a_values->Get(i), b_values->Get(i), type)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 }  // namespace flatbuffers
 
 #endif  // FLATBUFFERS_HASH_H_
@@ -17,6 +17,7 @@
 #ifndef FLATBUFFERS_IDL_H_
 #define FLATBUFFERS_IDL_H_
 
+#include <iosfwd>
 #include <map>
 #include <memory>
 #include <stack>
@@ -29,6 +30,7 @@
 
 #if !defined(FLATBUFFERS_CPP98_STL)
 #  include <functional>
+#  include <mutex>
 #endif  // !defined(FLATBUFFERS_CPP98_STL)
 
 // This file defines the data types representing a parsed IDL (Interface
@@ -133,6 +135,7 @@ inline size_t SizeOf(BaseType t) { return kTypeSizes[t]; }
 struct StructDef;
 struct EnumDef;
 class Parser;
+class JsonPrinter;
 
 // Represents any type in the IDL, which is a combination of the BaseType
 // and additional information for vectors/structs_.
@@ -153,6 +156,8 @@ struct Type {
 
   Offset<reflection::Type> Serialize(FlatBufferBuilder *builder) const;
 
+  bool Deserialize(const Parser &parser, const reflection::Type *type);
+
   BaseType base_type;
   BaseType element;       // only set if t == BASE_TYPE_VECTOR
   StructDef *struct_def;  // only set if t or element == BASE_TYPE_STRUCT
@@ -164,12 +169,33 @@ struct Type {
 struct Value {
   Value()
       : constant("0"),
-        offset(static_cast<voffset_t>(~(static_cast<voffset_t>(0U)))) {}
+        offset(static_cast<voffset_t>(~(static_cast<voffset_t>(0U)))),
+        integer(0) {}
   Type type;
   std::string constant;
   voffset_t offset;
+  // Binary form of the value, kept alongside constant by the parser so
+  // values don't have to be converted back from text when serialized:
+  // integer holds integer scalars (unsigned ones as their bit pattern) and
+  // the offset of a table, string or vector; real holds float scalars.
+  // Not used for structs, whose bytes are stored in constant.
+  union {
+    int64_t integer;
+    double real;
+  };
+
+  // The binary form as T, a scalar type, or Offset<void>.
+  template<typename T> T GetValue() const {
+    return flatbuffers::is_floating_point<T>::value
+               ? static_cast<T>(real)
+               : static_cast<T>(integer);
+  }
 };
 
+template<> inline Offset<void> Value::GetValue<Offset<void>>() const {
+  return Offset<void>(static_cast<uoffset_t>(integer));
+}
+
 // Helper class that retains the original order of a set of identifiers and
 // also provides quick lookup.
 template<typename T> class SymbolTable {
@@ -234,6 +260,9 @@ struct Definition {
   flatbuffers::Offset<
       flatbuffers::Vector<flatbuffers::Offset<reflection::KeyValue>>>
   SerializeAttributes(FlatBufferBuilder *builder, const Parser &parser) const;
+
+  bool DeserializeAttributes(Parser &parser,
+                             const Vector<Offset<reflection::KeyValue>> *attrs);
   std::string GetFullyQualifiedNamespace() const {
     return defined_namespace == nullptr ? 
       std::string() :
@@ -271,6 +300,8 @@ struct FieldDef : public Definition {
   Offset<reflection::Field> Serialize(FlatBufferBuilder *builder, uint16_t id,
                                       const Parser &parser) const;
 
+  bool Deserialize(Parser &parser, const reflection::Field *field);
+
   Value value;
   bool deprecated;  // Field is allowed to be present in old data, but can't be.
                     // written in new data nor accessed in new code.
@@ -308,6 +339,8 @@ struct StructDef : public Definition {
   Offset<reflection::Object> Serialize(FlatBufferBuilder *builder,
                                        const Parser &parser) const;
 
+  bool Deserialize(Parser &parser, const reflection::Object *object);
+
   SymbolTable<FieldDef> fields;
 
   bool fixed;       // If it's struct, not a table.
@@ -337,6 +370,8 @@ struct EnumVal {
 
   Offset<reflection::EnumVal> Serialize(FlatBufferBuilder *builder, const Parser &parser) const;
 
+  bool Deserialize(const Parser &parser, const reflection::EnumVal *val);
+
   std::string name;
   std::vector<std::string> doc_comment;
   int64_t value;
@@ -344,25 +379,109 @@ struct EnumVal {
 };
 
 struct EnumDef : public Definition {
-  EnumDef() : is_union(false), uses_multiple_type_instances(false) {}
+  EnumDef()
+      : is_union(false),
+        uses_multiple_type_instances(false),
+        lookup_size_(0),
+        min_value_(0) {}
+
+  // Finds the (first declared) value equal to enum_idx. This takes constant
+  // time for enums with densely packed values, and does a binary search for
+  // others.
+  EnumVal *ReverseLookup(int64_t enum_idx,
+                         bool skip_union_default = true) const {
+    if (lookup_size_ != vals.vec.size()) {
+      return LinearReverseLookup(enum_idx, skip_union_default);
+    }
+    EnumVal *enum_val = nullptr;
+    if (!dense_values_.empty()) {
+      auto offset = static_cast<uint64_t>(enum_idx) -
+                    static_cast<uint64_t>(min_value_);
+      if (offset < dense_values_.size()) enum_val = dense_values_[offset];
+    } else {
+      auto it = std::lower_bound(sorted_values_.begin(), sorted_values_.end(),
+                                 enum_idx, ValueLess);
+      if (it != sorted_values_.end() && it->first == enum_idx) {
+        enum_val = it->second;
+      }
+    }
+    // A union's NONE may share its value with a later one.
+    if (enum_val && enum_val == vals.vec[0] && is_union &&
+        skip_union_default) {
+      return LinearReverseLookup(enum_idx, skip_union_default);
+    }
+    return enum_val;
+  }
 
-  EnumVal *ReverseLookup(int64_t enum_idx, bool skip_union_default = true) {
-    for (auto it = vals.vec.begin() +
-                   static_cast<int>(is_union && skip_union_default);
-         it != vals.vec.end(); ++it) {
-      if ((*it)->value == enum_idx) { return *it; }
+  // Finds a value by its name in vals.dict, in constant time.
+  EnumVal *Lookup(const char *val_name, size_t length) const {
+    if (lookup_size_ != vals.vec.size() || name_slots_.empty()) {
+      return vals.Lookup(std::string(val_name, length));
     }
-    return nullptr;
+    // Linear probing, up to an empty slot, of which at least half are.
+    auto mask = name_slots_.size() - 1;
+    for (auto i = NameHash(val_name, length) & mask;; i = (i + 1) & mask) {
+      const auto &slot = name_slots_[i];
+      if (!slot.first) return nullptr;
+      if (slot.first->size() == length &&
+          !memcmp(slot.first->data(), val_name, length)) {
+        return slot.second;
+      }
+    }
+  }
+  EnumVal *Lookup(const std::string &val_name) const {
+    return Lookup(val_name.c_str(), val_name.size());
   }
 
+  // Builds the tables behind ReverseLookup and Lookup. The parser calls this
+  // once all values of an enum are known; until it is called again after
+  // values are added, both fall back to searching vals.
+  void BuildLookupTables();
+
   Offset<reflection::Enum> Serialize(FlatBufferBuilder *builder, const Parser &parser) const;
 
+  bool Deserialize(Parser &parser, const reflection::Enum *enum_def);
+
   SymbolTable<EnumVal> vals;
   bool is_union;
   // Type is a union which uses type aliases where at least one type is
   // available under two different names.
   bool uses_multiple_type_instances;
   Type underlying_type;
+
+ private:
+  EnumVal *LinearReverseLookup(int64_t enum_idx,
+                               bool skip_union_default) const {
+    for (auto it = vals.vec.begin() +
+                   static_cast<int>(is_union && skip_union_default);
+         it != vals.vec.end(); ++it) {
+      if ((*it)->value == enum_idx) { return *it; }
+    }
+    return nullptr;
+  }
+
+  static bool ValueLess(const std::pair<int64_t, EnumVal *> &a, int64_t b) {
+    return a.first < b;
+  }
+
+  // FNV-1a, with its high bits folded into the low ones that pick a slot.
+  static size_t NameHash(const char *s, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++) {
+      hash ^= static_cast<uint8_t>(s[i]);
+      hash *= 16777619u;
+    }
+    return hash ^ (hash >> 16);
+  }
+
+  size_t lookup_size_;  // vals.vec.size() when the tables were built.
+  // Either dense_values_, indexed by value - min_value_, or sorted_values_
+  // is used for ReverseLookup.
+  int64_t min_value_;
+  std::vector<EnumVal *> dense_values_;
+  std::vector<std::pair<int64_t, EnumVal *>> sorted_values_;
+  // Open addressing hash table of the names in vals.dict, at most half full.
+  std::vector<std::pair<const std::string *, EnumVal *>> name_slots_;
 };
 
 inline bool EqualByName(const Type &a, const Type &b) {
@@ -375,12 +494,16 @@ inline bool EqualByName(const Type &a, const Type &b) {
 struct RPCCall : public Definition {
   Offset<reflection::RPCCall> Serialize(FlatBufferBuilder *builder, const Parser &parser) const;
 
+  bool Deserialize(Parser &parser, const reflection::RPCCall *call);
+
   StructDef *request, *response;
 };
 
 struct ServiceDef : public Definition {
   Offset<reflection::Service> Serialize(FlatBufferBuilder *builder, const Parser &parser) const;
 
+  bool Deserialize(Parser &parser, const reflection::Service *service);
+
   SymbolTable<RPCCall> calls;
 };
 
@@ -407,8 +530,12 @@ struct IDLOptions {
   bool generate_name_strings;
   bool generate_object_based_api;
   bool gen_compare;
+  bool gen_hash;
+  bool gen_buffer_templates;
   std::string cpp_object_api_pointer_type;
   std::string cpp_object_api_string_type;
+  bool cpp_object_api_arena;
+  bool cpp_object_api_views;
   bool gen_nullable;
   bool gen_generated;
   std::string object_prefix;
@@ -428,6 +555,8 @@ struct IDLOptions {
   bool size_prefixed;
   std::string root_type;
   bool force_defaults;
+  // Text generation prints large vectors of tables on this many threads.
+  size_t num_threads;
 
   // Possible options for the more general generator below.
   enum Language {
@@ -484,7 +613,11 @@ struct IDLOptions {
         generate_name_strings(false),
         generate_object_based_api(false),
         gen_compare(false),
+        gen_hash(false),
+        gen_buffer_templates(false),
         cpp_object_api_pointer_type("std::unique_ptr"),
+        cpp_object_api_arena(false),
+        cpp_object_api_views(false),
         gen_nullable(false),
         gen_generated(false),
         object_suffix("T"),
@@ -499,6 +632,7 @@ struct IDLOptions {
         protobuf_ascii_alike(false),
         size_prefixed(false),
         force_defaults(false),
+        num_threads(1),
         lang(IDLOptions::kJava),
         mini_reflect(IDLOptions::kNone),
         lang_to_generate(0),
@@ -611,6 +745,7 @@ class Parser : public ParserState {
     known_attributes_["deprecated"] = true;
     known_attributes_["required"] = true;
     known_attributes_["key"] = true;
+    known_attributes_["hashed"] = true;
     known_attributes_["hash"] = true;
     known_attributes_["id"] = true;
     known_attributes_["force_align"] = true;
@@ -633,11 +768,7 @@ class Parser : public ParserState {
     known_attributes_["private"] = true;
   }
 
-  ~Parser() {
-    for (auto it = namespaces_.begin(); it != namespaces_.end(); ++it) {
-      delete *it;
-    }
-  }
+  ~Parser();
 
   // Parse the string containing either schema or JSON data, which will
   // populate the SymbolTable's or the FlatBufferBuilder above.
@@ -668,6 +799,15 @@ class Parser : public ParserState {
   // See reflection/reflection.fbs
   void Serialize();
 
+  // The reverse of Serialize(): populates the definitions from a binary
+  // schema (.bfbs), which is a lot faster than parsing the original text.
+  // Builtin attributes (e.g. hash, nested_flatbuffer, original_order) are
+  // only available if the schema was serialized with binary_schema_builtins.
+  // Returns false if the buffer isn't a valid schema, or its definitions
+  // clash with ones already present.
+  bool Deserialize(const uint8_t *buf, const size_t size);
+  bool Deserialize(const reflection::Schema *schema);
+
   // Checks that the schema represented by this parser is a safe evolution
   // of the schema provided. Returns non-empty error on any problems.
   std::string ConformTo(const Parser &base);
@@ -712,7 +852,7 @@ class Parser : public ParserState {
                                                  const StructDef *struct_def,
                                                  F body);
   FLATBUFFERS_CHECKED_ERROR ParseTable(const StructDef &struct_def,
-                                       std::string *value, uoffset_t *ovalue);
+                                       Value *value, uoffset_t *ovalue);
   void SerializeStruct(const StructDef &struct_def, const Value &val);
   template<typename F>
   FLATBUFFERS_CHECKED_ERROR ParseVectorDelimiters(size_t &count, F body);
@@ -792,6 +932,16 @@ class Parser : public ParserState {
   IDLOptions opts;
   bool uses_flexbuffers_;
 
+  // Printers that GenerateText reuses from one call to the next, so the way
+  // each table is printed is only worked out once. There are as many as
+  // threads have called it at the same time. See idl_gen_text.cpp.
+  mutable std::vector<JsonPrinter *> text_printers_;
+  // clang-format off
+  #ifndef FLATBUFFERS_CPP98_STL
+    mutable std::mutex text_printers_mutex_;
+  #endif
+  // clang-format on
+
  private:
   const char *source_;
 
@@ -803,6 +953,303 @@ class Parser : public ParserState {
   int recurse_protection_counter;
 };
 
+// A schema that can't be modified once loaded, so it can be shared by any
+// number of threads, each converting JSON with their own
+// JsonIngester(schema.parser()) and generating it with their own
+// JsonPrinter. Unlike a Parser used directly, none of these hold the state
+// of parsing the schema itself, which is freed once loading completes.
+class CompiledSchema {
+ public:
+  explicit CompiledSchema(const IDLOptions &options = IDLOptions())
+      : parser_(options) {}
+
+  // Parse a schema (.fbs) like Parser::Parse, but without allowing JSON
+  // data. Loading more than one schema adds to the previous ones, and must
+  // be done before the schema is shared.
+  bool Load(const char *source, const char **include_paths = nullptr,
+            const char *source_filename = nullptr);
+
+  // Load a binary schema (.bfbs), see Parser::Deserialize.
+  bool LoadBinary(const uint8_t *buf, size_t size);
+
+  // Set or override the root type, like Parser::SetRootType.
+  bool SetRootType(const char *name) { return parser_.SetRootType(name); }
+
+  const Parser &parser() const { return parser_; }
+  const StructDef *root_struct_def() const { return parser_.root_struct_def_; }
+  const std::string &error() const { return parser_.error_; }
+
+ private:
+  Parser parser_;
+};
+
+// Converts JSON to a FlatBuffer of the root type of an already populated
+// Parser, accepting the same JSON as Parser::Parse, but much faster: the
+// text is scanned in a single pass (detecting string delimiters with SSE2
+// where available) without creating tokens, numbers are converted without
+// strtod in the common case, and values are written straight into builder_.
+// Anything it doesn't handle itself (e.g. comments, nested FlatBuffers or
+// FlexBuffers, hex numbers) and any error is handed off to a Parser sharing
+// the same schema, so results and error messages are identical.
+// The Parser must outlive this object and not be modified while it is in
+// use, but can be shared by any number of JsonIngesters, e.g. one per thread.
+// See idl_json_ingest.cpp.
+class JsonIngester {
+ public:
+  explicit JsonIngester(const Parser &parser);
+
+  // Parse a null-terminated JSON object into builder_ (which is cleared
+  // first), returning false and setting error_ if it isn't valid.
+  bool Parse(const char *json);
+
+  FlatBufferBuilder builder_;
+  std::string error_;
+  bool size_prefixed_;  // Defaults to opts.size_prefixed of the Parser.
+
+ private:
+  struct StructPlan;
+
+  struct FieldPlan {
+    const FieldDef *def;
+    const StructPlan *struct_plan;  // Of the table, struct or element type.
+    bool fast;    // Whether this field can be parsed without the Parser.
+    bool hashed;  // Has the hash attribute.
+  };
+
+  // Per table or struct lookup tables, computed once.
+  struct StructPlan {
+    const StructDef *def;
+    std::vector<FieldPlan> fields;  // In the same order as def->fields.vec.
+    std::vector<size_t> by_name;    // Indices into fields, sorted by name.
+    std::vector<const FieldDef *> required;
+  };
+
+  // A parsed field or vector element, like Parser::field_stack_.
+  struct Slot {
+    const FieldDef *field;
+    union {
+      int64_t integer;  // As in Value.
+      double real;
+    };
+    size_t struct_pos;  // Offset of the bytes of a struct in struct_bytes_.
+  };
+
+  bool Fallback(const char *json);
+  const FieldPlan *LookupField(const StructPlan &plan, const char *name,
+                               size_t len, size_t *hint) const;
+  void SkipWhitespace();
+  bool ReadString(const char **str, size_t *len, bool *trivial);
+  bool ReadKey(const char **name, size_t *len);
+  bool SkipValue();
+  bool ParseScalar(const Type &type, bool hashed, Slot *slot);
+  bool ParseEnum(const Type &type, const char *name, size_t len,
+                 int64_t *val);
+  bool ParseNumber(BaseType type, const char *str, size_t len, Slot *slot);
+  bool ParseValue(const Type &type, const FieldPlan *field,
+                  const StructPlan *struct_plan, size_t table_start,
+                  Slot *slot);
+  bool ParseUnion(const FieldPlan &field, const StructPlan &parent_plan,
+                  size_t table_start, Slot *slot);
+  bool ParseObject(const StructPlan &plan, Slot *slot);
+  bool ParseVector(const Type &type, const FieldPlan *field,
+                   const StructPlan *element_plan, uoffset_t *ovalue);
+  void SerializeStruct(const StructDef &struct_def, const Slot &slot,
+                       voffset_t offset);
+
+  const Parser &parser_;
+  std::vector<StructPlan> plans_;
+  std::map<const StructDef *, const StructPlan *> plans_by_def_;
+  const char *cursor_;
+  const char *end_;
+  int depth_;
+  std::vector<Slot> slots_;
+  std::vector<uint8_t> struct_bytes_;
+  std::string scratch_;
+};
+
+class TextSink;
+
+// Generates JSON for FlatBuffers of the root type of a CompiledSchema (or a
+// Parser, which must outlive it), reusing the storage of text_ from one call
+// to the next. The way each table or struct is printed is worked out once,
+// the first time it is encountered, and kept for later calls: field names are
+// quoted and escaped in advance, and default values converted to binary.
+// These depend on parser.opts at that time (and are recomputed if
+// strict_json, protobuf_ascii_alike or output_default_scalars_in_json change).
+// With opts.num_threads > 1, large vectors of tables are divided into up to
+// that many contiguous chunks, printed by a thread each with its own
+// JsonPrinter, and concatenated in order, giving the same text as one thread.
+// See idl_gen_text.cpp.
+class JsonPrinter {
+ public:
+  explicit JsonPrinter(const CompiledSchema &schema)
+      : parser_(schema.parser()),
+        plan_options_(-1),
+        sink_(nullptr),
+        worker_(false) {}
+  explicit JsonPrinter(const Parser &parser)
+      : parser_(parser), plan_options_(-1), sink_(nullptr), worker_(false) {}
+
+  // Replace text_ with the JSON for flatbuffer, returning false if it can't
+  // be represented in JSON, like GenerateText.
+  bool Print(const void *flatbuffer);
+
+  // Same as above, but passes the text to sink in chunks, see TextSink.
+  bool Print(const void *flatbuffer, TextSink *sink);
+
+  std::string text_;
+
+ private:
+  struct StructPlan;
+
+  struct FieldPlan {
+    const FieldDef *def;
+    const StructPlan *struct_plan;  // Of the table, struct or element type.
+    std::string key;  // Name and separator, e.g. `"name": `.
+    union {
+      int64_t integer;  // The default value, as in Value.
+      double real;
+    } default_value;
+    voffset_t offset;
+    bool output_anyway;  // Even when not present, for default scalars.
+  };
+
+  // Per table or struct, computed once.
+  struct StructPlan {
+    const StructDef *def;
+    std::vector<FieldPlan> fields;  // In the same order as def->fields.vec.
+  };
+
+  // Not copyable, since plans refer to each other.
+  JsonPrinter(const JsonPrinter &);
+  JsonPrinter &operator=(const JsonPrinter &);
+
+  const StructPlan *GetPlan(const StructDef &struct_def);
+  bool Generate(const void *flatbuffer, TextSink *sink);
+  void NewLineIndent(bool separate, int indent);
+  template<typename T> bool PrintScalar(T val, const Type &type);
+  template<typename T>
+  bool PrintVector(const Vector<T> &v, const Type &type,
+                   const StructPlan *element_plan, int indent);
+  bool PrintPointer(const void *val, const Type &type,
+                    const StructPlan *struct_plan, const Type *union_type,
+                    int indent);
+  template<typename T>
+  bool PrintField(const FieldPlan &field, const Table *table, bool fixed);
+  bool PrintFieldOffset(const FieldPlan &field, const Table *table, bool fixed,
+                        const Type *union_type, int indent);
+  bool PrintStruct(const StructPlan &plan, const Table *table, int indent);
+  bool PrintElements(const Vector<Offset<void>> &v, const Type &type,
+                     const StructPlan *element_plan, uoffset_t begin,
+                     uoffset_t end, int indent);
+  bool PrintElementsInParallel(const Vector<Offset<void>> &v,
+                               const Type &type,
+                               uoffset_t min_chunk_elements, int indent);
+  static void PrintChunk(JsonPrinter *worker, const Vector<Offset<void>> *v,
+                         const Type *type, uoffset_t begin, uoffset_t end,
+                         int indent, uint8_t *ok);
+
+  const Parser &parser_;
+  std::map<const StructDef *, StructPlan> plans_;
+  int plan_options_;  // The options plans_ were made with.
+  std::string separators_;  // A comma, newline and indentation to copy from.
+  TextSink *sink_;          // During a call to Print.
+  bool worker_;             // Prints a chunk for another JsonPrinter.
+};
+
+inline Parser::~Parser() {
+  for (auto it = namespaces_.begin(); it != namespaces_.end(); ++it) {
+    delete *it;
+  }
+  for (auto it = text_printers_.begin(); it != text_printers_.end(); ++it) {
+    delete *it;
+  }
+}
+
+class RecordStreamWriter;
+
+// Converts newline delimited JSON (one JSON object per line, blank lines are
+// ignored) to size prefixed FlatBuffers of the root type of parser, appending
+// them to writer in input order. The lines are divided over num_threads
+// threads, each with its own JsonIngester sharing the schema of parser.
+// On the first invalid line, returns false and sets error, which starts with
+// its line number.
+// See idl_json_ingest.cpp.
+extern bool ParseJsonLines(const Parser &parser, const char *json,
+                           size_t length, size_t num_threads,
+                           RecordStreamWriter *writer, std::string *error);
+
+// Receives the text of GenerateText in chunks, so its memory use doesn't
+// depend on the size of the FlatBuffer. Text is collected in a buffer that is
+// passed to Write() whenever it holds buffer_size bytes or more, and once more
+// at the end. The buffer only grows beyond that to fit a single value (such
+// as a long string) that doesn't fit, so after the first use of a sink,
+// generating text doesn't allocate memory.
+// See idl_gen_text.cpp.
+class TextSink {
+ public:
+  explicit TextSink(size_t buffer_size = 64 * 1024);
+  virtual ~TextSink() {}
+
+  // Called with each chunk of text. Returning false makes GenerateText fail.
+  virtual bool Write(const char *data, size_t size) = 0;
+
+  // Pass the buffered text to Write() if there is at least min_size of it.
+  bool Flush(size_t min_size = 0);
+
+  // Text that hasn't been passed to Write() yet.
+  const std::string &buffer() const { return buffer_; }
+  size_t buffer_size() const { return buffer_size_; }
+
+ protected:
+  friend class JsonPrinter;  // Appends to buffer_ directly.
+
+  std::string buffer_;
+  size_t buffer_size_;
+};
+
+// Calls a function with each chunk of text.
+typedef bool (*TextSinkFunction)(void *context, const char *data, size_t size);
+
+class CallbackTextSink : public TextSink {
+ public:
+  CallbackTextSink(TextSinkFunction function, void *context,
+                   size_t buffer_size = 64 * 1024)
+      : TextSink(buffer_size), function_(function), context_(context) {}
+
+  bool Write(const char *data, size_t size) FLATBUFFERS_OVERRIDE {
+    return function_(context_, data, size);
+  }
+
+ private:
+  TextSinkFunction function_;
+  void *context_;
+};
+
+// Writes the text to an open file descriptor, such as 1 for stdout.
+class FileDescriptorTextSink : public TextSink {
+ public:
+  explicit FileDescriptorTextSink(int fd, size_t buffer_size = 64 * 1024)
+      : TextSink(buffer_size), fd_(fd) {}
+
+  bool Write(const char *data, size_t size) FLATBUFFERS_OVERRIDE;
+
+ private:
+  int fd_;
+};
+
+// Writes the text to a std::ostream.
+class StreamTextSink : public TextSink {
+ public:
+  explicit StreamTextSink(std::ostream &stream, size_t buffer_size = 64 * 1024)
+      : TextSink(buffer_size), stream_(stream) {}
+
+  bool Write(const char *data, size_t size) FLATBUFFERS_OVERRIDE;
+
+ private:
+  std::ostream &stream_;
+};
+
 // Utility functions for multiple generators:
 
 extern std::string MakeCamel(const std::string &in, bool first = true);
@@ -818,7 +1265,21 @@ extern std::string MakeCamel(const std::string &in, bool first = true);
 extern bool GenerateText(const Parser &parser,
                          const void *flatbuffer,
                          std::string *text);
+
+// Same as above, but passes the text to sink in chunks as it is generated,
+// see TextSink.
+extern bool GenerateText(const Parser &parser,
+                         const void *flatbuffer,
+                         TextSink *sink);
+
+extern bool GenerateTextFile(const Parser &parser,
+                             const std::string &path,
+                             const std::string &file_name);
+
+// Same as above, but for a FlatBuffer that is not in parser.builder_, such as
+// a MappedFile.
 extern bool GenerateTextFile(const Parser &parser,
+                             const void *flatbuffer,
                              const std::string &path,
                              const std::string &file_name);
 
@@ -0,0 +1,362 @@
+/*
+ * Copyright 2018 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_RECORD_STREAM_H_
+#define FLATBUFFERS_RECORD_STREAM_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// clang-format off
+#ifndef FLATBUFFERS_CPP98_STL
+  #include <thread>
+#endif
+// clang-format on
+
+// A record stream is a sequence of size prefixed FlatBuffers (as produced by
+// FlatBufferBuilder::FinishSizePrefixed) stored back to back, e.g. a log file.
+// Normally getting to record N means walking every size prefix from the
+// start. RecordStreamWriter ends the stream with a sparse index of record
+// offsets, which RecordStreamReader uses to seek to any record in constant
+// time.
+//
+// Layout: records are aligned to kRecordStreamAlignment, and their sizes
+// (including the prefix) must be a multiple of sizeof(uoffset_t), as produced
+// by FinishSizePrefixed. Padding between them consists of empty records (a
+// size prefix of 0), and the index itself is stored as a final size prefixed
+// record containing:
+//   uint32_t magic;  // kRecordStreamMagic, marks the record as the index.
+//   uint64_t offsets[(num_records + stride - 1) / stride];  // Every stride-th.
+//   uint64_t num_records;
+//   uint32_t stride;
+//   uint32_t magic;  // kRecordStreamMagic.
+// All of this means a stream written here can still be read by just walking
+// the size prefixes, skipping empty records and the index (see
+// IsRecordStreamIndex), and RecordStreamReader can read streams without an
+// index too (it then builds the index on load).
+
+namespace flatbuffers {
+
+static const size_t kRecordStreamAlignment = sizeof(uint64_t);
+static const uint32_t kRecordStreamMagic = 0x58495246;  // "FRIX"
+static const uint32_t kRecordStreamDefaultStride = 64;
+
+// Size of the fields following the offsets in the index record.
+static const size_t kRecordStreamTrailerSize =
+    sizeof(uint64_t) + sizeof(uint32_t) + sizeof(uint32_t);
+
+// Whether a size prefixed record of len bytes is the index of a stream, for
+// readers that walk the records one by one. The magic number in place of a
+// root offset can't occur in a FlatBuffer smaller than it.
+inline bool IsRecordStreamIndex(const uint8_t *record, size_t len) {
+  return len >= 2 * sizeof(uoffset_t) && len < kRecordStreamMagic &&
+         ReadScalar<uint32_t>(record + sizeof(uoffset_t)) == kRecordStreamMagic;
+}
+
+class RecordStreamWriter {
+ public:
+  // "stride" is the number of records between index entries: larger values
+  // make for a smaller index, but each seek walks up to stride - 1 records.
+  explicit RecordStreamWriter(uint32_t stride = kRecordStreamDefaultStride)
+      : stride_(stride ? stride : 1), num_records_(0), finished_(false) {}
+
+  // Append a size prefixed buffer, e.g. from FinishSizePrefixed. Returns
+  // false, appending nothing, if len doesn't match its size prefix or isn't
+  // a multiple of sizeof(uoffset_t), since empty records can't pad it.
+  bool Append(const uint8_t *buf, size_t len) {
+    FLATBUFFERS_ASSERT(!finished_);
+    if (len < sizeof(uoffset_t) || len % sizeof(uoffset_t) ||
+        GetPrefixedSize(buf) != len - sizeof(uoffset_t))
+      return false;
+    Pad();
+    if (num_records_ % stride_ == 0) index_.push_back(data_.size());
+    data_.insert(data_.end(), buf, buf + len);
+    num_records_++;
+    return true;
+  }
+
+  bool Append(const FlatBufferBuilder &fbb) {
+    return Append(fbb.GetBufferPointer(), fbb.GetSize());
+  }
+
+  // Writes the index. No records can be appended after this.
+  void Finish() {
+    FLATBUFFERS_ASSERT(!finished_);
+    // The size prefix and leading magic number align the offsets.
+    Pad();
+    auto index_size = sizeof(uint32_t) + index_.size() * sizeof(uint64_t) +
+                      kRecordStreamTrailerSize;
+    WriteValue(static_cast<uoffset_t>(index_size));
+    WriteValue(kRecordStreamMagic);
+    for (auto it = index_.begin(); it != index_.end(); ++it) {
+      WriteValue(static_cast<uint64_t>(*it));
+    }
+    WriteValue(static_cast<uint64_t>(num_records_));
+    WriteValue(stride_);
+    WriteValue(kRecordStreamMagic);
+    finished_ = true;
+  }
+
+  size_t num_records() const { return num_records_; }
+
+  // The stream so far, which is complete once Finish() has been called.
+  const uint8_t *data() const { return vector_data(data_); }
+  size_t size() const { return data_.size(); }
+
+  // Take ownership of the stream, resetting the writer.
+  std::vector<uint8_t> Release() {
+    std::vector<uint8_t> data;
+    data.swap(data_);
+    index_.clear();
+    num_records_ = 0;
+    finished_ = false;
+    return data;
+  }
+
+ private:
+  // Insert empty records until the end of the stream is aligned. Records
+  // are a multiple of their size, so this always ends.
+  void Pad() {
+    while (data_.size() % kRecordStreamAlignment) {
+      WriteValue(static_cast<uoffset_t>(0));
+    }
+  }
+
+  template<typename T> void WriteValue(T val) {
+    uint8_t bytes[sizeof(T)];
+    WriteScalar(bytes, val);
+    data_.insert(data_.end(), bytes, bytes + sizeof(T));
+  }
+
+  uint32_t stride_;
+  size_t num_records_;
+  bool finished_;
+  std::vector<uint8_t> data_;
+  std::vector<size_t> index_;
+};
+
+class RecordStreamReader {
+ public:
+  RecordStreamReader()
+      : data_(nullptr), end_(0), num_records_(0), stride_(0) {}
+
+  // Attach to a stream (which must stay alive while the reader is in use),
+  // returning false if it is malformed, i.e. a record extends beyond the end
+  // of the data. If the stream has an index it is used as is, otherwise the
+  // stream is walked to build one.
+  bool Open(const uint8_t *data, size_t size) {
+    data_ = data;
+    end_ = size;
+    num_records_ = 0;
+    stride_ = kRecordStreamDefaultStride;
+    index_.clear();
+    if (ReadIndex(size)) return true;
+    // No usable index, build one.
+    end_ = size;
+    index_.clear();
+    for (size_t pos = 0; pos < end_;) {
+      size_t len;
+      if (!RecordAt(pos, &len)) return false;
+      if (IsRecord(pos, len)) {
+        if (num_records_ % stride_ == 0) index_.push_back(pos);
+        num_records_++;
+      }
+      pos += len;
+    }
+    return true;
+  }
+
+  // Number of records in the stream.
+  size_t size() const { return num_records_; }
+
+  // Get record i, which is a size prefixed buffer that can be passed to
+  // GetSizePrefixedRoot. Its size including the prefix is stored in "len"
+  // if not null. Returns null if i is out of range or the stream is
+  // malformed.
+  const uint8_t *Get(size_t i, size_t *len = nullptr) const {
+    if (i >= num_records_) return nullptr;
+    size_t pos = static_cast<size_t>(index_[i / stride_]);
+    size_t record_len = 0;
+    for (size_t skip = i % stride_ + 1;;) {
+      if (!RecordAt(pos, &record_len)) return nullptr;
+      if (IsRecord(pos, record_len) && !--skip) break;
+      pos += record_len;
+    }
+    if (len) *len = record_len;
+    return data_ + pos;
+  }
+
+  template<typename T> const T *GetRoot(size_t i) const {
+    auto buf = Get(i);
+    return buf ? GetSizePrefixedRoot<T>(buf) : nullptr;
+  }
+
+  // Verify record i with VerifySizePrefixedBuffer, for streams that come
+  // from an untrusted source.
+  template<typename T>
+  bool Verify(size_t i, const char *identifier = nullptr) const {
+    size_t len;
+    auto buf = Get(i, &len);
+    if (!buf) return false;
+    Verifier verifier(buf, len);
+    return verifier.VerifySizePrefixedBuffer<T>(identifier);
+  }
+
+  // Call f(index, buf, len) for records [begin, end) in order, stopping
+  // early if it returns false. Cheaper than calling Get() for every record.
+  // Returns false if stopped early or the stream is malformed.
+  template<typename F> bool ForEach(size_t begin, size_t end, F f) const {
+    if (end > num_records_) end = num_records_;
+    if (begin >= end) return true;
+    size_t len;
+    auto buf = Get(begin, &len);
+    if (!buf) return false;
+    auto pos = static_cast<size_t>(buf - data_);
+    for (size_t i = begin;;) {
+      if (IsRecord(pos, len)) {
+        if (!f(i, data_ + pos, len)) return false;
+        if (++i == end) return true;
+      }
+      pos += len;
+      if (!RecordAt(pos, &len)) return false;
+    }
+  }
+
+  // Verify all records, partitioned over num_threads threads.
+  template<typename T>
+  bool VerifyAll(const char *identifier = nullptr,
+                 size_t num_threads = 1) const {
+    return ParallelForEach(num_threads, [identifier](size_t, const uint8_t *buf,
+                                                     size_t len) {
+      Verifier verifier(buf, len);
+      return verifier.VerifySizePrefixedBuffer<T>(identifier);
+    });
+  }
+
+  // Call f(index, buf, len) for all records, partitioned into contiguous
+  // ranges (which start on an index entry) processed by num_threads threads
+  // concurrently. Each thread stops early if f returns false.
+  // Returns true if f returned true for all records.
+  template<typename F>
+  bool ParallelForEach(size_t num_threads, F f) const {
+    auto entries = index_.size();
+    if (num_threads > entries) num_threads = entries;
+    // clang-format off
+    #ifndef FLATBUFFERS_CPP98_STL
+      if (num_threads > 1) {
+        std::vector<std::thread> threads;
+        std::vector<uint8_t> results(num_threads, 1);
+        for (size_t t = 0; t < num_threads; t++) {
+          auto begin = entries * t / num_threads * stride_;
+          auto end = entries * (t + 1) / num_threads * stride_;
+          auto result = &results[t];
+          threads.push_back(std::thread([this, begin, end, result, &f]() {
+            *result = ForEach(begin, end, f);
+          }));
+        }
+        for (auto it = threads.begin(); it != threads.end(); ++it) it->join();
+        for (auto it = results.begin(); it != results.end(); ++it) {
+          if (!*it) return false;
+        }
+        return true;
+      }
+    #endif
+    // clang-format on
+    return ForEach(0, num_records_, f);
+  }
+
+ private:
+  // Check there is a complete record at pos, and store its size including
+  // the prefix in len.
+  bool RecordAt(size_t pos, size_t *len) const {
+    if (pos > end_ || end_ - pos < sizeof(uoffset_t)) return false;
+    *len = GetPrefixedSize(data_ + pos) + sizeof(uoffset_t);
+    return *len <= end_ - pos;
+  }
+
+  // Whether the complete record of len bytes at pos is one of the stream's,
+  // rather than padding or the index of a stream that was appended to.
+  bool IsRecord(size_t pos, size_t len) const {
+    return len > sizeof(uoffset_t) && !IsRecordStreamIndex(data_ + pos, len);
+  }
+
+  // Advance pos past padding and indexes to the next record, storing its
+  // size in len, or to end_ if there is none.
+  bool SkipToRecord(size_t *pos, size_t *len) const {
+    for (; *pos < end_; *pos += *len) {
+      if (!RecordAt(*pos, len)) return false;
+      if (IsRecord(*pos, *len)) return true;
+    }
+    return true;
+  }
+
+  bool ReadIndex(size_t size) {
+    auto trailer = kRecordStreamTrailerSize;
+    auto header = sizeof(uoffset_t) + sizeof(uint32_t);
+    if (size < header + trailer ||
+        ReadScalar<uint32_t>(data_ + size - sizeof(uint32_t)) !=
+            kRecordStreamMagic)
+      return false;
+    auto num_records = ReadScalar<uint64_t>(data_ + size - trailer);
+    auto stride =
+        ReadScalar<uint32_t>(data_ + size - trailer + sizeof(uint64_t));
+    if (!stride) return false;
+    auto entries = num_records / stride + (num_records % stride != 0);
+    if (entries > (size - trailer - header) / sizeof(uint64_t)) return false;
+    auto index_start = size - static_cast<size_t>(entries) * sizeof(uint64_t) -
+                       trailer;
+    auto record = index_start - header;
+    if (!IsRecordStreamIndex(data_ + record, size - record) ||
+        GetPrefixedSize(data_ + record) != size - record - sizeof(uoffset_t))
+      return false;
+    end_ = record;
+    for (size_t i = 0; i < entries; i++) {
+      auto pos = ReadScalar<uint64_t>(data_ + index_start +
+                                      i * sizeof(uint64_t));
+      if (pos >= end_ || (!index_.empty() && pos <= index_.back()))
+        return false;
+      index_.push_back(static_cast<size_t>(pos));
+    }
+    // An index belongs to all the data before it only if it starts at the
+    // first record and its last stride ends at the index. That isn't the
+    // case for e.g. the index of the last of several concatenated streams,
+    // whose offsets are relative to that stream.
+    size_t pos = 0;
+    size_t len = 0;
+    if (!SkipToRecord(&pos, &len)) return false;
+    if (pos != (entries ? index_[0] : end_)) return false;
+    if (entries) {
+      pos = index_.back();
+      auto remaining = num_records - (entries - 1) * stride;
+      for (; remaining; remaining--, pos += len) {
+        if (!SkipToRecord(&pos, &len) || pos == end_) return false;
+      }
+      if (!SkipToRecord(&pos, &len) || pos != end_) return false;
+    }
+    num_records_ = static_cast<size_t>(num_records);
+    stride_ = stride;
+    return true;
+  }
+
+  const uint8_t *data_;
+  size_t end_;  // End of the records, i.e. excluding the index.
+  size_t num_records_;
+  uint32_t stride_;
+  std::vector<size_t> index_;
+};
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_RECORD_STREAM_H_
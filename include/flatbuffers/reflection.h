@@ -24,6 +24,8 @@
 // See reflection/generate_code.sh
 #include "flatbuffers/reflection_generated.h"
 
+#include <map>
+
 // Helper functionality for reflection.
 
 namespace flatbuffers {
@@ -377,6 +379,9 @@ pointer_inside_vector<T, U> piv(T *ptr, std::vector<U> &vec) {
 
 inline const char *UnionTypeFieldSuffix() { return "_type"; }
 
+// The auto-generated field holding the hash index of a (hashed) vector.
+inline const char *HashIndexFieldSuffix() { return "_hash_index"; }
+
 // Helper to figure out the actual table type a union refers to.
 inline const reflection::Object &GetUnionType(
     const reflection::Schema &schema, const reflection::Object &parent,
@@ -465,6 +470,120 @@ Offset<const Table *> CopyTable(FlatBufferBuilder &fbb,
                                 const Table &table,
                                 bool use_string_pooling = false);
 
+// Copies the vector stored in "fielddef" of "table" into a FlatBuffer
+// builder, the same way CopyTable does for vector fields.
+uoffset_t CopyVector(FlatBufferBuilder &fbb, const reflection::Schema &schema,
+                     const reflection::Field &fielddef, const Table &table,
+                     bool use_string_pooling = false);
+
+// ------------------------- PROJECTION -------------------------
+
+// The values of a single field across all rows seen by a ColumnProjection,
+// stored as one contiguous array per column rather than one table per row.
+struct ProjectedColumn {
+  // Dot separated path of field names, starting at the row table.
+  std::string path;
+  // Type of the field the path ends in.
+  reflection::BaseType type;
+  // One entry per row, in ints for integer (incl. bool and enum) fields,
+  // floats for floating point fields, and strings for string fields.
+  // Strings point into the projected buffer (or are null if not present).
+  std::vector<int64_t> ints;
+  std::vector<double> floats;
+  std::vector<const String *> strings;
+  // One entry per row: 1 if the value was stored, 0 if the default was used
+  // (because the field, or a table on the path to it, was not present).
+  std::vector<uint8_t> present;
+};
+
+// Scatters the rows of a vector of tables into columns, as an alternative to
+// calling GetAnyFieldI etc. row by row for analytical workloads.
+// Columns can be any scalar or string field of the row table, or of tables
+// and structs reached from it (e.g. "pos.x"), but not through unions or
+// vectors.
+// Since the rows in a vector typically share only a handful of vtables,
+// the field offsets are looked up once per distinct vtable, and reused for all
+// other rows that share it, within one call to Project.
+class ColumnProjection {
+ public:
+  // "vector_field" must be a field holding a vector of tables.
+  ColumnProjection(const reflection::Schema &schema,
+                   const reflection::Field &vector_field);
+
+  // Returns false if "path" does not lead to a scalar or string field.
+  // All columns must be added before calling Project.
+  bool AddColumn(const std::string &path);
+
+  // Appends the values of all rows in the vector stored in "table" (which must
+  // be of the type that contains "vector_field") to the columns.
+  void Project(const Table &table);
+
+  const std::vector<ProjectedColumn> &columns() const { return columns_; }
+  size_t rows() const { return rows_; }
+
+ private:
+  // A table that is either the row itself, or that is reached from the table
+  // of the "parent" level by the field in slot "parent_slot".
+  struct Level {
+    const reflection::Object *objectdef;
+    int parent;
+    size_t parent_slot;
+    // The vtable offsets of the fields read from this table (its "slots").
+    std::vector<voffset_t> fields;
+    // The field offsets of all slots, per distinct vtable seen in the current
+    // call to Project.
+    std::map<const uint8_t *, size_t> shapes;
+    std::vector<voffset_t> offsets;
+    const uint8_t *last_vtable;
+    size_t last_shape;
+  };
+
+  struct ColumnSource {
+    const reflection::Field *field;
+    int level;
+    size_t slot;
+    // Offset of the field inside the (nested) struct stored in the slot.
+    size_t struct_offset;
+  };
+
+  size_t AddSlot(int level_idx, voffset_t field);
+  const voffset_t *LookupShape(Level &level, const Table &table);
+
+  const reflection::Schema &schema_;
+  const reflection::Field &vector_field_;
+  std::vector<Level> levels_;
+  std::vector<ColumnSource> sources_;
+  std::vector<ProjectedColumn> columns_;
+  size_t rows_;
+};
+
+// ------------------------- DIFFING -------------------------
+
+// Computes a patch that turns the FlatBuffer "oldbuf" into "newbuf" (of
+// length "newlen"), both having the same root type. The patch lists only the
+// values that differ, each by the path of fields and vector indices leading
+// to it, so it is typically much smaller than "newbuf" when only a few fields
+// change. Values that can't be changed in-place in "oldbuf" (e.g. fields that
+// are not stored in it) are sent as a copy of the enclosing table, or, as a
+// last resort, of the entire buffer.
+// The patch itself is a FlexBuffer, and can be stored or sent as-is.
+// If your FlatBuffer's root table is not the schema's root table, you should
+// pass in your root_table type as well.
+void DiffFlatBuffers(const reflection::Schema &schema, const uint8_t *oldbuf,
+                     const uint8_t *newbuf, size_t newlen,
+                     std::vector<uint8_t> *patch,
+                     const reflection::Object *root_table = nullptr);
+
+// Applies a patch created by DiffFlatBuffers to a copy of the original
+// buffer. FlatBuffer must live inside a std::vector so it can be resized in
+// the same way as SetString and ResizeVector do, which means the same caveats
+// apply: strings that are shared between multiple fields are changed for all
+// of them, and the buffer may end up containing some unreachable data.
+// Returns false if the patch doesn't match the buffer.
+bool ApplyPatch(const reflection::Schema &schema, const uint8_t *patch,
+                size_t patch_len, std::vector<uint8_t> *flatbuf,
+                const reflection::Object *root_table = nullptr);
+
 // Verifies the provided flatbuffer using reflection.
 // root should point to the root type for this flatbuffer.
 // buf should point to the start of flatbuffer data.
@@ -114,6 +114,9 @@ struct Type FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int32_t index() const {
     return GetField<int32_t>(VT_INDEX, -1);
   }
+  flatbuffers::FieldPresence<3> PresenceMask() const {
+    return flatbuffers::FieldPresence<3>(this);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<int8_t>(verifier, VT_BASE_TYPE) &&
@@ -173,9 +176,15 @@ struct KeyValue FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int KeyCompareWithValue(const char *val) const {
     return strcmp(key()->c_str(), val);
   }
+  const flatbuffers::String *GetKey() const {
+    return key();
+  }
   const flatbuffers::String *value() const {
     return GetPointer<const flatbuffers::String *>(VT_VALUE);
   }
+  flatbuffers::FieldPresence<2> PresenceMask() const {
+    return flatbuffers::FieldPresence<2>(this);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffsetRequired(verifier, VT_KEY) &&
@@ -248,6 +257,9 @@ struct EnumVal FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int KeyCompareWithValue(int64_t val) const {
     return static_cast<int>(value() > val) - static_cast<int>(value() < val);
   }
+  int64_t GetKey() const {
+    return value();
+  }
   const Object *object() const {
     return GetPointer<const Object *>(VT_OBJECT);
   }
@@ -257,6 +269,9 @@ struct EnumVal FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *documentation() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_DOCUMENTATION);
   }
+  flatbuffers::FieldPresence<5> PresenceMask() const {
+    return flatbuffers::FieldPresence<5>(this);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffsetRequired(verifier, VT_NAME) &&
@@ -354,6 +369,9 @@ struct Enum FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int KeyCompareWithValue(const char *val) const {
     return strcmp(name()->c_str(), val);
   }
+  const flatbuffers::String *GetKey() const {
+    return name();
+  }
   const flatbuffers::Vector<flatbuffers::Offset<EnumVal>> *values() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<EnumVal>> *>(VT_VALUES);
   }
@@ -369,6 +387,9 @@ struct Enum FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *documentation() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_DOCUMENTATION);
   }
+  flatbuffers::FieldPresence<6> PresenceMask() const {
+    return flatbuffers::FieldPresence<6>(this);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffsetRequired(verifier, VT_NAME) &&
@@ -484,6 +505,9 @@ struct Field FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int KeyCompareWithValue(const char *val) const {
     return strcmp(name()->c_str(), val);
   }
+  const flatbuffers::String *GetKey() const {
+    return name();
+  }
   const Type *type() const {
     return GetPointer<const Type *>(VT_TYPE);
   }
@@ -514,6 +538,9 @@ struct Field FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *documentation() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_DOCUMENTATION);
   }
+  flatbuffers::FieldPresence<11> PresenceMask() const {
+    return flatbuffers::FieldPresence<11>(this);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffsetRequired(verifier, VT_NAME) &&
@@ -662,6 +689,9 @@ struct Object FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int KeyCompareWithValue(const char *val) const {
     return strcmp(name()->c_str(), val);
   }
+  const flatbuffers::String *GetKey() const {
+    return name();
+  }
   const flatbuffers::Vector<flatbuffers::Offset<Field>> *fields() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Field>> *>(VT_FIELDS);
   }
@@ -680,6 +710,9 @@ struct Object FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *documentation() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_DOCUMENTATION);
   }
+  flatbuffers::FieldPresence<7> PresenceMask() const {
+    return flatbuffers::FieldPresence<7>(this);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffsetRequired(verifier, VT_NAME) &&
@@ -795,6 +828,9 @@ struct RPCCall FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int KeyCompareWithValue(const char *val) const {
     return strcmp(name()->c_str(), val);
   }
+  const flatbuffers::String *GetKey() const {
+    return name();
+  }
   const Object *request() const {
     return GetPointer<const Object *>(VT_REQUEST);
   }
@@ -807,6 +843,9 @@ struct RPCCall FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *documentation() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_DOCUMENTATION);
   }
+  flatbuffers::FieldPresence<5> PresenceMask() const {
+    return flatbuffers::FieldPresence<5>(this);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffsetRequired(verifier, VT_NAME) &&
@@ -906,6 +945,9 @@ struct Service FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int KeyCompareWithValue(const char *val) const {
     return strcmp(name()->c_str(), val);
   }
+  const flatbuffers::String *GetKey() const {
+    return name();
+  }
   const flatbuffers::Vector<flatbuffers::Offset<RPCCall>> *calls() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<RPCCall>> *>(VT_CALLS);
   }
@@ -915,6 +957,9 @@ struct Service FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *documentation() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_DOCUMENTATION);
   }
+  flatbuffers::FieldPresence<4> PresenceMask() const {
+    return flatbuffers::FieldPresence<4>(this);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffsetRequired(verifier, VT_NAME) &&
@@ -1015,6 +1060,9 @@ struct Schema FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<flatbuffers::Offset<Service>> *services() const {
     return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Service>> *>(VT_SERVICES);
   }
+  flatbuffers::FieldPresence<6> PresenceMask() const {
+    return flatbuffers::FieldPresence<6>(this);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffsetRequired(verifier, VT_OBJECTS) &&
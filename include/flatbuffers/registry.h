@@ -29,6 +29,7 @@ class Registry {
  public:
   // Call this for all schemas that may be in use. The identifier has
   // a function in the generated code, e.g. MonsterIdentifier().
+  // Schemas may be text (.fbs) or binary (.bfbs, which load faster).
   void Register(const char *file_identifier, const char *schema_path) {
     Schema schema;
     schema.path_ = schema_path;
@@ -58,6 +59,17 @@ class Registry {
     return true;
   }
 
+  // Same as above, for a binary file, which is mapped into memory rather than
+  // loaded.
+  bool FlatBufferFileToText(const char *filename, std::string *dest) {
+    MappedFile file;
+    if (!file.Map(filename, MappedFile::kAccessRandom)) {
+      lasterror_ = "could not load file: " + std::string(filename);
+      return false;
+    }
+    return FlatBufferToText(file.data(), file.size(), dest);
+  }
+
   // Converts a binary buffer to text using one of the schemas in the registry,
   // use the file_identifier to indicate which.
   // If DetachedBuffer::data() is null then parsing failed.
@@ -96,15 +108,19 @@ class Registry {
     }
     auto &schema = it->second;
     // Load the schema from disk. If not, exit.
+    auto binary = GetExtension(schema.path_) == reflection::SchemaExtension();
     std::string schematext;
-    if (!LoadFile(schema.path_.c_str(), false, &schematext)) {
+    if (!LoadFile(schema.path_.c_str(), binary, &schematext)) {
       lasterror_ = "could not load schema: " + schema.path_;
       return false;
     }
-    // Parse schema.
+    // Parse schema, or for a binary schema, just deserialize it.
     parser->opts = opts_;
-    if (!parser->Parse(schematext.c_str(), vector_data(include_paths_),
-                       schema.path_.c_str())) {
+    if (binary ? !parser->Deserialize(
+                     reinterpret_cast<const uint8_t *>(schematext.data()),
+                     schematext.size())
+               : !parser->Parse(schematext.c_str(), vector_data(include_paths_),
+                                schema.path_.c_str())) {
       lasterror_ = parser->error_;
       return false;
     }
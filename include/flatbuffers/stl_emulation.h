@@ -139,6 +139,15 @@ inline void vector_emplace_back(std::vector<T> *vector, V &&data) {
     template <typename T> using is_floating_point = std::is_floating_point<T>;
     template <typename T> using is_unsigned = std::is_unsigned<T>;
     template <typename T> using make_unsigned = std::make_unsigned<T>;
+    template <typename T> using is_integral = std::is_integral<T>;
+    template <typename T> using is_arithmetic = std::is_arithmetic<T>;
+    template <typename T> using is_enum = std::is_enum<T>;
+    template <typename T> using is_pointer = std::is_pointer<T>;
+    template <typename T> using remove_pointer = std::remove_pointer<T>;
+    template <bool B, typename T, typename F>
+    using conditional = std::conditional<B, T, F>;
+    typedef std::true_type true_type;
+    typedef std::false_type false_type;
   #else
     // Map C++ TR1 templates defined by stlport.
     template <typename T> using is_scalar = std::tr1::is_scalar<T>;
@@ -153,6 +162,20 @@ inline void vector_emplace_back(std::vector<T> *vector, V &&data) {
     };
     template<> struct make_unsigned<char> { using type = unsigned char; };
     template<> struct make_unsigned<int>  { using type = unsigned int;  };
+    template <typename T> using is_integral = std::tr1::is_integral<T>;
+    template <typename T> using is_arithmetic = std::tr1::is_arithmetic<T>;
+    template <typename T> using is_enum = std::tr1::is_enum<T>;
+    template <typename T> using is_pointer = std::tr1::is_pointer<T>;
+    template <typename T> using remove_pointer = std::tr1::remove_pointer<T>;
+    // TR1 has no std::tr1::conditional.
+    template<bool B, typename T, typename F> struct conditional {
+      using type = T;
+    };
+    template<typename T, typename F> struct conditional<false, T, F> {
+      using type = F;
+    };
+    typedef std::tr1::true_type true_type;
+    typedef std::tr1::false_type false_type;
   #endif  // !FLATBUFFERS_CPP98_STL
 #else
   // MSVC 2010 doesn't support C++11 aliases.
@@ -162,6 +185,16 @@ inline void vector_emplace_back(std::vector<T> *vector, V &&data) {
         public std::is_floating_point<T> {};
   template <typename T> struct is_unsigned : public std::is_unsigned<T> {};
   template <typename T> struct make_unsigned : public std::make_unsigned<T> {};
+  template <typename T> struct is_integral : public std::is_integral<T> {};
+  template <typename T> struct is_arithmetic : public std::is_arithmetic<T> {};
+  template <typename T> struct is_enum : public std::is_enum<T> {};
+  template <typename T> struct is_pointer : public std::is_pointer<T> {};
+  template <typename T> struct remove_pointer :
+        public std::remove_pointer<T> {};
+  template <bool B, typename T, typename F> struct conditional :
+        public std::conditional<B, T, F> {};
+  typedef std::true_type true_type;
+  typedef std::false_type false_type;
 #endif  // defined(FLATBUFFERS_TEMPLATES_ALIASES)
 
 #ifndef FLATBUFFERS_CPP98_STL
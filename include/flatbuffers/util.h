@@ -47,6 +47,7 @@
 #include <sys/types.h>
 
 #include "flatbuffers/base.h"
+#include "flatbuffers/float_conversion.h"
 
 namespace flatbuffers {
 
@@ -131,7 +132,8 @@ template<typename T> std::string NumToStringImplWrapper(T t, const char* fmt,
 
 // Convert an integer or floating point value to a string.
 // In contrast to std::stringstream, "char" values are
-// converted to a string of digits, and we don't use scientific notation.
+// converted to a string of digits, and floating point values only use
+// scientific notation at extreme magnitudes.
 template<typename T> std::string NumToString(T t) {
   // clang-format off
   #ifndef FLATBUFFERS_PREFER_PRINTF
@@ -144,27 +146,54 @@ template<typename T> std::string NumToString(T t) {
   #endif // FLATBUFFERS_PREFER_PRINTF
   // clang-format on
 }
+
+// Integers are formatted directly, independent of the locale.
+inline std::string SignedToString(int64_t t) {
+  char buf[24];
+  auto end = buf + sizeof(buf);
+  auto magnitude = static_cast<uint64_t>(t);
+  if (t < 0) magnitude = 0 - magnitude;
+  auto p = float_conversion::FormatDecimal(magnitude, end);
+  if (t < 0) *--p = '-';
+  return std::string(p, end);
+}
+inline std::string UnsignedToString(uint64_t t) {
+  char buf[24];
+  auto end = buf + sizeof(buf);
+  return std::string(float_conversion::FormatDecimal(t, end), end);
+}
 // Avoid char types used as character data.
 template<> inline std::string NumToString<signed char>(signed char t) {
-  return NumToString(static_cast<int>(t));
+  return SignedToString(t);
 }
 template<> inline std::string NumToString<unsigned char>(unsigned char t) {
-  return NumToString(static_cast<int>(t));
+  return UnsignedToString(t);
+}
+template<> inline std::string NumToString<short>(short t) {
+  return SignedToString(t);
+}
+template<> inline std::string NumToString<unsigned short>(unsigned short t) {
+  return UnsignedToString(t);
+}
+template<> inline std::string NumToString<int>(int t) {
+  return SignedToString(t);
+}
+template<> inline std::string NumToString<unsigned int>(unsigned int t) {
+  return UnsignedToString(t);
+}
+template<> inline std::string NumToString<long>(long t) {
+  return SignedToString(t);
+}
+template<> inline std::string NumToString<unsigned long>(unsigned long t) {
+  return UnsignedToString(t);
 }
-#if defined(FLATBUFFERS_CPP98_STL)
 template<> inline std::string NumToString<long long>(long long t) {
-  char buf[21];  // (log((1 << 63) - 1) / log(10)) + 2
-  snprintf(buf, sizeof(buf), "%lld", t);
-  return std::string(buf);
+  return SignedToString(t);
 }
-
 template<>
 inline std::string NumToString<unsigned long long>(unsigned long long t) {
-  char buf[22];  // (log((1 << 63) - 1) / log(10)) + 1
-  snprintf(buf, sizeof(buf), "%llu", t);
-  return std::string(buf);
+  return UnsignedToString(t);
 }
-#endif  // defined(FLATBUFFERS_CPP98_STL)
 
 // Special versions for floats/doubles.
 template<typename T> std::string FloatToString(T t, int precision) {
@@ -193,11 +222,15 @@ template<typename T> std::string FloatToString(T t, int precision) {
   return s;
 }
 
+// Floats and doubles use the shortest string that reads back as the same
+// value, see FloatToShortestString.
 template<> inline std::string NumToString<double>(double t) {
-  return FloatToString(t, 12);
+  char buf[kMaxShortestFloatLength];
+  return std::string(buf, static_cast<size_t>(FloatToShortestString(t, buf)));
 }
 template<> inline std::string NumToString<float>(float t) {
-  return FloatToString(t, 6);
+  char buf[kMaxShortestFloatLength];
+  return std::string(buf, static_cast<size_t>(FloatToShortestString(t, buf)));
 }
 
 // Convert an integer value to a hexadecimal string.
@@ -361,8 +394,10 @@ template<> inline bool StringToNumber<uint64_t>(const char *s, uint64_t *val) {
   return (s != end) && (*end == '\0');
 }
 
+// Plain decimal numbers are converted without strtod, see FastStringToFloat.
 template<> inline bool StringToNumber<double>(const char *s, double *val) {
   FLATBUFFERS_ASSERT(s && val);
+  if (FastStringToFloat(s, val)) return true;
   char *end = nullptr;
   *val = strtod_impl(s, &end);
   auto done = (s != end) && (*end == '\0');
@@ -372,6 +407,7 @@ template<> inline bool StringToNumber<double>(const char *s, double *val) {
 
 template<> inline bool StringToNumber<float>(const char *s, float *val) {
   FLATBUFFERS_ASSERT(s && val);
+  if (FastStringToFloat(s, val)) return true;
   char *end = nullptr;
   *val = strtof_impl(s, &end);
   auto done = (s != end) && (*end == '\0');
@@ -427,6 +463,52 @@ inline bool SaveFile(const char *name, const std::string &buf, bool binary) {
   return SaveFile(name, buf.c_str(), buf.size(), binary);
 }
 
+// Read-only view of the contents of a file, which is memory mapped where the
+// platform supports it, rather than read into a heap allocated copy like
+// LoadFile does. Pages are brought in by the OS as they are accessed, so
+// e.g. a large binary FlatBuffer can be used with GetRoot<T>(data()) right
+// away, and only the parts that are actually read (or verified, by passing
+// data() and size() to a Verifier) will ever be loaded.
+// The data of a successfully mapped file is aligned to at least a page.
+// If a custom LoadFileFunction was set, or memory mapping is not available,
+// the file is loaded with LoadFile instead.
+class MappedFile {
+ public:
+  // Hints on how the data will be accessed, which may be combined.
+  enum AccessHint {
+    kAccessNormal = 0,
+    kAccessSequential = 1 << 0,  // Read ahead aggressively.
+    kAccessRandom = 1 << 1,      // Don't read ahead.
+    kAccessWillNeed = 1 << 2,    // Start loading the whole file now.
+    kAccessHugePages = 1 << 3    // Back the mapping with huge pages.
+  };
+
+  MappedFile() : data_(nullptr), size_(0), mapping_(nullptr) {}
+  ~MappedFile() { Unmap(); }
+
+  // Maps file "name" (unmapping any previous file), returning true if
+  // successful, false otherwise. "hints" is a combination of AccessHint
+  // values.
+  bool Map(const char *name, int hints = kAccessNormal);
+  void Unmap();
+
+  const uint8_t *data() const { return data_; }
+  size_t size() const { return size_; }
+
+  // Whether the data is mapped, as opposed to loaded into memory.
+  bool mapped() const { return mapping_ != nullptr; }
+
+ private:
+  // This class owns the mapping, so can't be copied.
+  MappedFile(const MappedFile &);
+  MappedFile &operator=(const MappedFile &);
+
+  const uint8_t *data_;
+  size_t size_;
+  void *mapping_;
+  std::string loaded_;
+};
+
 // Functionality for minimalistic portable path handling.
 
 // The functions below behave correctly regardless of whether posix ('/') or
@@ -5,6 +5,7 @@
 #define FLATBUFFERS_GENERATED_MONSTER_MYGAME_SAMPLE_H_
 
 #include "flatbuffers/flatbuffers.h"
+#include "flatbuffers/hash.h"
 
 namespace MyGame {
 namespace Sample {
@@ -127,7 +128,10 @@ struct EquipmentUnion {
 #endif  // FLATBUFFERS_CPP98_STL
 
   static void *UnPack(const void *obj, Equipment type, const flatbuffers::resolver_function_t *resolver);
+  void UnPackTo(const void *obj, Equipment _type, const flatbuffers::resolver_function_t *resolver);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
+  size_t GetPackedSizeUpperBound() const;
+  size_t Hash() const;
 
   WeaponT *AsWeapon() {
     return type == Equipment_Weapon ?
@@ -157,6 +161,8 @@ inline bool operator==(const EquipmentUnion &lhs, const EquipmentUnion &rhs) {
 }
 bool VerifyEquipment(flatbuffers::Verifier &verifier, const void *obj, Equipment type);
 bool VerifyEquipmentVector(flatbuffers::Verifier &verifier, const flatbuffers::Vector<flatbuffers::Offset<void>> *values, const flatbuffers::Vector<uint8_t> *types);
+size_t HashEquipment(const void *obj, Equipment type);
+bool EqualsEquipment(const void *a, const void *b, Equipment type);
 
 FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) Vec3 FLATBUFFERS_FINAL_CLASS {
  private:
@@ -211,6 +217,7 @@ struct MonsterT : public flatbuffers::NativeTable {
   Color color;
   std::vector<flatbuffers::unique_ptr<WeaponT>> weapons;
   EquipmentUnion equipped;
+  size_t Hash() const;
   MonsterT()
       : mana(150),
         hp(100),
@@ -304,6 +311,9 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   void *mutable_equipped() {
     return GetPointer<void *>(VT_EQUIPPED);
   }
+  flatbuffers::FieldPresence<10> PresenceMask() const {
+    return flatbuffers::FieldPresence<10>(this);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<Vec3>(verifier, VT_POS) &&
@@ -322,9 +332,12 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyEquipment(verifier, equipped(), equipped_type()) &&
            verifier.EndTable();
   }
+  size_t Hash() const;
+  bool Equals(const Monster &_o) const;
   MonsterT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(MonsterT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static flatbuffers::Offset<Monster> Pack(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  static flatbuffers::Offset<Monster> Pack(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT &_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
 template<> inline const Weapon *Monster::equipped_as<Weapon>() const {
@@ -421,12 +434,52 @@ inline flatbuffers::Offset<Monster> CreateMonsterDirect(
       equipped);
 }
 
+class MonsterBufferTemplate : public flatbuffers::BufferTemplate {
+ public:
+  MonsterBufferTemplate(const uint8_t *buf, size_t size)
+      : flatbuffers::BufferTemplate(buf, size) {
+    auto root = flatbuffers::GetRoot<Monster>(data());
+    pos_ = FieldPosition(root, Monster::VT_POS);
+    mana_ = FieldPosition(root, Monster::VT_MANA);
+    hp_ = FieldPosition(root, Monster::VT_HP);
+    color_ = FieldPosition(root, Monster::VT_COLOR);
+  }
+  bool mutate_pos(uint8_t *buf, const Vec3 &_pos) const {
+    if (!pos_) return false;
+    memcpy(buf + pos_, &_pos, sizeof(_pos));
+    return true;
+  }
+  bool mutate_mana(uint8_t *buf, int16_t _mana) const {
+    if (!mana_) return false;
+    flatbuffers::WriteScalar<int16_t>(buf + mana_, _mana);
+    return true;
+  }
+  bool mutate_hp(uint8_t *buf, int16_t _hp) const {
+    if (!hp_) return false;
+    flatbuffers::WriteScalar<int16_t>(buf + hp_, _hp);
+    return true;
+  }
+  bool mutate_color(uint8_t *buf, Color _color) const {
+    if (!color_) return false;
+    flatbuffers::WriteScalar<int8_t>(buf + color_, static_cast<int8_t>(_color));
+    return true;
+  }
+
+ private:
+  flatbuffers::uoffset_t pos_;
+  flatbuffers::uoffset_t mana_;
+  flatbuffers::uoffset_t hp_;
+  flatbuffers::uoffset_t color_;
+};
+
 flatbuffers::Offset<Monster> CreateMonster(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const MonsterT &_o);
 
 struct WeaponT : public flatbuffers::NativeTable {
   typedef Weapon TableType;
   std::string name;
   int16_t damage;
+  size_t Hash() const;
   WeaponT()
       : damage(0) {
   }
@@ -459,6 +512,9 @@ struct Weapon FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   bool mutate_damage(int16_t _damage) {
     return SetField<int16_t>(VT_DAMAGE, _damage, 0);
   }
+  flatbuffers::FieldPresence<2> PresenceMask() const {
+    return flatbuffers::FieldPresence<2>(this);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_NAME) &&
@@ -466,9 +522,12 @@ struct Weapon FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyField<int16_t>(verifier, VT_DAMAGE) &&
            verifier.EndTable();
   }
+  size_t Hash() const;
+  bool Equals(const Weapon &_o) const;
   WeaponT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(WeaponT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static flatbuffers::Offset<Weapon> Pack(flatbuffers::FlatBufferBuilder &_fbb, const WeaponT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  static flatbuffers::Offset<Weapon> Pack(flatbuffers::FlatBufferBuilder &_fbb, const WeaponT &_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
 struct WeaponBuilder {
@@ -512,7 +571,25 @@ inline flatbuffers::Offset<Weapon> CreateWeaponDirect(
       damage);
 }
 
+class WeaponBufferTemplate : public flatbuffers::BufferTemplate {
+ public:
+  WeaponBufferTemplate(const uint8_t *buf, size_t size)
+      : flatbuffers::BufferTemplate(buf, size) {
+    auto root = flatbuffers::GetRoot<Weapon>(data());
+    damage_ = FieldPosition(root, Weapon::VT_DAMAGE);
+  }
+  bool mutate_damage(uint8_t *buf, int16_t _damage) const {
+    if (!damage_) return false;
+    flatbuffers::WriteScalar<int16_t>(buf + damage_, _damage);
+    return true;
+  }
+
+ private:
+  flatbuffers::uoffset_t damage_;
+};
+
 flatbuffers::Offset<Weapon> CreateWeapon(flatbuffers::FlatBufferBuilder &_fbb, const WeaponT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const WeaponT &_o);
 
 inline MonsterT *Monster::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
   auto _o = new MonsterT();
@@ -523,21 +600,25 @@ inline MonsterT *Monster::UnPack(const flatbuffers::resolver_function_t *_resolv
 inline void Monster::UnPackTo(MonsterT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = pos(); if (_e) _o->pos = flatbuffers::unique_ptr<Vec3>(new Vec3(*_e)); };
+  { auto _e = pos(); if (_e) { if (_o->pos) { *_o->pos = *_e; } else { _o->pos = flatbuffers::unique_ptr<Vec3>(new Vec3(*_e)); } } else { _o->pos.reset(); } };
   { auto _e = mana(); _o->mana = _e; };
   { auto _e = hp(); _o->hp = _e; };
-  { auto _e = name(); if (_e) _o->name = _e->str(); };
-  { auto _e = inventory(); if (_e) { _o->inventory.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->inventory[_i] = _e->Get(_i); } } };
+  { auto _e = name(); if (_e) { _o->name.assign(_e->c_str(), _e->size()); } else { _o->name.clear(); } };
+  { auto _e = inventory(); if (_e) { flatbuffers::UnPackVector(*_e, &_o->inventory); } else { _o->inventory.clear(); } };
   { auto _e = color(); _o->color = _e; };
-  { auto _e = weapons(); if (_e) { _o->weapons.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->weapons[_i] = flatbuffers::unique_ptr<WeaponT>(_e->Get(_i)->UnPack(_resolver)); } } };
-  { auto _e = equipped_type(); _o->equipped.type = _e; };
-  { auto _e = equipped(); if (_e) _o->equipped.value = EquipmentUnion::UnPack(_e, equipped_type(), _resolver); };
+  { auto _e = weapons(); if (_e) { _o->weapons.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if (_o->weapons[_i]) { _e->Get(_i)->UnPackTo(_o->weapons[_i].get(), _resolver); } else { _o->weapons[_i] = flatbuffers::unique_ptr<WeaponT>(_e->Get(_i)->UnPack(_resolver)); } } } else { _o->weapons.clear(); } };
+  { auto _e = equipped(); if (_e) { _o->equipped.UnPackTo(_e, equipped_type(), _resolver); } else { _o->equipped.Reset(); } };
 }
 
 inline flatbuffers::Offset<Monster> Monster::Pack(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
   return CreateMonster(_fbb, _o, _rehasher);
 }
 
+inline flatbuffers::Offset<Monster> Monster::Pack(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT &_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(_o));
+  return CreateMonster(_fbb, &_o, _rehasher);
+}
+
 inline flatbuffers::Offset<Monster> CreateMonster(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
@@ -564,6 +645,57 @@ inline flatbuffers::Offset<Monster> CreateMonster(flatbuffers::FlatBufferBuilder
       _equipped);
 }
 
+inline size_t GetPackedSizeUpperBound(const MonsterT &_o) {
+  (void)_o;
+  size_t _size = 191;
+  _size += _o.name.length();
+  _size += _o.inventory.size() * 1;
+  _size += _o.weapons.size() * 4;
+  for (size_t _i = 0; _i < _o.weapons.size(); _i++) {
+    _size += GetPackedSizeUpperBound(*_o.weapons[_i]);
+  }
+  _size += _o.equipped.GetPackedSizeUpperBound();
+  return _size;
+}
+
+inline size_t Monster::Hash() const {
+  uint64_t _h = 0;
+  { auto _e = pos(); if (_e) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, VT_POS), _e, sizeof(*_e)); }
+  { auto _e = GetField<int16_t>(VT_MANA, 150); if (_e != 150) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_MANA), _e); }
+  { auto _e = GetField<int16_t>(VT_HP, 100); if (_e != 100) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_HP), _e); }
+  { auto _e = name(); if (_e && _e->size()) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, VT_NAME), _e->c_str(), _e->size()); }
+  { auto _e = inventory(); if (_e && _e->size()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, VT_INVENTORY), *_e); }
+  { auto _e = GetField<int8_t>(VT_COLOR, 2); if (_e != 2) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_COLOR), _e); }
+  { auto _e = weapons(); if (_e && _e->size()) _h = flatbuffers::HashTables(flatbuffers::HashCombine(_h, VT_WEAPONS), *_e); }
+  { auto _t = equipped_type(); if (_t != Equipment_NONE) _h = flatbuffers::HashCombine(flatbuffers::HashCombine(flatbuffers::HashCombine(_h, VT_EQUIPPED), static_cast<uint64_t>(_t)), HashEquipment(equipped(), _t)); }
+  return static_cast<size_t>(_h);
+}
+
+inline size_t MonsterT::Hash() const {
+  uint64_t _h = 0;
+  { auto _e = pos.get(); if (_e) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, Monster::VT_POS), _e, sizeof(*_e)); }
+  { auto _e = mana; if (_e != 150) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, Monster::VT_MANA), _e); }
+  { auto _e = hp; if (_e != 100) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, Monster::VT_HP), _e); }
+  { auto &_e = name; if (_e.length()) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, Monster::VT_NAME), _e.c_str(), _e.length()); }
+  { auto &_e = inventory; if (!_e.empty()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, Monster::VT_INVENTORY), _e); }
+  { auto _e = static_cast<int8_t>(color); if (_e != 2) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, Monster::VT_COLOR), _e); }
+  { auto &_e = weapons; if (!_e.empty()) _h = flatbuffers::HashTables(flatbuffers::HashCombine(_h, Monster::VT_WEAPONS), _e); }
+  if (equipped.type != Equipment_NONE) _h = flatbuffers::HashCombine(flatbuffers::HashCombine(flatbuffers::HashCombine(_h, Monster::VT_EQUIPPED), static_cast<uint64_t>(equipped.type)), equipped.Hash());
+  return static_cast<size_t>(_h);
+}
+
+inline bool Monster::Equals(const Monster &_o) const {
+  return flatbuffers::StructEquals(pos(), _o.pos()) &&
+         flatbuffers::ScalarEquals(GetField<int16_t>(VT_MANA, 150), _o.GetField<int16_t>(VT_MANA, 150)) &&
+         flatbuffers::ScalarEquals(GetField<int16_t>(VT_HP, 100), _o.GetField<int16_t>(VT_HP, 100)) &&
+         flatbuffers::StringEquals(name(), _o.name()) &&
+         flatbuffers::VectorEquals(inventory(), _o.inventory()) &&
+         flatbuffers::ScalarEquals(GetField<int8_t>(VT_COLOR, 2), _o.GetField<int8_t>(VT_COLOR, 2)) &&
+         flatbuffers::VectorEquals(weapons(), _o.weapons()) &&
+         equipped_type() == _o.equipped_type() &&
+         EqualsEquipment(equipped(), _o.equipped(), equipped_type());
+}
+
 inline WeaponT *Weapon::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
   auto _o = new WeaponT();
   UnPackTo(_o, _resolver);
@@ -573,7 +705,7 @@ inline WeaponT *Weapon::UnPack(const flatbuffers::resolver_function_t *_resolver
 inline void Weapon::UnPackTo(WeaponT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = name(); if (_e) _o->name = _e->str(); };
+  { auto _e = name(); if (_e) { _o->name.assign(_e->c_str(), _e->size()); } else { _o->name.clear(); } };
   { auto _e = damage(); _o->damage = _e; };
 }
 
@@ -581,6 +713,11 @@ inline flatbuffers::Offset<Weapon> Weapon::Pack(flatbuffers::FlatBufferBuilder &
   return CreateWeapon(_fbb, _o, _rehasher);
 }
 
+inline flatbuffers::Offset<Weapon> Weapon::Pack(flatbuffers::FlatBufferBuilder &_fbb, const WeaponT &_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(_o));
+  return CreateWeapon(_fbb, &_o, _rehasher);
+}
+
 inline flatbuffers::Offset<Weapon> CreateWeapon(flatbuffers::FlatBufferBuilder &_fbb, const WeaponT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
@@ -593,6 +730,32 @@ inline flatbuffers::Offset<Weapon> CreateWeapon(flatbuffers::FlatBufferBuilder &
       _damage);
 }
 
+inline size_t GetPackedSizeUpperBound(const WeaponT &_o) {
+  (void)_o;
+  size_t _size = 53;
+  _size += _o.name.length();
+  return _size;
+}
+
+inline size_t Weapon::Hash() const {
+  uint64_t _h = 0;
+  { auto _e = name(); if (_e && _e->size()) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, VT_NAME), _e->c_str(), _e->size()); }
+  { auto _e = GetField<int16_t>(VT_DAMAGE, 0); if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_DAMAGE), _e); }
+  return static_cast<size_t>(_h);
+}
+
+inline size_t WeaponT::Hash() const {
+  uint64_t _h = 0;
+  { auto &_e = name; if (_e.length()) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, Weapon::VT_NAME), _e.c_str(), _e.length()); }
+  { auto _e = damage; if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, Weapon::VT_DAMAGE), _e); }
+  return static_cast<size_t>(_h);
+}
+
+inline bool Weapon::Equals(const Weapon &_o) const {
+  return flatbuffers::StringEquals(name(), _o.name()) &&
+         flatbuffers::ScalarEquals(GetField<int16_t>(VT_DAMAGE, 0), _o.GetField<int16_t>(VT_DAMAGE, 0));
+}
+
 inline bool VerifyEquipment(flatbuffers::Verifier &verifier, const void *obj, Equipment type) {
   switch (type) {
     case Equipment_NONE: {
@@ -618,6 +781,28 @@ inline bool VerifyEquipmentVector(flatbuffers::Verifier &verifier, const flatbuf
   return true;
 }
 
+inline size_t HashEquipment(const void *obj, Equipment type) {
+  if (!obj) return 0;
+  switch (type) {
+    case Equipment_Weapon: {
+      auto ptr = reinterpret_cast<const Weapon *>(obj);
+      return ptr->Hash();
+    }
+    default: return 0;
+  }
+}
+
+inline bool EqualsEquipment(const void *a, const void *b, Equipment type) {
+  if (!a || !b) return a == b;
+  switch (type) {
+    case Equipment_Weapon: {
+      return reinterpret_cast<const Weapon *>(a)
+          ->Equals(*reinterpret_cast<const Weapon *>(b));
+    }
+    default: return true;
+  }
+}
+
 inline void *EquipmentUnion::UnPack(const void *obj, Equipment type, const flatbuffers::resolver_function_t *resolver) {
   switch (type) {
     case Equipment_Weapon: {
@@ -628,6 +813,22 @@ inline void *EquipmentUnion::UnPack(const void *obj, Equipment type, const flatb
   }
 }
 
+inline void EquipmentUnion::UnPackTo(const void *obj, Equipment _type, const flatbuffers::resolver_function_t *resolver) {
+  if (value && type == _type) {
+    switch (type) {
+      case Equipment_Weapon: {
+        auto ptr = reinterpret_cast<const Weapon *>(obj);
+        ptr->UnPackTo(reinterpret_cast<WeaponT *>(value), resolver);
+        return;
+      }
+      default: break;
+    }
+  }
+  Reset();
+  type = _type;
+  value = UnPack(obj, _type, resolver);
+}
+
 inline flatbuffers::Offset<void> EquipmentUnion::Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher) const {
   switch (type) {
     case Equipment_Weapon: {
@@ -638,6 +839,27 @@ inline flatbuffers::Offset<void> EquipmentUnion::Pack(flatbuffers::FlatBufferBui
   }
 }
 
+inline size_t EquipmentUnion::GetPackedSizeUpperBound() const {
+  switch (type) {
+    case Equipment_Weapon: {
+      auto ptr = reinterpret_cast<const WeaponT *>(value);
+      return ::MyGame::Sample::GetPackedSizeUpperBound(*ptr);
+    }
+    default: return 0;
+  }
+}
+
+inline size_t EquipmentUnion::Hash() const {
+  if (!value) return 0;
+  switch (type) {
+    case Equipment_Weapon: {
+      auto ptr = reinterpret_cast<const WeaponT *>(value);
+      return ptr->Hash();
+    }
+    default: return 0;
+  }
+}
+
 inline EquipmentUnion::EquipmentUnion(const EquipmentUnion &u) FLATBUFFERS_NOEXCEPT : type(u.type), value(nullptr) {
   switch (type) {
     case Equipment_Weapon: {
@@ -813,4 +1035,20 @@ inline flatbuffers::unique_ptr<MonsterT> UnPackMonster(
 }  // namespace Sample
 }  // namespace MyGame
 
+namespace std {
+
+template<> struct hash<MyGame::Sample::MonsterT> {
+  size_t operator()(const MyGame::Sample::MonsterT &_o) const {
+    return _o.Hash();
+  }
+};
+
+template<> struct hash<MyGame::Sample::WeaponT> {
+  size_t operator()(const MyGame::Sample::WeaponT &_o) const {
+    return _o.Hash();
+  }
+};
+
+}  // namespace std
+
 #endif  // FLATBUFFERS_GENERATED_MONSTER_MYGAME_SAMPLE_H_
@@ -18,6 +18,8 @@
 
 #include <list>
 
+#include "flatbuffers/record_stream.h"
+
 #define FLATC_VERSION "1.10.0 (" __DATE__ " " __TIME__ ")"
 
 namespace flatbuffers {
@@ -91,9 +93,20 @@ std::string FlatCompiler::GetUsageString(const char *program_name) const {
     "  --gen-name-strings Generate type name functions for C++.\n"
     "  --gen-object-api   Generate an additional object-based API.\n"
     "  --gen-compare      Generate operator== for object-based API types.\n"
+    "  --gen-hash         Generate Hash() and Equals() for tables, and\n"
+    "                     std::hash for object-based API types.\n"
+    "  --gen-templates    Generate XBufferTemplate types, which patch copies\n"
+    "                     of a prototype buffer of table X in place.\n"
     "  --cpp-ptr-type T   Set object API pointer type (default std::unique_ptr)\n"
     "  --cpp-str-type T   Set object API string type (default std::string)\n"
     "                     T::c_str() and T::length() must be supported\n"
+    "  --cpp-arena        Allocate object API tables, vectors and strings with\n"
+    "                     flatbuffers::ArenaAllocator (see flatbuffers/arena.h).\n"
+    "                     Strings default to flatbuffers::ArenaString, and are\n"
+    "                     constructed from a pointer and length.\n"
+    "  --cpp-views        Make object API strings flatbuffers::StringView and\n"
+    "                     vectors of scalars flatbuffers::VectorView, which\n"
+    "                     refer to the unpacked buffer instead of copying it.\n"
     "  --gen-nullable     Add Clang _Nullable for C++ pointer. or @Nullable for Java\n"
     "  --gen-generated    Add @Generated annotation for Java\n"
     "  --object-prefix    Customise class prefix for C++ object-based API.\n"
@@ -108,6 +121,10 @@ std::string FlatCompiler::GetUsageString(const char *program_name) const {
     "  --raw-binary       Allow binaries without file_indentifier to be read.\n"
     "                     This may crash flatc given a mismatched schema.\n"
     "  --size-prefixed    Input binaries are size prefixed buffers.\n"
+    "  --ndjson           JSON files contain one object per line, each converted\n"
+    "                     to a size prefixed buffer in a record stream (with -b).\n"
+    "  --threads N        Number of threads used with --ndjson, and to print large\n"
+    "                     vectors of tables with --json (default: all cores).\n"
     "  --proto            Input is a .proto, translate to .fbs.\n"
     "  --oneof-union      Translate .proto oneofs to flatbuffer unions.\n"
     "  --grpc             Generate GRPC interfaces for the specified languages\n"
@@ -129,8 +146,9 @@ std::string FlatCompiler::GetUsageString(const char *program_name) const {
     "  --force-defaults   Emit default values in binary output from JSON\n"
     "  --force-empty      When serializing from object API representation,\n"
     "                     force strings and vectors to empty rather than null.\n"
-    "FILEs may be schemas (must end in .fbs), or JSON files (conforming to preceding\n"
-    "schema). FILEs after the -- must be binary flatbuffer format files.\n"
+    "FILEs may be schemas (must end in .fbs, or .bfbs for binary schemas), or JSON\n"
+    "files (conforming to preceding schema). FILEs after the -- must be binary\n"
+    "flatbuffer format files.\n"
     "Output files are named using the base file name of the input,\n"
     "and written to the current directory or the path given by -o.\n"
     "example: " << program_name << " -c -b schema1.fbs schema2.fbs data.json\n";
@@ -180,6 +198,13 @@ int FlatCompiler::Compile(int argc, const char **argv) {
   bool raw_binary = false;
   bool schema_binary = false;
   bool grpc_enabled = false;
+  bool ndjson = false;
+  size_t num_threads = 1;
+  // clang-format off
+  #ifndef FLATBUFFERS_CPP98_STL
+    num_threads = std::max(std::thread::hardware_concurrency(), 1U);
+  #endif
+  // clang-format on
   std::vector<std::string> filenames;
   std::list<std::string> include_directories_storage;
   std::vector<const char *> include_directories;
@@ -259,12 +284,20 @@ int FlatCompiler::Compile(int argc, const char **argv) {
         opts.generate_object_based_api = true;
       } else if (arg == "--gen-compare") {
         opts.gen_compare = true;
+      } else if (arg == "--gen-hash") {
+        opts.gen_hash = true;
+      } else if (arg == "--gen-templates") {
+        opts.gen_buffer_templates = true;
       } else if (arg == "--cpp-ptr-type") {
         if (++argi >= argc) Error("missing type following" + arg, true);
         opts.cpp_object_api_pointer_type = argv[argi];
       } else if (arg == "--cpp-str-type") {
         if (++argi >= argc) Error("missing type following" + arg, true);
         opts.cpp_object_api_string_type = argv[argi];
+      } else if (arg == "--cpp-arena") {
+        opts.cpp_object_api_arena = true;
+      } else if (arg == "--cpp-views") {
+        opts.cpp_object_api_views = true;
       } else if (arg == "--gen-nullable") {
         opts.gen_nullable = true;
       } else if (arg == "--gen-generated") {
@@ -291,6 +324,12 @@ int FlatCompiler::Compile(int argc, const char **argv) {
         raw_binary = true;
       } else if (arg == "--size-prefixed") {
         opts.size_prefixed = true;
+      } else if (arg == "--ndjson") {
+        ndjson = true;
+      } else if (arg == "--threads") {
+        if (++argi >= argc) Error("missing count following: " + arg, true);
+        num_threads = static_cast<size_t>(atoi(argv[argi]));
+        if (!num_threads) Error("invalid thread count: " + arg, true);
       } else if (arg == "--") {  // Separator between text and binary inputs.
         binary_files_from = filenames.size();
       } else if (arg == "--proto") {
@@ -345,6 +384,7 @@ int FlatCompiler::Compile(int argc, const char **argv) {
   }
 
   if (!filenames.size()) Error("missing input files", false, true);
+  opts.num_threads = num_threads;
 
   if (opts.proto_mode) {
     if (any_generator)
@@ -353,6 +393,14 @@ int FlatCompiler::Compile(int argc, const char **argv) {
     Error("no options: specify at least one generator.", true);
   }
 
+  if (ndjson) {
+    for (size_t i = 0; i < params_.num_generators; ++i) {
+      if (generator_enabled[i] &&
+          params_.generators[i].lang != IDLOptions::kBinary)
+        Error("--ndjson can only be used with -b", true);
+    }
+  }
+
   flatbuffers::Parser conform_parser;
   if (!conform_to_schema.empty()) {
     std::string contents;
@@ -367,19 +415,29 @@ int FlatCompiler::Compile(int argc, const char **argv) {
   for (auto file_it = filenames.begin(); file_it != filenames.end();
        ++file_it) {
     auto &filename = *file_it;
-    std::string contents;
-    if (!flatbuffers::LoadFile(filename.c_str(), true, &contents))
-      Error("unable to load file: " + filename);
-
     bool is_binary =
         static_cast<size_t>(file_it - filenames.begin()) >= binary_files_from;
     auto ext = flatbuffers::GetExtension(filename);
-    auto is_schema = ext == "fbs" || ext == "proto";
+    auto is_binary_schema = ext == reflection::SchemaExtension();
+    auto is_schema = ext == "fbs" || ext == "proto" || is_binary_schema;
+    std::string contents;
+    // Binaries are mapped rather than loaded, so converting them to text
+    // doesn't need to copy them.
+    flatbuffers::MappedFile binary;
     if (is_binary) {
+      if (!binary.Map(filename.c_str(), flatbuffers::MappedFile::kAccessRandom))
+        Error("unable to load file: " + filename);
       parser->builder_.Clear();
-      parser->builder_.PushFlatBuffer(
-          reinterpret_cast<const uint8_t *>(contents.c_str()),
-          contents.length());
+      // Text is generated straight from the mapped file, anything else needs
+      // the binary in the builder.
+      for (size_t i = 0; i < params_.num_generators; ++i) {
+        if (generator_enabled[i] &&
+            (params_.generators[i].lang != IDLOptions::kJson ||
+             print_make_rules)) {
+          parser->builder_.PushFlatBuffer(binary.data(), binary.size());
+          break;
+        }
+      }
       if (!raw_binary) {
         // Generally reading binaries that do not correspond to the schema
         // will crash, and sadly there's no way around that when the binary
@@ -392,14 +450,24 @@ int FlatCompiler::Compile(int argc, const char **argv) {
                 "\" matches the schema, use --raw-binary to read this file"
                 " anyway.");
         } else if (!flatbuffers::BufferHasIdentifier(
-                       contents.c_str(), parser->file_identifier_.c_str(), opts.size_prefixed)) {
+                       binary.data(), parser->file_identifier_.c_str(), opts.size_prefixed)) {
           Error("binary \"" + filename +
                 "\" does not have expected file_identifier \"" +
                 parser->file_identifier_ +
                 "\", use --raw-binary to read this file anyway.");
         }
       }
+    } else if (is_binary_schema) {
+      if (!flatbuffers::LoadFile(filename.c_str(), true, &contents))
+        Error("unable to load file: " + filename);
+      parser.reset(new flatbuffers::Parser(opts));
+      if (!parser->Deserialize(
+              reinterpret_cast<const uint8_t *>(contents.data()),
+              contents.size()))
+        Error(filename + ": " + parser->error_, false, false);
     } else {
+      if (!flatbuffers::LoadFile(filename.c_str(), true, &contents))
+        Error("unable to load file: " + filename);
       // Check if file contains 0 bytes.
       if (contents.length() != strlen(contents.c_str())) {
         Error("input file appears to be binary: " + filename, true);
@@ -410,7 +478,20 @@ int FlatCompiler::Compile(int argc, const char **argv) {
         // so explicitly using an include.
         parser.reset(new flatbuffers::Parser(opts));
       }
-      ParseFile(*parser.get(), filename, contents, include_directories);
+      if (ndjson && !is_schema) {
+        // Converted to a record stream, which the binary generator writes
+        // out like any other buffer.
+        RecordStreamWriter writer;
+        std::string error;
+        if (!ParseJsonLines(*parser.get(), contents.c_str(), contents.length(),
+                            num_threads, &writer, &error))
+          Error(filename + ":" + error, false, false);
+        writer.Finish();
+        parser->builder_.Clear();
+        parser->builder_.PushFlatBuffer(writer.data(), writer.size());
+      } else {
+        ParseFile(*parser.get(), filename, contents, include_directories);
+      }
       if (!is_schema && !parser->builder_.GetSize()) {
         // If a file doesn't end in .fbs, it must be json/binary. Ensure we
         // didn't just parse a schema with a different extension.
@@ -439,9 +520,16 @@ int FlatCompiler::Compile(int argc, const char **argv) {
       if (generator_enabled[i]) {
         if (!print_make_rules) {
           flatbuffers::EnsureDirExists(output_path);
-          if ((!params_.generators[i].schema_only || is_schema) &&
-              !params_.generators[i].generate(*parser.get(), output_path,
-                                              filebase)) {
+          bool ok = true;
+          if (is_binary && params_.generators[i].lang == IDLOptions::kJson) {
+            ok = !binary.size() ||
+                 flatbuffers::GenerateTextFile(*parser.get(), binary.data(),
+                                               output_path, filebase);
+          } else if (!params_.generators[i].schema_only || is_schema) {
+            ok = params_.generators[i].generate(*parser.get(), output_path,
+                                                filebase);
+          }
+          if (!ok) {
             Error(std::string("Unable to generate ") +
                   params_.generators[i].lang_name + " for " + filebase);
           }
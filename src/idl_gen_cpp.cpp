@@ -212,6 +212,11 @@ class CppGenerator : public BaseGenerator {
     if (parser_.uses_flexbuffers_) {
       code_ += "#include \"flatbuffers/flexbuffers.h\"";
     }
+    if (parser_.opts.generate_object_based_api &&
+        parser_.opts.cpp_object_api_arena) {
+      code_ += "#include \"flatbuffers/arena.h\"";
+    }
+    if (parser_.opts.gen_hash) { code_ += "#include \"flatbuffers/hash.h\""; }
     code_ += "";
 
     if (parser_.opts.include_dependence_headers) { GenIncludeDependencies(); }
@@ -453,6 +458,28 @@ class CppGenerator : public BaseGenerator {
 
     if (cur_name_space_) SetNameSpace(nullptr);
 
+    // Let native tables be used in unordered containers.
+    if (parser_.opts.generate_object_based_api && parser_.opts.gen_hash) {
+      code_ += "namespace std {";
+      code_ += "";
+      for (auto it = parser_.structs_.vec.begin();
+           it != parser_.structs_.vec.end(); ++it) {
+        const auto &struct_def = **it;
+        if (struct_def.fixed || struct_def.generated) { continue; }
+        code_.SetValue("NATIVE_NAME",
+                       NativeName(WrapInNameSpace(struct_def), &struct_def,
+                                  parser_.opts));
+        code_ += "template<> struct hash<{{NATIVE_NAME}}> {";
+        code_ += "  size_t operator()(const {{NATIVE_NAME}} &_o) const {";
+        code_ += "    return _o.Hash();";
+        code_ += "  }";
+        code_ += "};";
+        code_ += "";
+      }
+      code_ += "}  // namespace std";
+      code_ += "";
+    }
+
     // Close the include guard.
     code_ += "#endif  // " + include_guard;
 
@@ -567,13 +594,56 @@ class CppGenerator : public BaseGenerator {
     return attr ? attr->constant : parser_.opts.cpp_object_api_pointer_type;
   }
 
+  // Whether a pointer field owns what it points to, so UnPackTo can unpack
+  // into that instead of allocating a new object.
+  bool IsUniquePtr(const FieldDef &field) {
+    auto ptr_type = PtrType(&field);
+    if (ptr_type == "default_ptr_type") {
+      ptr_type = parser_.opts.cpp_object_api_pointer_type;
+    }
+    return ptr_type == "std::unique_ptr" ||
+           ptr_type == "flatbuffers::unique_ptr";
+  }
+
+  // Whether a native string can be assigned in place, reusing its capacity.
+  bool IsAssignableString(const FieldDef &field) {
+    const auto type = NativeString(&field);
+    return type == "std::string" || type == "flatbuffers::ArenaString";
+  }
+
   const std::string NativeString(const FieldDef *field) {
     auto attr = field ? field->attributes.Lookup("cpp_str_type") : nullptr;
+    if (!attr && parser_.opts.cpp_object_api_views) {
+      return "flatbuffers::StringView";
+    }
     auto &ret = attr ? attr->constant : parser_.opts.cpp_object_api_string_type;
-    if (ret.empty()) { return "std::string"; }
+    if (ret.empty()) {
+      return parser_.opts.cpp_object_api_arena ? "flatbuffers::ArenaString"
+                                               : "std::string";
+    }
     return ret;
   }
 
+  // The allocator template of a native table and its vectors, if any.
+  std::string NativeAllocator(const StructDef *struct_def) {
+    auto attr = struct_def
+                    ? struct_def->attributes.Lookup("native_custom_alloc")
+                    : nullptr;
+    if (attr) return attr->constant;
+    return parser_.opts.cpp_object_api_arena ? "flatbuffers::ArenaAllocator"
+                                             : "";
+  }
+
+  // Whether a vector field is a flatbuffers::VectorView into the buffer,
+  // which it is for plain scalars with --cpp-views.
+  bool IsVectorView(const FieldDef &field) {
+    const auto &type = field.value.type;
+    return parser_.opts.cpp_object_api_views &&
+           type.base_type == BASE_TYPE_VECTOR && IsScalar(type.element) &&
+           type.element != BASE_TYPE_BOOL && !type.enum_def &&
+           !field.attributes.Lookup("cpp_type");
+  }
+
   std::string GenTypeNativePtr(const std::string &type, const FieldDef *field,
                                bool is_constructor) {
     auto &ptr_type = PtrType(field);
@@ -603,12 +673,13 @@ class CppGenerator : public BaseGenerator {
       }
       case BASE_TYPE_VECTOR: {
         const auto type_name = GenTypeNative(type.VectorType(), true, field);
-        if (type.struct_def &&
-            type.struct_def->attributes.Lookup("native_custom_alloc")) {
-          auto native_custom_alloc =
-              type.struct_def->attributes.Lookup("native_custom_alloc");
-          return "std::vector<" + type_name + "," +
-                 native_custom_alloc->constant + "<" + type_name + ">>";
+        if (IsVectorView(field)) {
+          return "flatbuffers::VectorView<" + type_name + ">";
+        }
+        const auto allocator = NativeAllocator(type.struct_def);
+        if (!allocator.empty()) {
+          return "std::vector<" + type_name + "," + allocator + "<" +
+                 type_name + ">>";
         } else
           return "std::vector<" + type_name + ">";
       }
@@ -703,6 +774,16 @@ class CppGenerator : public BaseGenerator {
            "const flatbuffers::Vector<uint8_t> *types)";
   }
 
+  std::string UnionHashSignature(const EnumDef &enum_def) {
+    return "size_t Hash" + Name(enum_def) + "(const void *obj, " +
+           Name(enum_def) + " type)";
+  }
+
+  std::string UnionEqualsSignature(const EnumDef &enum_def) {
+    return "bool Equals" + Name(enum_def) + "(const void *a, const void *b, " +
+           Name(enum_def) + " type)";
+  }
+
   std::string UnionUnPackSignature(const EnumDef &enum_def, bool inclass) {
     return (inclass ? "static " : "") + std::string("void *") +
            (inclass ? "" : Name(enum_def) + "Union::") +
@@ -710,6 +791,12 @@ class CppGenerator : public BaseGenerator {
            " type, const flatbuffers::resolver_function_t *resolver)";
   }
 
+  std::string UnionUnPackToSignature(const EnumDef &enum_def, bool inclass) {
+    return "void " + (inclass ? "" : Name(enum_def) + "Union::") +
+           "UnPackTo(const void *obj, " + Name(enum_def) +
+           " _type, const flatbuffers::resolver_function_t *resolver)";
+  }
+
   std::string UnionPackSignature(const EnumDef &enum_def, bool inclass) {
     return "flatbuffers::Offset<void> " +
            (inclass ? "" : Name(enum_def) + "Union::") +
@@ -737,6 +824,22 @@ class CppGenerator : public BaseGenerator {
            (inclass ? " = nullptr" : "") + ")";
   }
 
+  std::string TablePackReservedSignature(const StructDef &struct_def,
+                                        bool inclass, const IDLOptions &opts) {
+    return std::string(inclass ? "static " : "") + "flatbuffers::Offset<" +
+           Name(struct_def) + "> " + (inclass ? "" : Name(struct_def) + "::") +
+           "Pack(flatbuffers::FlatBufferBuilder &_fbb, " + "const " +
+           NativeName(Name(struct_def), &struct_def, opts) + " &_o, " +
+           "const flatbuffers::rehasher_function_t *_rehasher" +
+           (inclass ? " = nullptr" : "") + ")";
+  }
+
+  std::string TableSizeBoundSignature(const StructDef &struct_def,
+                                      const IDLOptions &opts) {
+    return "size_t GetPackedSizeUpperBound(const " +
+           NativeName(Name(struct_def), &struct_def, opts) + " &_o)";
+  }
+
   std::string TableUnPackSignature(const StructDef &struct_def, bool inclass,
                                    const IDLOptions &opts) {
     return NativeName(Name(struct_def), &struct_def, opts) + " *" +
@@ -1089,7 +1192,10 @@ class CppGenerator : public BaseGenerator {
         code_ += "";
       }
       code_ += "  " + UnionUnPackSignature(enum_def, true) + ";";
+      code_ += "  " + UnionUnPackToSignature(enum_def, true) + ";";
       code_ += "  " + UnionPackSignature(enum_def, true) + ";";
+      code_ += "  size_t GetPackedSizeUpperBound() const;";
+      if (parser_.opts.gen_hash) { code_ += "  size_t Hash() const;"; }
       code_ += "";
 
       for (auto it = enum_def.vals.vec.begin(); it != enum_def.vals.vec.end();
@@ -1154,10 +1260,120 @@ class CppGenerator : public BaseGenerator {
     if (enum_def.is_union) {
       code_ += UnionVerifySignature(enum_def) + ";";
       code_ += UnionVectorVerifySignature(enum_def) + ";";
+      if (parser_.opts.gen_hash) {
+        code_ += UnionHashSignature(enum_def) + ";";
+        code_ += UnionEqualsSignature(enum_def) + ";";
+      }
       code_ += "";
     }
   }
 
+  // Generate the HashX() and EqualsX() functions of union X, which the Hash()
+  // and Equals() functions of tables call for union fields.
+  void GenUnionHash(const EnumDef &enum_def) {
+    code_ += "inline " + UnionHashSignature(enum_def) + " {";
+    code_ += "  if (!obj) return 0;";
+    code_ += "  switch (type) {";
+    for (auto it = enum_def.vals.vec.begin(); it != enum_def.vals.vec.end();
+         ++it) {
+      const auto &ev = **it;
+      if (!ev.value) { continue; }
+      code_.SetValue("LABEL", GetEnumValUse(enum_def, ev));
+      code_.SetValue("TYPE", GetUnionElement(ev, true, true));
+      code_ += "    case {{LABEL}}: {";
+      code_ += "      auto ptr = reinterpret_cast<const {{TYPE}} *>(obj);";
+      if (ev.union_type.base_type == BASE_TYPE_STRUCT) {
+        if (ev.union_type.struct_def->fixed) {
+          code_ +=
+              "      return static_cast<size_t>("
+              "flatbuffers::HashBytes(0, ptr, sizeof(*ptr)));";
+        } else {
+          code_ += "      return ptr->Hash();";
+        }
+      } else if (ev.union_type.base_type == BASE_TYPE_STRING) {
+        code_ +=
+            "      return static_cast<size_t>("
+            "flatbuffers::HashBytes(0, ptr->c_str(), ptr->size()));";
+      } else {
+        FLATBUFFERS_ASSERT(false);
+      }
+      code_ += "    }";
+    }
+    code_ += "    default: return 0;";
+    code_ += "  }";
+    code_ += "}";
+    code_ += "";
+
+    code_ += "inline " + UnionEqualsSignature(enum_def) + " {";
+    code_ += "  if (!a || !b) return a == b;";
+    code_ += "  switch (type) {";
+    for (auto it = enum_def.vals.vec.begin(); it != enum_def.vals.vec.end();
+         ++it) {
+      const auto &ev = **it;
+      if (!ev.value) { continue; }
+      code_.SetValue("LABEL", GetEnumValUse(enum_def, ev));
+      code_.SetValue("TYPE", GetUnionElement(ev, true, true));
+      code_ += "    case {{LABEL}}: {";
+      if (ev.union_type.base_type == BASE_TYPE_STRUCT) {
+        if (ev.union_type.struct_def->fixed) {
+          code_ += "      return memcmp(a, b, sizeof({{TYPE}})) == 0;";
+        } else {
+          code_ += "      return reinterpret_cast<const {{TYPE}} *>(a)";
+          code_ += "          ->Equals(*reinterpret_cast<const {{TYPE}} *>(b));";
+        }
+      } else if (ev.union_type.base_type == BASE_TYPE_STRING) {
+        code_ += "      return flatbuffers::StringEquals(";
+        code_ += "          reinterpret_cast<const {{TYPE}} *>(a),";
+        code_ += "          reinterpret_cast<const {{TYPE}} *>(b));";
+      } else {
+        FLATBUFFERS_ASSERT(false);
+      }
+      code_ += "    }";
+    }
+    code_ += "    default: return true;";
+    code_ += "  }";
+    code_ += "}";
+    code_ += "";
+  }
+
+  // Generate XUnion::Hash(), which agrees with HashX() on the packed value.
+  void GenUnionNativeHash(const EnumDef &enum_def) {
+    code_ += "inline size_t {{ENUM_NAME}}Union::Hash() const {";
+    code_ += "  if (!value) return 0;";
+    code_ += "  switch (type) {";
+    for (auto it = enum_def.vals.vec.begin(); it != enum_def.vals.vec.end();
+         ++it) {
+      const auto &ev = **it;
+      if (!ev.value) { continue; }
+      code_.SetValue("LABEL", GetEnumValUse(enum_def, ev));
+      code_.SetValue("TYPE",
+                     NativeName(GetUnionElement(ev, true, true, true),
+                                ev.union_type.struct_def, parser_.opts));
+      code_ += "    case {{LABEL}}: {";
+      code_ += "      auto ptr = reinterpret_cast<const {{TYPE}} *>(value);";
+      if (ev.union_type.base_type == BASE_TYPE_STRUCT) {
+        if (ev.union_type.struct_def->fixed) {
+          code_ +=
+              "      return static_cast<size_t>("
+              "flatbuffers::HashBytes(0, ptr, sizeof(*ptr)));";
+        } else {
+          code_ += "      return ptr->Hash();";
+        }
+      } else if (ev.union_type.base_type == BASE_TYPE_STRING) {
+        code_ +=
+            "      return static_cast<size_t>("
+            "flatbuffers::HashBytes(0, ptr->c_str(), ptr->length()));";
+      } else {
+        FLATBUFFERS_ASSERT(false);
+      }
+      code_ += "    }";
+    }
+    code_ += "    default: return 0;";
+    code_ += "  }";
+    code_ += "}";
+    code_ += "";
+  }
+
   void GenUnionPost(const EnumDef &enum_def) {
     // Generate a verifier function for this union that can be called by the
     // table verifier functions. It uses a switch case to select a specific
@@ -1217,6 +1433,8 @@ class CppGenerator : public BaseGenerator {
     code_ += "}";
     code_ += "";
 
+    if (parser_.opts.gen_hash) { GenUnionHash(enum_def); }
+
     if (parser_.opts.generate_object_based_api) {
       // Generate union Unpack() and Pack() functions.
       code_ += "inline " + UnionUnPackSignature(enum_def, false) + " {";
@@ -1249,6 +1467,49 @@ class CppGenerator : public BaseGenerator {
       code_ += "}";
       code_ += "";
 
+      // Unpack into the current value if it has the same type, else replace
+      // it.
+      code_ += "inline " + UnionUnPackToSignature(enum_def, false) + " {";
+      code_ += "  if (value && type == _type) {";
+      code_ += "    switch (type) {";
+      for (auto it = enum_def.vals.vec.begin(); it != enum_def.vals.vec.end();
+           ++it) {
+        const auto &ev = **it;
+        if (!ev.value) { continue; }
+
+        code_.SetValue("LABEL", GetEnumValUse(enum_def, ev));
+        code_.SetValue("TYPE", GetUnionElement(ev, true, true));
+        code_.SetValue("NATIVE_TYPE",
+                       NativeName(GetUnionElement(ev, true, true, true),
+                                  ev.union_type.struct_def, parser_.opts));
+        code_ += "      case {{LABEL}}: {";
+        code_ += "        auto ptr = reinterpret_cast<const {{TYPE}} *>(obj);";
+        if (ev.union_type.base_type == BASE_TYPE_STRUCT) {
+          if (ev.union_type.struct_def->fixed) {
+            code_ += "        *reinterpret_cast<{{NATIVE_TYPE}} *>(value) = "
+                     "*ptr;";
+          } else {
+            code_ += "        ptr->UnPackTo(reinterpret_cast<{{NATIVE_TYPE}} "
+                     "*>(value), resolver);";
+          }
+        } else if (ev.union_type.base_type == BASE_TYPE_STRING) {
+          code_ += "        reinterpret_cast<std::string *>(value)->assign("
+                   "ptr->c_str(), ptr->size());";
+        } else {
+          FLATBUFFERS_ASSERT(false);
+        }
+        code_ += "        return;";
+        code_ += "      }";
+      }
+      code_ += "      default: break;";
+      code_ += "    }";
+      code_ += "  }";
+      code_ += "  Reset();";
+      code_ += "  type = _type;";
+      code_ += "  value = UnPack(obj, _type, resolver);";
+      code_ += "}";
+      code_ += "";
+
       code_ += "inline " + UnionPackSignature(enum_def, false) + " {";
       code_ += "  switch (type) {";
       for (auto it = enum_def.vals.vec.begin(); it != enum_def.vals.vec.end();
@@ -1282,6 +1543,52 @@ class CppGenerator : public BaseGenerator {
       code_ += "}";
       code_ += "";
 
+      // The bound of the value, for GetPackedSizeUpperBound of tables.
+      code_ += "inline size_t {{ENUM_NAME}}Union::GetPackedSizeUpperBound() "
+               "const {";
+      code_ += "  switch (type) {";
+      for (auto it = enum_def.vals.vec.begin(); it != enum_def.vals.vec.end();
+           ++it) {
+        auto &ev = **it;
+        if (!ev.value) { continue; }
+
+        code_.SetValue("LABEL", GetEnumValUse(enum_def, ev));
+        code_.SetValue("TYPE",
+                       NativeName(GetUnionElement(ev, true, true, true),
+                                  ev.union_type.struct_def, parser_.opts));
+        code_ += "    case {{LABEL}}: {";
+        if (ev.union_type.base_type == BASE_TYPE_STRUCT) {
+          const auto &struct_def = *ev.union_type.struct_def;
+          if (struct_def.fixed) {
+            code_ += "      return " +
+                     NumToString(struct_def.bytesize + struct_def.minalign -
+                                 1) +
+                     ";";
+          } else {
+            // Qualified, as this function hides the one for tables.
+            code_ += "      auto ptr = reinterpret_cast<const {{TYPE}} *>(value);";
+            code_ += "      return ::" +
+                     TranslateNameSpace(
+                         struct_def.defined_namespace->GetFullyQualifiedName(
+                             "GetPackedSizeUpperBound")) +
+                     "(*ptr);";
+          }
+        } else if (ev.union_type.base_type == BASE_TYPE_STRING) {
+          code_ += "      auto ptr = reinterpret_cast<const {{TYPE}} *>(value);";
+          code_ += "      return ptr->length() + " +
+                   NumToString(2 * sizeof(uoffset_t)) + ";";
+        } else {
+          FLATBUFFERS_ASSERT(false);
+        }
+        code_ += "    }";
+      }
+      code_ += "    default: return 0;";
+      code_ += "  }";
+      code_ += "}";
+      code_ += "";
+
+      if (parser_.opts.gen_hash) { GenUnionNativeHash(enum_def); }
+
       // Union copy constructor
       code_ +=
           "inline {{ENUM_NAME}}Union::{{ENUM_NAME}}Union(const "
@@ -1549,14 +1856,14 @@ class CppGenerator : public BaseGenerator {
   }
 
   void GenOperatorNewDelete(const StructDef &struct_def) {
-    if (auto native_custom_alloc =
-            struct_def.attributes.Lookup("native_custom_alloc")) {
+    const auto allocator = NativeAllocator(&struct_def);
+    if (!allocator.empty()) {
       code_ += "  inline void *operator new (std::size_t count) {";
-      code_ += "    return " + native_custom_alloc->constant +
+      code_ += "    return " + allocator +
                "<{{NATIVE_NAME}}>().allocate(count / sizeof({{NATIVE_NAME}}));";
       code_ += "  }";
       code_ += "  inline void operator delete (void *ptr) {";
-      code_ += "    return " + native_custom_alloc->constant +
+      code_ += "    return " + allocator +
                "<{{NATIVE_NAME}}>().deallocate(static_cast<{{NATIVE_NAME}}*>("
                "ptr),1);";
       code_ += "  }";
@@ -1577,6 +1884,7 @@ class CppGenerator : public BaseGenerator {
          it != struct_def.fields.vec.end(); ++it) {
       GenMember(**it);
     }
+    if (parser_.opts.gen_hash) { code_ += "  size_t Hash() const;"; }
     GenOperatorNewDelete(struct_def);
     GenDefaultConstructor(struct_def);
     code_ += "};";
@@ -1664,6 +1972,7 @@ class CppGenerator : public BaseGenerator {
       code_ += "  int KeyCompareWithValue(const char *val) const {";
       code_ += "    return strcmp({{FIELD_NAME}}()->c_str(), val);";
       code_ += "  }";
+      code_.SetValue("KEY_VALUE_TYPE", "const flatbuffers::String *");
     } else {
       FLATBUFFERS_ASSERT(IsScalar(field.value.type.base_type));
       auto type = GenTypeBasic(field.value.type, false);
@@ -1678,7 +1987,57 @@ class CppGenerator : public BaseGenerator {
           "    return static_cast<int>({{FIELD_NAME}}() > val) - "
           "static_cast<int>({{FIELD_NAME}}() < val);";
       code_ += "  }";
+      code_.SetValue("KEY_VALUE_TYPE",
+                     type.back() == ' ' ? type : type + " ");
     }
+    // Lets Vector hash keys, and interpolate between integer ones.
+    code_ += "  {{KEY_VALUE_TYPE}}GetKey() const {";
+    code_ += "    return {{FIELD_NAME}}();";
+    code_ += "  }";
+  }
+
+  // The vector a hash index field of struct_def was added for by the parser,
+  // or nullptr if it isn't one.
+  const FieldDef *HashIndexedVector(const StructDef &struct_def,
+                                    const FieldDef &field) const {
+    const std::string suffix = HashIndexFieldSuffix();
+    const auto &name = field.name;
+    if (name.size() <= suffix.size() ||
+        name.compare(name.size() - suffix.size(), suffix.size(), suffix)) {
+      return nullptr;
+    }
+    auto indexed =
+        struct_def.fields.Lookup(name.substr(0, name.size() - suffix.size()));
+    return indexed && indexed->attributes.Lookup("hashed") ? indexed : nullptr;
+  }
+
+  // Generate an accessor looking up an element of a (hashed) vector of tables
+  // by key through its hash index.
+  void GenHashedLookup(const FieldDef &field) {
+    const auto &element = *field.value.type.struct_def;
+    const FieldDef *key = nullptr;
+    for (auto it = element.fields.vec.begin(); it != element.fields.vec.end();
+         ++it) {
+      if ((*it)->key) key = *it;
+    }
+    FLATBUFFERS_ASSERT(key);  // Guaranteed by the parser.
+    auto key_type = std::string("const char *");
+    if (key->value.type.base_type != BASE_TYPE_STRING) {
+      key_type = GenTypeBasic(key->value.type, false) + " ";
+      if (parser_.opts.scoped_enums && key->value.type.enum_def) {
+        key_type = GenTypeGet(key->value.type, " ", "const ", " *", true);
+      }
+    }
+    code_.SetValue("KEY_TYPE", key_type);
+    code_.SetValue("ELEMENT_TYPE", WrapInNameSpace(element));
+    code_.SetValue("SUFFIX", HashIndexFieldSuffix());
+    code_ +=
+        "  const {{ELEMENT_TYPE}} *{{FIELD_NAME}}_by_key({{KEY_TYPE}}key) "
+        "const {";
+    code_ +=
+        "    return {{FIELD_NAME}}() ? {{FIELD_NAME}}()->LookupByKeyHashed("
+        "key, {{FIELD_NAME}}{{SUFFIX}}()) : nullptr;";
+    code_ += "  }";
   }
 
   // Generate an accessor struct, builder structs & function for a table.
@@ -1866,12 +2225,21 @@ class CppGenerator : public BaseGenerator {
         code_ += "  }";
       }
 
+      if (field.attributes.Lookup("hashed")) {
+        GenHashedLookup(field);
+      }
+
       // Generate a comparison function for this field if it is a key.
       if (field.key) {
         GenKeyFieldMethods(field);
       }
     }
 
+    code_.SetValue("NUM_FIELDS", NumToString(struct_def.fields.vec.size()));
+    code_ += "  flatbuffers::FieldPresence<{{NUM_FIELDS}}> PresenceMask() const {";
+    code_ += "    return flatbuffers::FieldPresence<{{NUM_FIELDS}}>(this);";
+    code_ += "  }";
+
     // Generate a verifier function that can check a buffer from an untrusted
     // source will never cause reads outside the buffer.
     code_ += "  bool Verify(flatbuffers::Verifier &verifier) const {";
@@ -1881,11 +2249,23 @@ class CppGenerator : public BaseGenerator {
       const auto &field = **it;
       if (field.deprecated) { continue; }
       GenVerifyCall(field, " &&\n           ");
+      const auto indexed = HashIndexedVector(struct_def, field);
+      if (indexed) {
+        code_.SetValue("INDEXED_NAME", Name(*indexed));
+        code_ +=
+            " &&\n           verifier.VerifyHashIndex({{INDEXED_NAME}}(), "
+            "{{NAME}}())\\";
+      }
     }
 
     code_ += " &&\n           verifier.EndTable();";
     code_ += "  }";
 
+    if (parser_.opts.gen_hash) {
+      code_ += "  size_t Hash() const;";
+      code_ += "  bool Equals(const {{STRUCT_NAME}} &_o) const;";
+    }
+
     if (parser_.opts.generate_object_based_api) {
       // Generate the UnPack() pre declaration.
       code_ +=
@@ -1893,6 +2273,9 @@ class CppGenerator : public BaseGenerator {
       code_ +=
           "  " + TableUnPackToSignature(struct_def, true, parser_.opts) + ";";
       code_ += "  " + TablePackSignature(struct_def, true, parser_.opts) + ";";
+      code_ += "  " +
+               TablePackReservedSignature(struct_def, true, parser_.opts) +
+               ";";
     }
 
     code_ += "};";  // End of table.
@@ -1941,6 +2324,7 @@ class CppGenerator : public BaseGenerator {
       // Generate a pre-declaration for a CreateX method that works with an
       // unpacked C++ object.
       code_ += TableCreateSignature(struct_def, true, parser_.opts) + ";";
+      code_ += TableSizeBoundSignature(struct_def, parser_.opts) + ";";
       code_ += "";
     }
   }
@@ -2108,6 +2492,82 @@ class CppGenerator : public BaseGenerator {
       code_ += "}";
       code_ += "";
     }
+
+    if (parser_.opts.gen_buffer_templates) { GenBufferTemplate(struct_def); }
+  }
+
+  // Generate a BufferTemplate for buffers with this table at their root,
+  // resolving the positions of the scalar and struct fields of the root once,
+  // with mutators of the form:
+  // bool mutate_name(uint8_t *buf, type _name) const {
+  //   if (!name_) return false;
+  //   flatbuffers::WriteScalar<type>(buf + name_, _name);
+  //   return true;
+  // }
+  void GenBufferTemplate(const StructDef &struct_def) {
+    std::vector<const FieldDef *> fields;
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      // Patching a union type on its own would corrupt the union.
+      if (!field.deprecated && field.value.type.base_type != BASE_TYPE_UTYPE &&
+          (IsScalar(field.value.type.base_type) ||
+           IsStruct(field.value.type))) {
+        fields.push_back(&field);
+      }
+    }
+
+    code_ += "class {{STRUCT_NAME}}BufferTemplate : "
+             "public flatbuffers::BufferTemplate {";
+    code_ += " public:";
+    code_ += "  {{STRUCT_NAME}}BufferTemplate(const uint8_t *buf, size_t size)";
+    code_ += "      : flatbuffers::BufferTemplate(buf, size) {";
+    if (!fields.empty()) {
+      code_ += "    auto root = flatbuffers::GetRoot<{{STRUCT_NAME}}>(data());";
+    }
+    for (auto it = fields.begin(); it != fields.end(); ++it) {
+      code_.SetValue("FIELD_NAME", Name(**it));
+      code_.SetValue("OFFSET_NAME", GenFieldOffsetName(**it));
+      code_ += "    {{FIELD_NAME}}_ = FieldPosition(root, "
+               "{{STRUCT_NAME}}::{{OFFSET_NAME}});";
+    }
+    code_ += "  }";
+    for (auto it = fields.begin(); it != fields.end(); ++it) {
+      const auto &field = **it;
+      code_.SetValue("FIELD_NAME", Name(field));
+      const auto &type = field.value.type;
+      if (IsStruct(type)) {
+        code_.SetValue("FIELD_TYPE",
+                       "const " + WrapInNameSpace(*type.struct_def) + " &");
+      } else {
+        code_.SetValue("FIELD_TYPE", GenTypeBasic(type, true) + " ");
+      }
+      code_ += "  bool mutate_{{FIELD_NAME}}(uint8_t *buf, {{FIELD_TYPE}}"
+               "_{{FIELD_NAME}}) const {";
+      code_ += "    if (!{{FIELD_NAME}}_) return false;";
+      if (IsStruct(field.value.type)) {
+        code_ += "    memcpy(buf + {{FIELD_NAME}}_, &_{{FIELD_NAME}}, "
+                 "sizeof(_{{FIELD_NAME}}));";
+      } else {
+        code_.SetValue("WIRE_TYPE", GenTypeWire(field.value.type, "", false));
+        code_.SetValue("FIELD_VALUE",
+                       GenUnderlyingCast(field, false, "_" + Name(field)));
+        code_ += "    flatbuffers::WriteScalar<{{WIRE_TYPE}}>(buf + "
+                 "{{FIELD_NAME}}_, {{FIELD_VALUE}});";
+      }
+      code_ += "    return true;";
+      code_ += "  }";
+    }
+    if (!fields.empty()) {
+      code_ += "";
+      code_ += " private:";
+    }
+    for (auto it = fields.begin(); it != fields.end(); ++it) {
+      code_.SetValue("FIELD_NAME", Name(**it));
+      code_ += "  flatbuffers::uoffset_t {{FIELD_NAME}}_;";
+    }
+    code_ += "};";
+    code_ += "";
   }
 
   std::string GenUnionUnpackVal(const FieldDef &afield,
@@ -2123,6 +2583,12 @@ class CppGenerator : public BaseGenerator {
                            bool invector, const FieldDef &afield) {
     switch (type.base_type) {
       case BASE_TYPE_STRING: {
+        if (parser_.opts.cpp_object_api_arena ||
+            NativeString(&afield) == "flatbuffers::StringView") {
+          // Without going through a std::string on the heap.
+          return NativeString(&afield) + "(" + val + "->c_str(), " + val +
+                 "->size())";
+        }
         return val + "->str()";
       }
       case BASE_TYPE_STRUCT: {
@@ -2156,8 +2622,9 @@ class CppGenerator : public BaseGenerator {
     }
   };
 
-  std::string GenUnpackFieldStatement(const FieldDef &field,
-                                      const FieldDef *union_field) {
+  // Union type fields are unpacked along with their union, by
+  // GenUnpackFieldStatement for the union field, and have none of their own.
+  std::string GenUnpackFieldStatement(const FieldDef &field) {
     std::string code;
     switch (field.value.type.base_type) {
       case BASE_TYPE_VECTOR: {
@@ -2171,18 +2638,32 @@ class CppGenerator : public BaseGenerator {
         if (field.value.type.enum_def) { indexing += ")"; }
         if (field.value.type.element == BASE_TYPE_BOOL) { indexing += " != 0"; }
 
-        // Generate code that pushes data from _e to _o in the form:
+        // Generate code that sets data from _e in _o in the form:
+        //   _o->field.resize(_e->size());
         //   for (uoffset_t i = 0; i < _e->size(); ++i) {
-        //     _o->field.push_back(_e->Get(_i));
+        //     _o->field[_i] = _e->Get(_i);
         //   }
+        // which keeps the vector's capacity, and its elements, which are
+        // unpacked into where possible.
         auto name = Name(field);
-        if (field.value.type.element == BASE_TYPE_UTYPE) {
-          name = StripUnionType(Name(field));
+        // With --cpp-views, vectors of plain scalars refer to the buffer:
+        //   _o->field = flatbuffers::VectorView<T>(*_e);
+        if (IsVectorView(field)) {
+          code += "_o->" + name + " = " +
+                  GenTypeNative(field.value.type, false, field) + "(*_e);";
+          break;
+        }
+        // Otherwise they're copied in bulk, as are vectors of structs:
+        //   flatbuffers::UnPackVector(*_e, &_o->field);
+        auto element_type = field.value.type.VectorType();
+        if (!cpp_type && !element_type.enum_def &&
+            ((IsScalar(element_type.base_type) &&
+              element_type.base_type != BASE_TYPE_BOOL) ||
+             (IsStruct(element_type) &&
+              !element_type.struct_def->attributes.Lookup("native_type")))) {
+          code += "{ flatbuffers::UnPackVector(*_e, &_o->" + name + "); }";
+          break;
         }
-        auto access =
-            field.value.type.element == BASE_TYPE_UTYPE
-                ? ".type"
-                : (field.value.type.element == BASE_TYPE_UNION ? ".value" : "");
         code += "{ _o->" + name + ".resize(_e->size()); ";
         code += "for (flatbuffers::uoffset_t _i = 0;";
         code += " _i < _e->size(); _i++) { ";
@@ -2195,37 +2676,34 @@ class CppGenerator : public BaseGenerator {
           code += "//vector resolver, " + PtrType(&field) + "\n";
           code += "if (_resolver) ";
           code += "(*_resolver)";
-          code += "(reinterpret_cast<void **>(&_o->" + name + "[_i]" + access + "), ";
+          code += "(reinterpret_cast<void **>(&_o->" + name + "[_i]), ";
           code += "static_cast<flatbuffers::hash_value_t>(" + indexing + "));";
           if (PtrType(&field) == "naked") {
             code += " else ";
-            code += "_o->" + name + "[_i]" + access + " = nullptr";
+            code += "_o->" + name + "[_i] = nullptr;";
           } else {
             //code += " else ";
             //code += "_o->" + name + "[_i]" + access + " = " + GenTypeNativePtr(cpp_type->constant, &field, true) + "();";
-            code += "/* else do nothing */";
+            code += "/* else do nothing */;";
           }
+        } else if (element_type.base_type == BASE_TYPE_UNION) {
+          code += "_o->" + name + "[_i].UnPackTo(_e->Get(_i), " +
+                  EscapeKeyword(field.name + UnionTypeFieldSuffix()) +
+                  "()->GetEnum<" + element_type.enum_def->name +
+                  ">(_i), _resolver);";
         } else {
-          code += "_o->" + name + "[_i]" + access + " = ";
-          code +=
-            GenUnpackVal(field.value.type.VectorType(), indexing, true, field);
+          code += GenUnpackAssignment(element_type, "_o->" + name + "[_i]",
+                                      "_e->Get(_i)", indexing, true, field);
         }
-        code += "; } }";
-        break;
-      }
-      case BASE_TYPE_UTYPE: {
-        FLATBUFFERS_ASSERT(union_field->value.type.base_type == BASE_TYPE_UNION);
-        // Generate code that sets the union type, of the form:
-        //   _o->field.type = _e;
-        code += "_o->" + union_field->name + ".type = _e;";
+        code += " } }";
         break;
       }
       case BASE_TYPE_UNION: {
-        // Generate code that sets the union value, of the form:
-        //   _o->field.value = Union::Unpack(_e, field_type(), resolver);
-        code += "_o->" + Name(field) + ".value = ";
-        code += GenUnionUnpackVal(field, "", "");
-        code += ";";
+        // Generate code that sets the union, of the form:
+        //   _o->field.UnPackTo(_e, field_type(), resolver);
+        code += "_o->" + Name(field) + ".UnPackTo(_e, " +
+                EscapeKeyword(field.name + UnionTypeFieldSuffix()) +
+                "(), _resolver);";
         break;
       }
       default: {
@@ -2250,10 +2728,8 @@ class CppGenerator : public BaseGenerator {
             code += "/* else do nothing */;";
           }
         } else {
-          // Generate code for assigning the value, of the form:
-          //  _o->field = value;
-          code += "_o->" + Name(field) + " = ";
-          code += GenUnpackVal(field.value.type, "_e", false, field) + ";";
+          code += GenUnpackAssignment(field.value.type, "_o->" + Name(field),
+                                      "_e", "_e", false, field);
         }
         break;
       }
@@ -2261,6 +2737,68 @@ class CppGenerator : public BaseGenerator {
     return code;
   }
 
+  // Generate a statement assigning a value from the buffer (val, or ptr for
+  // strings and tables) to dest, of the form:
+  //   dest = value;
+  // or, to reuse what dest already holds:
+  //   dest.assign(ptr->c_str(), ptr->size());
+  //   if (dest) { ptr->UnPackTo(dest.get(), _resolver); } else { dest = ...; }
+  std::string GenUnpackAssignment(const Type &type, const std::string &dest,
+                                  const std::string &ptr,
+                                  const std::string &val, bool invector,
+                                  const FieldDef &afield) {
+    const auto assignment =
+        dest + " = " + GenUnpackVal(type, val, invector, afield) + ";";
+    if (type.base_type == BASE_TYPE_STRING && IsAssignableString(afield)) {
+      return dest + ".assign(" + ptr + "->c_str(), " + ptr + "->size());";
+    }
+    if (type.base_type != BASE_TYPE_STRUCT || (invector && IsStruct(type)) ||
+        afield.native_inline || !IsUniquePtr(afield)) {
+      return assignment;
+    }
+    if (IsStruct(type)) {
+      if (type.struct_def->attributes.Lookup("native_type")) {
+        return assignment;
+      }
+      return "if (" + dest + ") { *" + dest + " = *" + ptr + "; } else { " +
+             assignment + " }";
+    }
+    return "if (" + dest + ") { " + ptr + "->UnPackTo(" + dest +
+           ".get(), _resolver); } else { " + assignment + " }";
+  }
+
+  // Generate code that resets a field that is missing from the buffer, so
+  // unpacking into an existing object leaves nothing of what it held, or
+  // an empty string if the field doesn't need resetting.
+  std::string GenUnpackFieldReset(const FieldDef &field) {
+    const auto &type = field.value.type;
+    const auto dest = "_o->" + Name(field);
+    switch (type.base_type) {
+      case BASE_TYPE_STRING:
+        if (IsAssignableString(field) ||
+            NativeString(&field) == "flatbuffers::StringView") {
+          return dest + ".clear();";
+        }
+        // A cpp_str_type need not have clear().
+        return dest + " = " + NativeString(&field) + "();";
+      case BASE_TYPE_VECTOR: return dest + ".clear();";
+      case BASE_TYPE_UNION: return dest + ".Reset();";
+      case BASE_TYPE_STRUCT:
+        if (IsStruct(type) &&
+            (field.native_inline ||
+             type.struct_def->attributes.Lookup("native_type"))) {
+          return dest + " = " + GenTypeNative(type, false, field) + "();";
+        }
+        if (field.native_inline) return "";
+        if (IsUniquePtr(field)) return dest + ".reset();";
+        // A naked pointer may not own what it points to, so is left alone.
+        // Any other cpp_ptr_type is reset by assigning a null one.
+        if (PtrType(&field) == "naked") return "";
+        return dest + " = " + GenTypeNative(type, false, field) + "();";
+      default: return "";
+    }
+  }
+
   std::string GenCreateParam(const FieldDef &field) {
     const IDLOptions &opts = parser_.opts;
 
@@ -2336,7 +2874,16 @@ class CppGenerator : public BaseGenerator {
             break;
           }
           case BASE_TYPE_BOOL: {
-            code += "_fbb.CreateVector(" + value + ")";
+            if (NativeAllocator(nullptr).empty()) {
+              code += "_fbb.CreateVector(" + value + ")";
+            } else {
+              // CreateVector only takes a std::vector<bool> with the default
+              // allocator.
+              code += "_fbb.CreateVector<uint8_t>(" + value +
+                      ".size(), [](size_t i, _VectorArgs *__va) { "
+                      "return static_cast<uint8_t>(__va->_" +
+                      value + "[i]); }, &_va)";
+            }
             break;
           }
           case BASE_TYPE_UNION: {
@@ -2451,15 +2998,23 @@ class CppGenerator : public BaseGenerator {
         // Assign a value from |this| to |_o|.   Values from |this| are stored
         // in a variable |_e| by calling this->field_type().  The value is then
         // assigned to |_o| using the GenUnpackFieldStatement.
-        const bool is_union = field.value.type.base_type == BASE_TYPE_UTYPE;
-        const auto statement =
-            GenUnpackFieldStatement(field, is_union ? *(it + 1) : nullptr);
+        // Fields missing from |this| are reset with GenUnpackFieldReset.
+        if (field.value.type.base_type == BASE_TYPE_UTYPE ||
+            field.value.type.element == BASE_TYPE_UTYPE) {
+          continue;
+        }
+        auto statement = GenUnpackFieldStatement(field);
+        const auto reset = GenUnpackFieldReset(field);
+        if (!reset.empty() && statement[0] != '{') {
+          statement = "{ " + statement + " }";
+        }
 
         code_.SetValue("FIELD_NAME", Name(field));
         auto prefix = "  { auto _e = {{FIELD_NAME}}(); ";
         auto check = IsScalar(field.value.type.base_type) ? "" : "if (_e) ";
+        auto otherwise = reset.empty() ? "" : " else { " + reset + " }";
         auto postfix = " };";
-        code_ += std::string(prefix) + check + statement + postfix;
+        code_ += std::string(prefix) + check + statement + otherwise + postfix;
       }
       code_ += "}";
       code_ += "";
@@ -2472,6 +3027,15 @@ class CppGenerator : public BaseGenerator {
       code_ += "}";
       code_ += "";
 
+      // And an X::Pack that first reserves all the space it needs.
+      code_ += "inline " +
+               TablePackReservedSignature(struct_def, false, parser_.opts) +
+               " {";
+      code_ += "  _fbb.Reserve(GetPackedSizeUpperBound(_o));";
+      code_ += "  return Create{{STRUCT_NAME}}(_fbb, &_o, _rehasher);";
+      code_ += "}";
+      code_ += "";
+
       // Generate a CreateX method that works with an unpacked C++ object.
       code_ += "inline " +
                TableCreateSignature(struct_def, false, parser_.opts) + " {";
@@ -2491,7 +3055,13 @@ class CppGenerator : public BaseGenerator {
            it != struct_def.fields.vec.end(); ++it) {
         auto &field = **it;
         if (field.deprecated) { continue; }
-        code_ += "  auto _" + Name(field) + " = " + GenCreateParam(field) + ";";
+        // A hash index is rebuilt for the vector just packed, as the one in
+        // _o may not match it.
+        const auto indexed = HashIndexedVector(struct_def, field);
+        const auto param =
+            indexed ? "_fbb.CreateHashIndex(_" + Name(*indexed) + ")"
+                    : GenCreateParam(field);
+        code_ += "  auto _" + Name(field) + " = " + param + ";";
       }
       // Need to call "Create" with the struct namespace.
       const auto qualified_create_name =
@@ -2524,7 +3094,316 @@ class CppGenerator : public BaseGenerator {
       code_ += ");";
       code_ += "}";
       code_ += "";
+
+      GenPackedSizeUpperBound(struct_def);
+    }
+
+    if (parser_.opts.gen_hash) { GenTableHash(struct_def); }
+  }
+
+  // Generate a statement mixing a field of a table (or, if native, of its
+  // native table) into the hash _h, unless the field is absent or default.
+  // Both agree: a native table hashes like the table it's packed to, with
+  // empty strings and vectors hashing like absent ones.
+  std::string GenHashField(const StructDef &struct_def, const FieldDef &field,
+                           bool native) {
+    const auto &type = field.value.type;
+    const auto name = Name(field);
+    // Hashed references (cpp_type) and structs with a native_type differ in
+    // native tables, so they are left out (Equals() still compares them).
+    if (field.attributes.Lookup("cpp_type")) return "";
+    if ((type.base_type == BASE_TYPE_STRUCT ||
+         (type.base_type == BASE_TYPE_VECTOR &&
+          type.element == BASE_TYPE_STRUCT)) &&
+        type.struct_def->fixed &&
+        type.struct_def->attributes.Lookup("native_type")) {
+      return "";
+    }
+    const auto seed = "flatbuffers::HashCombine(_h, " +
+                      (native ? Name(struct_def) + "::" : "") +
+                      GenFieldOffsetName(field) + ")";
+    const auto get = native ? "auto &_e = " + name + "; "
+                            : "auto _e = " + name + "(); ";
+    const auto vec = native ? "_e" : "*_e";
+    switch (type.base_type) {
+      case BASE_TYPE_UTYPE: return "";  // Hashed with the union.
+      case BASE_TYPE_STRING: {
+        if (native) {
+          return "{ " + get + "if (_e.length()) _h = flatbuffers::HashBytes(" +
+                 seed + ", _e.c_str(), _e.length()); }";
+        }
+        return "{ " + get +
+               "if (_e && _e->size()) _h = flatbuffers::HashBytes(" + seed +
+               ", _e->c_str(), _e->size()); }";
+      }
+      case BASE_TYPE_VECTOR: {
+        const auto cond = native ? "!_e.empty()" : "_e && _e->size()";
+        std::string hash;
+        switch (type.element) {
+          case BASE_TYPE_UTYPE: return "";
+          case BASE_TYPE_UNION: {
+            if (native) {
+              hash = "flatbuffers::HashUnions(" + seed + ", _e)";
+            } else {
+              return "{ " + get + "auto _t = " + name + UnionTypeFieldSuffix() +
+                     "(); if (_e && _t && _e->size()) _h = "
+                     "flatbuffers::HashUnions(" + seed + ", *_e, *_t, " +
+                     WrapInNameSpace(type.enum_def->defined_namespace,
+                                     "Hash" + Name(*type.enum_def)) +
+                     "); }";
+            }
+            break;
+          }
+          case BASE_TYPE_STRING: {
+            hash = "flatbuffers::HashStrings(" + seed + ", " + vec + ")";
+            break;
+          }
+          case BASE_TYPE_STRUCT: {
+            if (type.struct_def->fixed) {
+              hash = "flatbuffers::HashBytes(" + seed + ", _e" +
+                     (native ? ".data(), _e.size()" : "->Data(), _e->size()") +
+                     " * sizeof(" + WrapInNameSpace(*type.struct_def) + "))";
+            } else {
+              hash = "flatbuffers::HashTables(" + seed + ", " + vec + ")";
+            }
+            break;
+          }
+          default: {
+            if (native && (type.enum_def || type.element == BASE_TYPE_BOOL)) {
+              hash = "flatbuffers::HashScalarsAs<" +
+                     GenTypeBasic(type.VectorType(), false) + ">(" + seed +
+                     ", _e)";
+            } else {
+              hash = "flatbuffers::HashScalars(" + seed + ", " + vec + ")";
+            }
+            break;
+          }
+        }
+        return "{ " + get + "if (" + cond + ") _h = " + hash + "; }";
+      }
+      case BASE_TYPE_STRUCT: {
+        std::string ptr = "_e";
+        if (native) {
+          if (field.native_inline) {
+            ptr = "&" + name;
+          } else {
+            ptr = name + GenPtrGet(field);
+          }
+        } else {
+          ptr = name + "()";
+        }
+        std::string hash;
+        if (type.struct_def->fixed) {
+          hash = "flatbuffers::HashBytes(" + seed + ", _e, sizeof(*_e))";
+        } else {
+          hash = "flatbuffers::HashCombine(" + seed + ", _e->Hash())";
+        }
+        return "{ auto _e = " + ptr + "; if (_e) _h = " + hash + "; }";
+      }
+      case BASE_TYPE_UNION: {
+        const auto &enum_def = *type.enum_def;
+        const auto none = WrapInNameSpace(
+            enum_def.defined_namespace,
+            GetEnumValUse(enum_def, *enum_def.vals.Lookup("NONE")));
+        if (native) {
+          return "if (" + name + ".type != " + none +
+                 ") _h = flatbuffers::HashCombine(flatbuffers::HashCombine(" +
+                 seed + ", static_cast<uint64_t>(" + name + ".type)), " + name +
+                 ".Hash());";
+        }
+        return "{ auto _t = " + name + UnionTypeFieldSuffix() +
+               "(); if (_t != " + none +
+               ") _h = flatbuffers::HashCombine(flatbuffers::HashCombine(" +
+               seed + ", static_cast<uint64_t>(_t)), " +
+               WrapInNameSpace(enum_def.defined_namespace,
+                               "Hash" + Name(enum_def)) +
+               "(" + name + "(), _t)); }";
+      }
+      default: {
+        const auto underlying = GenTypeBasic(type, false);
+        const auto value =
+            native ? GenUnderlyingCast(field, false, name)
+                   : "GetField<" + underlying + ">(" +
+                         GenFieldOffsetName(field) + ", " +
+                         GenDefaultConstant(field) + ")";
+        return "{ auto _e = " + value + "; if (_e != " +
+               GenDefaultConstant(field) +
+               ") _h = flatbuffers::HashScalar(" + seed + ", _e); }";
+      }
+    }
+  }
+
+  // Generate an expression comparing a field of this table with that of
+  // another table _o, treating absent strings and vectors as empty ones.
+  std::string GenEqualsField(const FieldDef &field) {
+    const auto &type = field.value.type;
+    const auto name = Name(field);
+    switch (type.base_type) {
+      case BASE_TYPE_UTYPE: return "";  // Compared with the union.
+      case BASE_TYPE_STRING: {
+        return "flatbuffers::StringEquals(" + name + "(), _o." + name + "())";
+      }
+      case BASE_TYPE_VECTOR: {
+        if (type.element == BASE_TYPE_UTYPE) return "";
+        if (type.element == BASE_TYPE_UNION) {
+          const auto types = name + UnionTypeFieldSuffix();
+          return "flatbuffers::UnionsEqual(" + name + "(), " + types +
+                 "(), _o." + name + "(), _o." + types + "(), " +
+                 WrapInNameSpace(type.enum_def->defined_namespace,
+                                 "Equals" + Name(*type.enum_def)) +
+                 ")";
+        }
+        return "flatbuffers::VectorEquals(" + name + "(), _o." + name + "())";
+      }
+      case BASE_TYPE_STRUCT: {
+        const auto compare = type.struct_def->fixed
+                                 ? "flatbuffers::StructEquals("
+                                 : "flatbuffers::TableEquals(";
+        return compare + name + "(), _o." + name + "())";
+      }
+      case BASE_TYPE_UNION: {
+        const auto types = name + UnionTypeFieldSuffix();
+        return types + "() == _o." + types + "() &&\n         " +
+               WrapInNameSpace(type.enum_def->defined_namespace,
+                               "Equals" + Name(*type.enum_def)) +
+               "(" + name + "(), _o." + name + "(), " + types + "())";
+      }
+      default: {
+        const auto value = "GetField<" + GenTypeBasic(type, false) + ">(" +
+                           GenFieldOffsetName(field) + ", " +
+                           GenDefaultConstant(field) + ")";
+        return "flatbuffers::ScalarEquals(" + value + ", _o." + value + ")";
+      }
+    }
+  }
+
+  // Generate X::Hash() and X::Equals() for table X, and XT::Hash() for its
+  // native table, of the form:
+  //   uint64_t _h = 0;
+  //   { auto _e = field(); if (_e is not absent or default) _h = ...; }
+  //   ...
+  void GenTableHash(const StructDef &struct_def) {
+    code_.SetValue("STRUCT_NAME", Name(struct_def));
+    code_.SetValue("NATIVE_NAME",
+                   NativeName(Name(struct_def), &struct_def, parser_.opts));
+    for (int native = 0;
+         native <= (parser_.opts.generate_object_based_api ? 1 : 0);
+         native++) {
+      code_ += native ? "inline size_t {{NATIVE_NAME}}::Hash() const {"
+                      : "inline size_t {{STRUCT_NAME}}::Hash() const {";
+      code_ += "  uint64_t _h = 0;";
+      for (auto it = struct_def.fields.vec.begin();
+           it != struct_def.fields.vec.end(); ++it) {
+        const auto &field = **it;
+        if (field.deprecated) { continue; }
+        const auto statement = GenHashField(struct_def, field, native != 0);
+        if (!statement.empty()) code_ += "  " + statement;
+      }
+      code_ += "  return static_cast<size_t>(_h);";
+      code_ += "}";
+      code_ += "";
+    }
+
+    code_ += "inline bool {{STRUCT_NAME}}::Equals(const {{STRUCT_NAME}} &_o) "
+             "const {";
+    std::string equals;
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      if (field.deprecated) { continue; }
+      const auto expression = GenEqualsField(field);
+      if (expression.empty()) continue;
+      equals += (equals.empty() ? "" : " &&\n         ") + expression;
+    }
+    if (equals.empty()) {
+      code_ += "  (void)_o;";
+      code_ += "  return true;";
+    } else {
+      code_ += "  return " + equals + ";";
     }
+    code_ += "}";
+    code_ += "";
+  }
+
+  // Generate a function returning at most how many bytes CreateX adds to a
+  // FlatBufferBuilder for an object, of the form:
+  //   size_t _size = <the table and vtable, and fixed costs of its fields>;
+  //   _size += _o.field.size() * <element size>;
+  //   ...
+  // which assumes nothing about alignment or vtable sharing.
+  void GenPackedSizeUpperBound(const StructDef &struct_def) {
+    const size_t num_fields = struct_def.fields.vec.size();
+    // The soffset to the vtable, the vtable itself, and the scratch space
+    // used for the vtable and the fields while building.
+    size_t fixed = sizeof(soffset_t) + sizeof(soffset_t) - 1 +
+                   sizeof(voffset_t) * (2 + num_fields) +
+                   sizeof(uoffset_t) + 8 * num_fields;
+    std::string code;
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      if (field.deprecated) { continue; }
+      const auto &type = field.value.type;
+      fixed += InlineSize(type) + InlineAlignment(type) - 1;
+      auto name = Name(field);
+      switch (type.base_type) {
+        case BASE_TYPE_STRING: {
+          // Length, terminator and padding.
+          fixed += sizeof(uoffset_t) + 1 + sizeof(uoffset_t) - 1;
+          code += "  _size += _o." + name + ".length();\n";
+          break;
+        }
+        case BASE_TYPE_VECTOR: {
+          const auto element = type.VectorType();
+          fixed += sizeof(uoffset_t) + sizeof(uoffset_t) - 1 +
+                   InlineAlignment(element) - 1;
+          if (type.element == BASE_TYPE_UTYPE) {
+            name = StripUnionType(name);
+          }
+          code += "  _size += _o." + name + ".size() * " +
+                  NumToString(InlineSize(element)) + ";\n";
+          std::string element_size;
+          if (type.element == BASE_TYPE_STRING) {
+            element_size = "_o." + name + "[_i].length() + " +
+                           NumToString(2 * sizeof(uoffset_t));
+          } else if (type.element == BASE_TYPE_UNION) {
+            element_size = "_o." + name + "[_i].GetPackedSizeUpperBound()";
+          } else if (element.base_type == BASE_TYPE_STRUCT &&
+                     !IsStruct(element)) {
+            element_size = "GetPackedSizeUpperBound(*_o." + name + "[_i])";
+          }
+          if (!element_size.empty()) {
+            code += "  for (size_t _i = 0; _i < _o." + name +
+                    ".size(); _i++) {\n";
+            code += "    _size += " + element_size + ";\n";
+            code += "  }\n";
+          }
+          break;
+        }
+        case BASE_TYPE_STRUCT: {
+          if (IsStruct(type)) { break; }
+          if (field.native_inline) {
+            code += "  _size += GetPackedSizeUpperBound(_o." + name + ");\n";
+          } else {
+            code += "  if (_o." + name + ") _size += GetPackedSizeUpperBound(*_o." +
+                    name + ");\n";
+          }
+          break;
+        }
+        case BASE_TYPE_UNION: {
+          code += "  _size += _o." + name + ".GetPackedSizeUpperBound();\n";
+          break;
+        }
+        default: break;
+      }
+    }
+    code_ += "inline " + TableSizeBoundSignature(struct_def, parser_.opts) +
+             " {";
+    code_ += "  (void)_o;";
+    code_ += "  size_t _size = " + NumToString(fixed) + ";";
+    code_ += code + "  return _size;";
+    code_ += "}";
+    code_ += "";
   }
 
   static void GenPadding(
@@ -16,15 +16,30 @@
 
 // independent from idl_parser, since this code is not needed for most clients
 
+#include <cerrno>
+#include <ostream>
+
+// clang-format off
+#ifndef FLATBUFFERS_CPP98_STL
+  #include <thread>
+#endif
+// clang-format on
+
 #include "flatbuffers/flatbuffers.h"
 #include "flatbuffers/flexbuffers.h"
 #include "flatbuffers/idl.h"
 #include "flatbuffers/util.h"
 
-namespace flatbuffers {
+// clang-format off
+#ifdef _WIN32
+  #include <io.h>
+  #include <limits.h>
+#else
+  #include <unistd.h>
+#endif
+// clang-format on
 
-static bool GenStruct(const StructDef &struct_def, const Table *table,
-                      int indent, const IDLOptions &opts, std::string *_text);
+namespace flatbuffers {
 
 // If indentation is less than 0, that indicates we don't want any newlines
 // either.
@@ -43,14 +58,110 @@ void OutputIdentifier(const std::string &name, const IDLOptions &opts,
   if (opts.strict_json) text += "\"";
 }
 
-// Print (and its template specialization below for pointers) generate text
-// for a single FlatBuffer value into JSON format.
-// The general case for scalars:
+// Append a number, formatted in place.
+template<typename T> void PrintNumber(T val, std::string *text) {
+  char buf[24];
+  auto end = buf + sizeof(buf);
+  auto magnitude = static_cast<uint64_t>(val);
+  auto negative =
+      !flatbuffers::is_unsigned<T>::value && static_cast<int64_t>(val) < 0;
+  if (negative) magnitude = 0 - magnitude;
+  auto p = float_conversion::FormatDecimal(magnitude, end);
+  if (negative) *--p = '-';
+  text->append(p, end);
+}
+template<> void PrintNumber<float>(float val, std::string *text) {
+  char buf[kMaxShortestFloatLength];
+  text->append(buf, static_cast<size_t>(FloatToShortestString(val, buf)));
+}
+template<> void PrintNumber<double>(double val, std::string *text) {
+  char buf[kMaxShortestFloatLength];
+  text->append(buf, static_cast<size_t>(FloatToShortestString(val, buf)));
+}
+
+// Keeps all the text in its buffer, for generating text into a string.
+class StringTextSink : public TextSink {
+ public:
+  StringTextSink() : TextSink(0) {
+    buffer_size_ = flatbuffers::numeric_limits<size_t>::max();
+  }
+
+  bool Write(const char *, size_t) FLATBUFFERS_OVERRIDE { return true; }
+};
+
+// The options that change how fields are printed in a plan.
+static int PlanOptions(const IDLOptions &opts) {
+  return (opts.strict_json ? 1 : 0) | (opts.protobuf_ascii_alike ? 2 : 0) |
+         (opts.output_default_scalars_in_json ? 4 : 0);
+}
+
+const JsonPrinter::StructPlan *JsonPrinter::GetPlan(
+    const StructDef &struct_def) {
+  auto it = plans_.find(&struct_def);
+  if (it != plans_.end()) return &it->second;
+  // Add the plan before filling it in, so recursive types can refer to it.
+  auto &plan = plans_[&struct_def];
+  plan.def = &struct_def;
+  const auto &opts = parser_.opts;
+  plan.fields.resize(struct_def.fields.vec.size());
+  for (size_t i = 0; i < plan.fields.size(); i++) {
+    auto &fd = *struct_def.fields.vec[i];
+    auto &field = plan.fields[i];
+    field.def = &fd;
+    field.struct_plan = nullptr;
+    field.offset = fd.value.offset;
+    field.output_anyway = opts.output_default_scalars_in_json &&
+                          IsScalar(fd.value.type.base_type) && !fd.deprecated;
+    OutputIdentifier(fd.name, opts, &field.key);
+    if (!opts.protobuf_ascii_alike ||
+        (fd.value.type.base_type != BASE_TYPE_STRUCT &&
+         fd.value.type.base_type != BASE_TYPE_VECTOR))
+      field.key += ":";
+    field.key += " ";
+    field.default_value.integer = 0;
+    switch (fd.value.type.base_type) {
+      case BASE_TYPE_FLOAT:
+      case BASE_TYPE_DOUBLE:
+        field.default_value.real = fd.value.GetValue<double>();
+        break;
+      default:
+        if (IsScalar(fd.value.type.base_type)) {
+          field.default_value.integer = fd.value.GetValue<int64_t>();
+        }
+        break;
+    }
+  }
+  for (auto fit = plan.fields.begin(); fit != plan.fields.end(); ++fit) {
+    auto &fd = *fit->def;
+    if (fd.nested_flatbuffer) {
+      fit->struct_plan = GetPlan(*fd.nested_flatbuffer);
+    } else if (fd.value.type.struct_def &&
+               fd.value.type.base_type != BASE_TYPE_UNION) {
+      fit->struct_plan = GetPlan(*fd.value.type.struct_def);
+    }
+  }
+  return &plan;
+}
+
+// Append a comma (if separate), a newline and indent spaces, in one go.
+void JsonPrinter::NewLineIndent(bool separate, int indent) {
+  auto comma = parser_.opts.protobuf_ascii_alike ? 0 : 1;
+  auto newline = parser_.opts.indent_step >= 0 ? 1 : 0;
+  auto size = static_cast<size_t>(comma + newline + indent);
+  if (separators_.size() < size) separators_.resize(size, ' ');
+  if (separate) {
+    sink_->buffer_.append(separators_.data(), size);
+  } else {
+    sink_->buffer_.append(separators_.data() + comma, size - comma);
+  }
+}
+
+// PrintScalar, PrintVector and PrintPointer generate text for a single
+// FlatBuffer value into JSON format.
 template<typename T>
-bool Print(T val, Type type, int /*indent*/, Type * /*union_type*/,
-           const IDLOptions &opts, std::string *_text) {
-  std::string &text = *_text;
-  if (type.enum_def && opts.output_enum_identifiers) {
+bool JsonPrinter::PrintScalar(T val, const Type &type) {
+  std::string &text = sink_->buffer_;
+  if (type.enum_def && parser_.opts.output_enum_identifiers) {
     auto enum_val = type.enum_def->ReverseLookup(static_cast<int64_t>(val));
     if (enum_val) {
       text += "\"";
@@ -63,7 +174,7 @@ bool Print(T val, Type type, int /*indent*/, Type * /*union_type*/,
   if (type.base_type == BASE_TYPE_BOOL) {
     text += val != 0 ? "true" : "false";
   } else {
-    text += NumToString(val);
+    PrintNumber(val, &text);
   }
 
   return true;
@@ -71,71 +182,167 @@ bool Print(T val, Type type, int /*indent*/, Type * /*union_type*/,
 
 // Print a vector a sequence of JSON values, comma separated, wrapped in "[]".
 template<typename T>
-bool PrintVector(const Vector<T> &v, Type type, int indent,
-                 const IDLOptions &opts, std::string *_text) {
-  std::string &text = *_text;
+bool JsonPrinter::PrintVector(const Vector<T> &v, const Type &type,
+                              const StructPlan * /*element_plan*/,
+                              int indent) {
+  const auto &opts = parser_.opts;
+  std::string &text = sink_->buffer_;
   text += "[";
-  text += NewLine(opts);
+  if (!v.size()) text += NewLine(opts);
   for (uoffset_t i = 0; i < v.size(); i++) {
-    if (i) {
-      if (!opts.protobuf_ascii_alike) text += ",";
-      text += NewLine(opts);
-    }
-    text.append(indent + Indent(opts), ' ');
-    if (IsStruct(type)) {
-      if (!Print(v.GetStructFromOffset(i * type.struct_def->bytesize), type,
-                 indent + Indent(opts), nullptr, opts, _text)) {
-        return false;
-      }
-    } else {
-      if (!Print(v[i], type, indent + Indent(opts), nullptr, opts, _text)) {
-        return false;
-      }
-    }
+    if (!sink_->Flush(sink_->buffer_size_)) return false;
+    NewLineIndent(i != 0, indent + Indent(opts));
+    if (!PrintScalar(v[i], type)) return false;
   }
-  text += NewLine(opts);
-  text.append(indent, ' ');
+  NewLineIndent(false, indent);
   text += "]";
   return true;
 }
 
-// Specialization of Print above for pointer types.
+// Elements that are structs, tables or strings.
 template<>
-bool Print<const void *>(const void *val, Type type, int indent,
-                         Type *union_type, const IDLOptions &opts,
-                         std::string *_text) {
+bool JsonPrinter::PrintVector<Offset<void>>(const Vector<Offset<void>> &v,
+                                            const Type &type,
+                                            const StructPlan *element_plan,
+                                            int indent) {
+  // Vectors of tables with more elements than this are printed in parallel,
+  // in chunks of at least this many.
+  static const uoffset_t kChunkElements = 1024;
+  const auto &opts = parser_.opts;
+  std::string &text = sink_->buffer_;
+  text += "[";
+  if (!v.size()) text += NewLine(opts);
+  if (!worker_ && opts.num_threads > 1 && v.size() > kChunkElements &&
+      type.base_type == BASE_TYPE_STRUCT && !type.struct_def->fixed) {
+    if (!PrintElementsInParallel(v, type, kChunkElements, indent)) {
+      return false;
+    }
+  } else if (!PrintElements(v, type, element_plan, 0, v.size(), indent)) {
+    return false;
+  }
+  NewLineIndent(false, indent);
+  text += "]";
+  return true;
+}
+
+// Print elements [begin, end) of a vector, as part of PrintVector above.
+bool JsonPrinter::PrintElements(const Vector<Offset<void>> &v,
+                                const Type &type,
+                                const StructPlan *element_plan,
+                                uoffset_t begin, uoffset_t end, int indent) {
+  const auto &opts = parser_.opts;
+  for (auto i = begin; i < end; i++) {
+    if (!sink_->Flush(sink_->buffer_size_)) return false;
+    NewLineIndent(i != 0, indent + Indent(opts));
+    auto val = IsStruct(type) ? static_cast<const void *>(v.GetStructFromOffset(
+                                    i * type.struct_def->bytesize))
+                              : v[i];
+    if (!PrintPointer(val, type, element_plan, nullptr,
+                      indent + Indent(opts))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void JsonPrinter::PrintChunk(JsonPrinter *worker,
+                             const Vector<Offset<void>> *v, const Type *type,
+                             uoffset_t begin, uoffset_t end, int indent,
+                             uint8_t *ok) {
+  *ok = worker->PrintElements(*v, *type, worker->GetPlan(*type->struct_def),
+                              begin, end, indent);
+}
+
+// Print the elements of a vector of tables in up to opts.num_threads
+// contiguous chunks of at least min_chunk_elements each, with a thread per
+// chunk, started once. Each chunk is printed by a worker (with its own
+// plans): the first straight into sink_, the others into a buffer of their
+// own, which is appended to sink_ in order once that thread is done.
+bool JsonPrinter::PrintElementsInParallel(const Vector<Offset<void>> &v,
+                                          const Type &type,
+                                          uoffset_t min_chunk_elements,
+                                          int indent) {
+  size_t num_chunks = v.size() / min_chunk_elements;
+  num_chunks = std::max(std::min(num_chunks, parser_.opts.num_threads),
+                        static_cast<size_t>(1));
+  std::vector<StringTextSink> sinks(num_chunks);
+  std::vector<JsonPrinter *> workers;
+  std::vector<uoffset_t> bounds;
+  for (size_t t = 0; t < num_chunks; t++) {
+    workers.push_back(new JsonPrinter(parser_));
+    workers.back()->separators_ = separators_;
+    workers.back()->sink_ = t ? &sinks[t] : sink_;
+    workers.back()->worker_ = true;
+    bounds.push_back(static_cast<uoffset_t>(v.size() * t / num_chunks));
+  }
+  bounds.push_back(v.size());
+  std::vector<uint8_t> results(num_chunks, 1);
+  // clang-format off
+  #ifndef FLATBUFFERS_CPP98_STL
+    std::vector<std::thread> threads;
+    for (size_t t = 1; t < num_chunks; t++) {
+      threads.push_back(std::thread(PrintChunk, workers[t], &v, &type,
+                                    bounds[t], bounds[t + 1], indent,
+                                    &results[t]));
+    }
+    PrintChunk(workers[0], &v, &type, bounds[0], bounds[1], indent,
+               &results[0]);
+    for (auto it = threads.begin(); it != threads.end(); ++it) it->join();
+  #else
+    for (size_t t = 0; t < num_chunks; t++) {
+      PrintChunk(workers[t], &v, &type, bounds[t], bounds[t + 1], indent,
+                 &results[t]);
+    }
+  #endif
+  // clang-format on
+  auto ok = results[0] != 0;
+  for (size_t t = 1; t < num_chunks && ok; t++) {
+    sink_->buffer_ += sinks[t].buffer_;
+    std::string().swap(sinks[t].buffer_);
+    ok = results[t] && sink_->Flush(sink_->buffer_size_);
+  }
+  for (auto it = workers.begin(); it != workers.end(); ++it) delete *it;
+  return ok;
+}
+
+bool JsonPrinter::PrintPointer(const void *val, const Type &type,
+                               const StructPlan *struct_plan,
+                               const Type *union_type, int indent) {
+  const auto &opts = parser_.opts;
   switch (type.base_type) {
     case BASE_TYPE_UNION:
       // If this assert hits, you have an corrupt buffer, a union type field
       // was not present or was out of range.
       FLATBUFFERS_ASSERT(union_type);
-      return Print<const void *>(val, *union_type, indent, nullptr, opts,
-                                 _text);
+      return PrintPointer(
+          val, *union_type,
+          union_type->struct_def ? GetPlan(*union_type->struct_def) : nullptr,
+          nullptr, indent);
     case BASE_TYPE_STRUCT:
-      if (!GenStruct(*type.struct_def, reinterpret_cast<const Table *>(val),
-                     indent, opts, _text)) {
+      if (!PrintStruct(*struct_plan, reinterpret_cast<const Table *>(val),
+                       indent)) {
         return false;
       }
       break;
     case BASE_TYPE_STRING: {
       auto s = reinterpret_cast<const String *>(val);
-      if (!EscapeString(s->c_str(), s->Length(), _text, opts.allow_non_utf8,
-                        opts.natural_utf8)) {
+      if (!EscapeString(s->c_str(), s->Length(), &sink_->buffer_,
+                        opts.allow_non_utf8, opts.natural_utf8)) {
         return false;
       }
       break;
     }
-    case BASE_TYPE_VECTOR:
-      type = type.VectorType();
+    case BASE_TYPE_VECTOR: {
+      auto element_type = type.VectorType();
       // Call PrintVector above specifically for each element type:
-      switch (type.base_type) {
+      switch (element_type.base_type) {
         // clang-format off
         #define FLATBUFFERS_TD(ENUM, IDLTYPE, \
           CTYPE, JTYPE, GTYPE, NTYPE, PTYPE, RTYPE) \
           case BASE_TYPE_ ## ENUM: \
             if (!PrintVector<CTYPE>( \
                   *reinterpret_cast<const Vector<CTYPE> *>(val), \
-                  type, indent, opts, _text)) { \
+                  element_type, struct_plan, indent)) { \
               return false; \
             } \
             break;
@@ -144,139 +351,238 @@ bool Print<const void *>(const void *val, Type type, int indent,
         // clang-format on
       }
       break;
+    }
     default: FLATBUFFERS_ASSERT(0);
   }
   return true;
 }
 
-template<typename T> static T GetFieldDefault(const FieldDef &fd) {
-  T val;
-  auto check = StringToNumber(fd.value.constant.c_str(), &val);
-  (void)check;
-  FLATBUFFERS_ASSERT(check);
-  return val;
-}
-
 // Generate text for a scalar field.
 template<typename T>
-static bool GenField(const FieldDef &fd, const Table *table, bool fixed,
-                     const IDLOptions &opts, int indent, std::string *_text) {
-  return Print(
-      fixed ? reinterpret_cast<const Struct *>(table)->GetField<T>(
-                  fd.value.offset)
-            : table->GetField<T>(fd.value.offset, GetFieldDefault<T>(fd)),
-      fd.value.type, indent, nullptr, opts, _text);
+bool JsonPrinter::PrintField(const FieldPlan &field, const Table *table,
+                             bool fixed) {
+  T val;
+  if (fixed) {
+    val = reinterpret_cast<const Struct *>(table)->GetField<T>(field.offset);
+  } else {
+    val = table->GetField<T>(
+        field.offset,
+        flatbuffers::is_floating_point<T>::value
+            ? static_cast<T>(field.default_value.real)
+            : static_cast<T>(field.default_value.integer));
+  }
+  return PrintScalar(val, field.def->value.type);
 }
 
-static bool GenStruct(const StructDef &struct_def, const Table *table,
-                      int indent, const IDLOptions &opts, std::string *_text);
-
 // Generate text for non-scalar field.
-static bool GenFieldOffset(const FieldDef &fd, const Table *table, bool fixed,
-                           int indent, Type *union_type, const IDLOptions &opts,
-                           std::string *_text) {
+bool JsonPrinter::PrintFieldOffset(const FieldPlan &field, const Table *table,
+                                   bool fixed, const Type *union_type,
+                                   int indent) {
+  const auto &fd = *field.def;
   const void *val = nullptr;
   if (fixed) {
     // The only non-scalar fields in structs are structs.
     FLATBUFFERS_ASSERT(IsStruct(fd.value.type));
     val = reinterpret_cast<const Struct *>(table)->GetStruct<const void *>(
-        fd.value.offset);
+        field.offset);
   } else if (fd.flexbuffer) {
-    auto vec = table->GetPointer<const Vector<uint8_t> *>(fd.value.offset);
+    auto vec = table->GetPointer<const Vector<uint8_t> *>(field.offset);
     auto root = flexbuffers::GetRoot(vec->data(), vec->size());
-    root.ToString(true, opts.strict_json, *_text);
+    root.ToString(true, parser_.opts.strict_json, sink_->buffer_);
     return true;
   } else if (fd.nested_flatbuffer) {
-    auto vec = table->GetPointer<const Vector<uint8_t> *>(fd.value.offset);
+    auto vec = table->GetPointer<const Vector<uint8_t> *>(field.offset);
     auto root = GetRoot<Table>(vec->data());
-    return GenStruct(*fd.nested_flatbuffer, root, indent, opts, _text);
+    return PrintStruct(*field.struct_plan, root, indent);
   } else {
     val = IsStruct(fd.value.type)
-              ? table->GetStruct<const void *>(fd.value.offset)
-              : table->GetPointer<const void *>(fd.value.offset);
+              ? table->GetStruct<const void *>(field.offset)
+              : table->GetPointer<const void *>(field.offset);
   }
-  return Print(val, fd.value.type, indent, union_type, opts, _text);
+  return PrintPointer(val, fd.value.type, field.struct_plan, union_type,
+                      indent);
 }
 
 // Generate text for a struct or table, values separated by commas, indented,
 // and bracketed by "{}"
-static bool GenStruct(const StructDef &struct_def, const Table *table,
-                      int indent, const IDLOptions &opts, std::string *_text) {
-  std::string &text = *_text;
+bool JsonPrinter::PrintStruct(const StructPlan &plan, const Table *table,
+                              int indent) {
+  const auto &opts = parser_.opts;
+  std::string &text = sink_->buffer_;
+  auto fixed = plan.def->fixed;
   text += "{";
   int fieldout = 0;
-  Type *union_type = nullptr;
-  for (auto it = struct_def.fields.vec.begin();
-       it != struct_def.fields.vec.end(); ++it) {
-    FieldDef &fd = **it;
-    auto is_present = struct_def.fixed || table->CheckField(fd.value.offset);
-    auto output_anyway = opts.output_default_scalars_in_json &&
-                         IsScalar(fd.value.type.base_type) && !fd.deprecated;
-    if (is_present || output_anyway) {
-      if (fieldout++) {
-        if (!opts.protobuf_ascii_alike) text += ",";
-      }
-      text += NewLine(opts);
-      text.append(indent + Indent(opts), ' ');
-      OutputIdentifier(fd.name, opts, _text);
-      if (!opts.protobuf_ascii_alike ||
-          (fd.value.type.base_type != BASE_TYPE_STRUCT &&
-           fd.value.type.base_type != BASE_TYPE_VECTOR))
-        text += ":";
-      text += " ";
-      switch (fd.value.type.base_type) {
-          // clang-format off
-          #define FLATBUFFERS_TD(ENUM, IDLTYPE, \
-            CTYPE, JTYPE, GTYPE, NTYPE, PTYPE, RTYPE) \
-            case BASE_TYPE_ ## ENUM: \
-              if (!GenField<CTYPE>(fd, table, struct_def.fixed, \
-                                   opts, indent + Indent(opts), _text)) { \
-                return false; \
-              } \
-              break;
-          FLATBUFFERS_GEN_TYPES_SCALAR(FLATBUFFERS_TD)
-        #undef FLATBUFFERS_TD
-        // Generate drop-thru case statements for all pointer types:
+  const Type *union_type = nullptr;
+  for (auto it = plan.fields.begin(); it != plan.fields.end(); ++it) {
+    const auto &field = *it;
+    if (!fixed && !field.output_anyway && !table->CheckField(field.offset)) {
+      continue;
+    }
+    if (!sink_->Flush(sink_->buffer_size_)) return false;
+    NewLineIndent(fieldout++ != 0, indent + Indent(opts));
+    text += field.key;
+    auto base_type = field.def->value.type.base_type;
+    switch (base_type) {
+        // clang-format off
         #define FLATBUFFERS_TD(ENUM, IDLTYPE, \
           CTYPE, JTYPE, GTYPE, NTYPE, PTYPE, RTYPE) \
-          case BASE_TYPE_ ## ENUM:
-          FLATBUFFERS_GEN_TYPES_POINTER(FLATBUFFERS_TD)
-        #undef FLATBUFFERS_TD
-            if (!GenFieldOffset(fd, table, struct_def.fixed, indent + Indent(opts),
-                                union_type, opts, _text)) {
-              return false;
-            }
+          case BASE_TYPE_ ## ENUM: \
+            if (!PrintField<CTYPE>(field, table, fixed)) return false; \
             break;
-          // clang-format on
-      }
-      if (fd.value.type.base_type == BASE_TYPE_UTYPE) {
-        auto enum_val = fd.value.type.enum_def->ReverseLookup(
-            table->GetField<uint8_t>(fd.value.offset, 0));
-        union_type = enum_val ? &enum_val->union_type : nullptr;
-      }
+        FLATBUFFERS_GEN_TYPES_SCALAR(FLATBUFFERS_TD)
+      #undef FLATBUFFERS_TD
+      // Generate drop-thru case statements for all pointer types:
+      #define FLATBUFFERS_TD(ENUM, IDLTYPE, \
+        CTYPE, JTYPE, GTYPE, NTYPE, PTYPE, RTYPE) \
+        case BASE_TYPE_ ## ENUM:
+        FLATBUFFERS_GEN_TYPES_POINTER(FLATBUFFERS_TD)
+      #undef FLATBUFFERS_TD
+          if (!PrintFieldOffset(field, table, fixed, union_type,
+                                indent + Indent(opts))) {
+            return false;
+          }
+          break;
+        // clang-format on
+    }
+    if (base_type == BASE_TYPE_UTYPE) {
+      auto enum_val = field.def->value.type.enum_def->ReverseLookup(
+          table->GetField<uint8_t>(field.offset, 0));
+      union_type = enum_val ? &enum_val->union_type : nullptr;
     }
   }
-  text += NewLine(opts);
-  text.append(indent, ' ');
+  NewLineIndent(false, indent);
   text += "}";
   return true;
 }
 
-// Generate a text representation of a flatbuffer in JSON format.
+// Generate a text representation of a flatbuffer in JSON format, appending
+// it to the buffer of sink.
+bool JsonPrinter::Generate(const void *flatbuffer, TextSink *sink) {
+  FLATBUFFERS_ASSERT(parser_.root_struct_def_);  // call SetRootType()
+  auto plan_options = PlanOptions(parser_.opts);
+  if (plan_options != plan_options_) {
+    plans_.clear();
+    plan_options_ = plan_options;
+  }
+  separators_.assign(parser_.opts.protobuf_ascii_alike ? "" : ",");
+  separators_ += NewLine(parser_.opts);
+  auto plan = GetPlan(*parser_.root_struct_def_);
+  auto root = parser_.opts.size_prefixed ? GetSizePrefixedRoot<Table>(flatbuffer)
+                                         : GetRoot<Table>(flatbuffer);
+  sink_ = sink;
+  auto ok = PrintStruct(*plan, root, 0);
+  sink_ = nullptr;
+  if (ok) sink->buffer_ += NewLine(parser_.opts);
+  return ok;
+}
+
+bool JsonPrinter::Print(const void *flatbuffer) {
+  StringTextSink sink;
+  sink.buffer_.swap(text_);
+  sink.buffer_.clear();
+  sink.buffer_.reserve(1024);  // Reduce amount of inevitable reallocs.
+  auto ok = Generate(flatbuffer, &sink);
+  sink.buffer_.swap(text_);
+  return ok;
+}
+
+bool JsonPrinter::Print(const void *flatbuffer, TextSink *sink) {
+  if (!Generate(flatbuffer, sink)) {
+    sink->buffer_.clear();
+    return false;
+  }
+  return sink->Flush();
+}
+
+// Borrows one of the printers kept in parser.text_printers_, or makes one if
+// they're all in use by other threads, and returns it when done.
+class PooledPrinter {
+ public:
+  explicit PooledPrinter(const Parser &parser) : parser_(parser) {
+    // clang-format off
+    #ifndef FLATBUFFERS_CPP98_STL
+      std::lock_guard<std::mutex> lock(parser.text_printers_mutex_);
+    #endif
+    // clang-format on
+    if (parser.text_printers_.empty()) {
+      printer_ = new JsonPrinter(parser);
+    } else {
+      printer_ = parser.text_printers_.back();
+      parser.text_printers_.pop_back();
+    }
+  }
+
+  ~PooledPrinter() {
+    // clang-format off
+    #ifndef FLATBUFFERS_CPP98_STL
+      std::lock_guard<std::mutex> lock(parser_.text_printers_mutex_);
+    #endif
+    // clang-format on
+    parser_.text_printers_.push_back(printer_);
+  }
+
+  JsonPrinter *operator->() const { return printer_; }
+
+ private:
+  const Parser &parser_;
+  JsonPrinter *printer_;
+};
+
 bool GenerateText(const Parser &parser, const void *flatbuffer,
                   std::string *_text) {
-  std::string &text = *_text;
-  FLATBUFFERS_ASSERT(parser.root_struct_def_);  // call SetRootType()
-  text.reserve(1024);               // Reduce amount of inevitable reallocs.
-  auto root = parser.opts.size_prefixed ?
-      GetSizePrefixedRoot<Table>(flatbuffer) : GetRoot<Table>(flatbuffer);
-  if (!GenStruct(*parser.root_struct_def_, root, 0, parser.opts, _text)) {
-    return false;
+  PooledPrinter printer(parser);
+  if (!printer->Print(flatbuffer)) return false;
+  if (_text->empty()) {
+    _text->swap(printer->text_);
+  } else {
+    *_text += printer->text_;
   }
-  text += NewLine(parser.opts);
   return true;
 }
 
+bool GenerateText(const Parser &parser, const void *flatbuffer,
+                  TextSink *sink) {
+  PooledPrinter printer(parser);
+  return printer->Print(flatbuffer, sink);
+}
+
+TextSink::TextSink(size_t buffer_size) : buffer_size_(buffer_size) {
+  // Room for the text that follows the last check for a full buffer.
+  buffer_.reserve(buffer_size + buffer_size / 4);
+}
+
+bool TextSink::Flush(size_t min_size) {
+  if (buffer_.empty() || buffer_.size() < min_size) return true;
+  auto ok = Write(buffer_.data(), buffer_.size());
+  buffer_.clear();
+  return ok;
+}
+
+bool FileDescriptorTextSink::Write(const char *data, size_t size) {
+  while (size) {
+    // clang-format off
+    #ifdef _WIN32
+      auto written = _write(fd_, data, static_cast<unsigned int>(
+          std::min(size, static_cast<size_t>(INT_MAX))));
+    #else
+      auto written = write(fd_, data, size);
+    #endif
+    // clang-format on
+    if (written < 0) {
+      if (errno == EINTR) continue;
+      return false;
+    }
+    data += written;
+    size -= static_cast<size_t>(written);
+  }
+  return true;
+}
+
+bool StreamTextSink::Write(const char *data, size_t size) {
+  stream_.write(data, static_cast<std::streamsize>(size));
+  return !stream_.fail();
+}
+
 std::string TextFileName(const std::string &path,
                          const std::string &file_name) {
   return path + file_name + ".json";
@@ -285,10 +591,15 @@ std::string TextFileName(const std::string &path,
 bool GenerateTextFile(const Parser &parser, const std::string &path,
                       const std::string &file_name) {
   if (!parser.builder_.GetSize() || !parser.root_struct_def_) return true;
+  return GenerateTextFile(parser, parser.builder_.GetBufferPointer(), path,
+                          file_name);
+}
+
+bool GenerateTextFile(const Parser &parser, const void *flatbuffer,
+                      const std::string &path, const std::string &file_name) {
+  if (!parser.root_struct_def_) return true;
   std::string text;
-  if (!GenerateText(parser, parser.builder_.GetBufferPointer(), &text)) {
-    return false;
-  }
+  if (!GenerateText(parser, flatbuffer, &text)) { return false; }
   return flatbuffers::SaveFile(TextFileName(path, file_name).c_str(), text,
                                false);
 }
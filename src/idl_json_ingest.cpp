@@ -0,0 +1,1079 @@
+/*
+ * Copyright 2018 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cfloat>
+
+// clang-format off
+#ifndef FLATBUFFERS_CPP98_STL
+  #include <thread>
+#endif
+// clang-format on
+
+#include "flatbuffers/idl.h"
+#include "flatbuffers/record_stream.h"
+#include "flatbuffers/util.h"
+
+// clang-format off
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #include <emmintrin.h>
+  #ifdef _MSC_VER
+    #include <intrin.h>
+  #endif
+  #define FLATBUFFERS_JSON_INGEST_SSE2 1
+#endif
+
+// Converting numbers with a single multiplication or division is only exact
+// if intermediate results aren't kept at a higher precision.
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+  #define FLATBUFFERS_JSON_INGEST_FAST_FLOAT 1
+#endif
+// clang-format on
+
+// All the parse functions in here return false when the input is either
+// invalid or uses a feature they don't implement, in which case Parse() hands
+// the input to a Parser. They mirror the way Parser serializes values exactly,
+// so the result is the same either way.
+
+namespace flatbuffers {
+
+static const voffset_t kNoFieldOffset =
+    static_cast<voffset_t>(~(static_cast<voffset_t>(0U)));
+
+static const double kExactPowersOf10[] = {
+  1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static const float kExactPowersOf10f[] = { 1e0f, 1e1f, 1e2f, 1e3f,
+                                           1e4f, 1e5f, 1e6f, 1e7f,
+                                           1e8f, 1e9f, 1e10f };
+
+static inline bool IsWhitespace(char c) {
+  return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+static inline bool IsIdentifierStart(char c) {
+  return is_alpha(c) || (c == '_');
+}
+
+static inline bool IsIdentifierChar(char c) {
+  return IsIdentifierStart(c) || is_digit(c);
+}
+
+// Characters that make up number tokens, or follow them in invalid ones.
+static inline bool IsNumberChar(char c) {
+  return IsIdentifierChar(c) || c == '.' || c == '+' || c == '-';
+}
+
+static inline bool IsNullToken(const char *s) {
+  return s[0] == 'n' && s[1] == 'u' && s[2] == 'l' && s[3] == 'l' &&
+         !IsIdentifierChar(s[4]);
+}
+
+// clang-format off
+#ifdef FLATBUFFERS_JSON_INGEST_SSE2
+  static inline int FirstSetBit(int mask) {
+    #ifdef _MSC_VER
+      unsigned long index;
+      _BitScanForward(&index, static_cast<unsigned long>(mask));
+      return static_cast<int>(index);
+    #else
+      return __builtin_ctz(static_cast<unsigned int>(mask));
+    #endif
+  }
+#endif
+// clang-format on
+
+// Get the binary form of a parsed value, see Value::integer.
+template<typename T, typename V> inline T GetScalar(const V &val) {
+  return flatbuffers::is_floating_point<T>::value
+             ? static_cast<T>(val.real)
+             : static_cast<T>(val.integer);
+}
+
+// Whether val fits integer type "type", like StringToNumber checks.
+static bool IntegerFits(BaseType type, int64_t val) {
+  switch (type) {
+    case BASE_TYPE_BOOL: return val >= 0 && val <= 1;
+    case BASE_TYPE_UTYPE:
+    case BASE_TYPE_UCHAR: return val >= 0 && val <= 0xFF;
+    case BASE_TYPE_CHAR: return val >= -0x80 && val <= 0x7F;
+    case BASE_TYPE_SHORT: return val >= -0x8000 && val <= 0x7FFF;
+    case BASE_TYPE_USHORT: return val >= 0 && val <= 0xFFFF;
+    case BASE_TYPE_INT: return val >= -0x7FFFFFFFLL - 1 && val <= 0x7FFFFFFF;
+    case BASE_TYPE_UINT: return val >= 0 && val <= 0xFFFFFFFFLL;
+    case BASE_TYPE_LONG: return true;
+    case BASE_TYPE_ULONG: return val >= 0;
+    default: return false;
+  }
+}
+
+static bool IsValidUTF8(const char *s, size_t len) {
+  const char *end = s + len;
+  while (s < end) {
+    if (FromUTF8(&s) < 0) return false;
+  }
+  return s == end;
+}
+
+static bool ParseHexDigits(const char **s, int nibbles, uint32_t *val) {
+  *val = 0;
+  for (int i = 0; i < nibbles; i++) {
+    auto c = (*s)[i];
+    if (!is_xdigit(c)) return false;
+    *val = *val * 16 + static_cast<uint32_t>(
+                           is_digit(c) ? c - '0' : (c & 0xDF) - 'A' + 10);
+  }
+  *s += nibbles;
+  return true;
+}
+
+JsonIngester::JsonIngester(const Parser &parser)
+    : size_prefixed_(parser.opts.size_prefixed),
+      parser_(parser),
+      cursor_(nullptr),
+      end_(nullptr),
+      depth_(0) {
+  builder_.ForceDefaults(parser.opts.force_defaults);
+  auto &structs = parser.structs_.vec;
+  plans_.resize(structs.size());
+  for (size_t i = 0; i < structs.size(); i++) {
+    plans_by_def_[structs[i]] = &plans_[i];
+  }
+  for (size_t i = 0; i < structs.size(); i++) {
+    auto &plan = plans_[i];
+    plan.def = structs[i];
+    auto &fields = plan.def->fields.vec;
+    for (auto it = fields.begin(); it != fields.end(); ++it) {
+      auto field = *it;
+      auto &type = field->value.type;
+      FieldPlan field_plan;
+      field_plan.def = field;
+      field_plan.struct_plan = nullptr;
+      field_plan.hashed = field->attributes.Lookup("hash") != nullptr;
+      auto struct_def = type.base_type == BASE_TYPE_VECTOR
+                            ? (type.element == BASE_TYPE_STRUCT
+                                   ? type.struct_def
+                                   : nullptr)
+                            : type.struct_def;
+      if (struct_def) {
+        auto plan_it = plans_by_def_.find(struct_def);
+        if (plan_it != plans_by_def_.end())
+          field_plan.struct_plan = plan_it->second;
+      }
+      field_plan.fast =
+          !field->flexbuffer && !field->nested_flatbuffer &&
+          !(type.base_type == BASE_TYPE_VECTOR &&
+            type.element == BASE_TYPE_UNION) &&
+          (!struct_def || field_plan.struct_plan);
+      plan.fields.push_back(field_plan);
+      plan.by_name.push_back(plan.by_name.size());
+      if (field->required) plan.required.push_back(field);
+    }
+    std::sort(plan.by_name.begin(), plan.by_name.end(),
+              [&](size_t a, size_t b) {
+                return fields[a]->name < fields[b]->name;
+              });
+  }
+}
+
+bool JsonIngester::Parse(const char *json) {
+  builder_.Clear();
+  error_.clear();
+  auto root = parser_.root_struct_def_;
+  auto plan_it = plans_by_def_.find(root);
+  if (!root || root->fixed || plan_it == plans_by_def_.end() ||
+      parser_.opts.protobuf_ascii_alike) {
+    return Fallback(json);
+  }
+  cursor_ = json;
+  depth_ = 0;
+  slots_.clear();
+  struct_bytes_.clear();
+  if (static_cast<unsigned char>(cursor_[0]) == 0xef &&
+      static_cast<unsigned char>(cursor_[1]) == 0xbb &&
+      static_cast<unsigned char>(cursor_[2]) == 0xbf) {
+    cursor_ += 3;
+  }
+  end_ = cursor_ + strlen(cursor_);
+  SkipWhitespace();
+  Slot slot;
+  if (*cursor_ != '{' || !ParseObject(*plan_it->second, &slot)) {
+    return Fallback(json);
+  }
+  // Only whitespace may follow, anything else is left to the Parser.
+  SkipWhitespace();
+  if (*cursor_) return Fallback(json);
+  auto root_offset = Offset<Table>(static_cast<uoffset_t>(slot.integer));
+  auto file_identifier = parser_.file_identifier_.length()
+                             ? parser_.file_identifier_.c_str()
+                             : nullptr;
+  if (size_prefixed_) {
+    builder_.FinishSizePrefixed(root_offset, file_identifier);
+  } else {
+    builder_.Finish(root_offset, file_identifier);
+  }
+  return true;
+}
+
+bool JsonIngester::Fallback(const char *json) {
+  builder_.Clear();
+  // Parse with a Parser that shares the definitions of parser_, like
+  // Parser::ParseNestedFlatbuffer does.
+  auto opts = parser_.opts;
+  opts.size_prefixed = size_prefixed_;
+  Parser parser(opts);
+  parser.enums_ = parser_.enums_;
+  parser.root_struct_def_ = parser_.root_struct_def_;
+  parser.file_identifier_ = parser_.file_identifier_;
+  parser.uses_flexbuffers_ = parser_.uses_flexbuffers_;
+  auto ok = parser.Parse(json);
+  if (ok) {
+    builder_.Swap(parser.builder_);
+  } else {
+    error_ = parser.error_;
+  }
+  // Clean up before destruction, to avoid deleting the shared definitions.
+  parser.enums_.dict.clear();
+  parser.enums_.vec.clear();
+  return ok;
+}
+
+const JsonIngester::FieldPlan *JsonIngester::LookupField(
+    const StructPlan &plan, const char *name, size_t len,
+    size_t *hint) const {
+  // Fields most often come in declaration order (as GenerateText writes
+  // them), so first try the one after the previous match.
+  if (*hint < plan.fields.size()) {
+    auto &field = plan.fields[*hint];
+    if (field.def->name.length() == len &&
+        !memcmp(field.def->name.c_str(), name, len)) {
+      ++*hint;
+      return &field;
+    }
+  }
+  auto it = std::lower_bound(
+      plan.by_name.begin(), plan.by_name.end(), 0,
+      [&](size_t index, int) {
+        return plan.fields[index].def->name.compare(0, std::string::npos, name,
+                                                    len) < 0;
+      });
+  if (it == plan.by_name.end() ||
+      plan.fields[*it].def->name.compare(0, std::string::npos, name, len)) {
+    return nullptr;
+  }
+  *hint = *it + 1;
+  return &plan.fields[*it];
+}
+
+void JsonIngester::SkipWhitespace() {
+  if (!IsWhitespace(*cursor_)) return;
+  // clang-format off
+  #ifdef FLATBUFFERS_JSON_INGEST_SSE2
+    // Indentation makes for long runs of whitespace.
+    while (end_ - cursor_ >= 16) {
+      auto chunk =
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(cursor_));
+      auto ws = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')),
+                       _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n'))),
+          _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\r')),
+                       _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\t'))));
+      auto mask = ~_mm_movemask_epi8(ws) & 0xFFFF;
+      if (mask) {
+        cursor_ += FirstSetBit(mask);
+        return;
+      }
+      cursor_ += 16;
+    }
+  #endif
+  // clang-format on
+  while (IsWhitespace(*cursor_)) cursor_++;
+}
+
+// Reads the string starting at cursor_, storing a pointer to its contents in
+// str, which points into the input unless it contains escape codes, in which
+// case it points into scratch_ (and is only valid until the next call).
+// trivial is set if the string is printable ASCII without escape codes.
+bool JsonIngester::ReadString(const char **str, size_t *len, bool *trivial) {
+  auto quote = *cursor_++;
+  auto start = cursor_;
+  auto ascii = true;
+  for (;;) {
+    // clang-format off
+    #ifdef FLATBUFFERS_JSON_INGEST_SSE2
+      // Find the first quote, backslash, control character or byte >= 0x80
+      // (which are negative, so detected by the same signed comparison).
+      while (end_ - cursor_ >= 16) {
+        auto chunk =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(cursor_));
+        auto special = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(quote)),
+                         _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\'))),
+            _mm_cmplt_epi8(chunk, _mm_set1_epi8(' ')));
+        auto mask = _mm_movemask_epi8(special);
+        if (mask) {
+          cursor_ += FirstSetBit(mask);
+          break;
+        }
+        cursor_ += 16;
+      }
+    #endif
+    // clang-format on
+    while (*cursor_ != quote && *cursor_ != '\\' &&
+           check_in_range(*cursor_, ' ', '\x7F')) {
+      cursor_++;
+    }
+    auto c = *cursor_;
+    if (c == quote || c == '\\') break;
+    // Control characters (and the end of the input) aren't allowed.
+    if (static_cast<signed char>(c) >= 0) return false;
+    ascii = false;
+    cursor_++;
+  }
+  if (*cursor_ == quote) {
+    *str = start;
+    *len = static_cast<size_t>(cursor_ - start);
+    cursor_++;
+    if (ascii) {
+      *trivial = true;
+      for (auto s = start; s != *str + *len; s++) {
+        if (*s == '\x7F') *trivial = false;
+      }
+      return true;
+    }
+    *trivial = false;
+    return parser_.opts.allow_non_utf8 || IsValidUTF8(*str, *len);
+  }
+  // Escape codes, decode the rest of the string into scratch_.
+  *trivial = false;
+  scratch_.assign(start, cursor_);
+  int high_surrogate = -1;
+  while (*cursor_ != quote) {
+    auto c = *cursor_;
+    if (c != '\\') {
+      if (high_surrogate != -1) return false;
+      if (c < ' ' && static_cast<signed char>(c) >= 0) return false;
+      scratch_ += c;
+      cursor_++;
+      continue;
+    }
+    c = *++cursor_;
+    if (high_surrogate != -1 && c != 'u') return false;
+    cursor_++;
+    switch (c) {
+      case 'n': scratch_ += '\n'; break;
+      case 't': scratch_ += '\t'; break;
+      case 'r': scratch_ += '\r'; break;
+      case 'b': scratch_ += '\b'; break;
+      case 'f': scratch_ += '\f'; break;
+      case '\"': scratch_ += '\"'; break;
+      case '\'': scratch_ += '\''; break;
+      case '\\': scratch_ += '\\'; break;
+      case '/': scratch_ += '/'; break;
+      case 'x': {
+        uint32_t val;
+        if (!ParseHexDigits(&cursor_, 2, &val)) return false;
+        scratch_ += static_cast<char>(val);
+        break;
+      }
+      case 'u': {
+        uint32_t val;
+        if (!ParseHexDigits(&cursor_, 4, &val)) return false;
+        if (val >= 0xD800 && val <= 0xDBFF) {
+          if (high_surrogate != -1) return false;
+          high_surrogate = static_cast<int>(val);
+        } else if (val >= 0xDC00 && val <= 0xDFFF) {
+          if (high_surrogate == -1) return false;
+          ToUTF8(0x10000 + ((static_cast<uint32_t>(high_surrogate) & 0x03FF)
+                            << 10) +
+                     (val & 0x03FF),
+                 &scratch_);
+          high_surrogate = -1;
+        } else {
+          if (high_surrogate != -1) return false;
+          ToUTF8(val, &scratch_);
+        }
+        break;
+      }
+      default: return false;
+    }
+  }
+  if (high_surrogate != -1) return false;
+  cursor_++;
+  *str = scratch_.c_str();
+  *len = scratch_.length();
+  return parser_.opts.allow_non_utf8 || IsValidUTF8(*str, *len);
+}
+
+// Reads a field name and the ':' following it.
+bool JsonIngester::ReadKey(const char **name, size_t *len) {
+  if (*cursor_ == '\"' || *cursor_ == '\'') {
+    bool trivial;
+    if (!ReadString(name, len, &trivial)) return false;
+  } else {
+    if (parser_.opts.strict_json || !IsIdentifierStart(*cursor_)) return false;
+    *name = cursor_;
+    while (IsIdentifierChar(*cursor_)) cursor_++;
+    *len = static_cast<size_t>(cursor_ - *name);
+  }
+  SkipWhitespace();
+  if (*cursor_ != ':') return false;
+  cursor_++;
+  SkipWhitespace();
+  return true;
+}
+
+// Like Parser::SkipAnyJsonValue, for fields not in the schema.
+bool JsonIngester::SkipValue() {
+  auto c = *cursor_;
+  if (c == '{' || c == '[') {
+    if (++depth_ >= FLATBUFFERS_MAX_PARSING_DEPTH - 1) return false;
+    auto terminator = c == '{' ? '}' : ']';
+    cursor_++;
+    SkipWhitespace();
+    for (size_t count = 0; *cursor_ != terminator; count++) {
+      if (count) {
+        if (*cursor_ != ',') return false;
+        cursor_++;
+        SkipWhitespace();
+        if (*cursor_ == terminator) {
+          if (parser_.opts.strict_json) return false;
+          break;
+        }
+      }
+      if (terminator == '}') {
+        const char *name;
+        size_t len;
+        if (!ReadKey(&name, &len)) return false;
+      }
+      if (!SkipValue()) return false;
+      SkipWhitespace();
+    }
+    cursor_++;
+    depth_--;
+    return true;
+  }
+  if (c == '\"' || c == '\'') {
+    const char *str;
+    size_t len;
+    bool trivial;
+    return ReadString(&str, &len, &trivial);
+  }
+  auto start = cursor_;
+  if (IsIdentifierStart(c)) {
+    while (IsIdentifierChar(*cursor_)) cursor_++;
+    return true;
+  }
+  while (IsNumberChar(*cursor_)) cursor_++;
+  // Only accept numbers that ParseNumber would, to be sure they are valid.
+  Slot slot;
+  return ParseNumber(BASE_TYPE_DOUBLE, start,
+                     static_cast<size_t>(cursor_ - start), &slot);
+}
+
+bool JsonIngester::ParseScalar(const Type &type, bool hashed, Slot *slot) {
+  auto c = *cursor_;
+  // Strings and identifiers get hashed, which is left to the Parser.
+  if (hashed && (c == '\"' || c == '\'' || IsIdentifierStart(c)))
+    return false;
+  const char *str = cursor_;
+  size_t len;
+  if (c == '\"' || c == '\'') {
+    bool trivial;
+    if (!ReadString(&str, &len, &trivial) || !trivial) return false;
+    // Like Parser::ParseSingleValue, ignore trailing whitespace.
+    while (len && str[len - 1] == ' ') len--;
+  } else if (IsIdentifierStart(c)) {
+    while (IsIdentifierChar(*cursor_)) cursor_++;
+    len = static_cast<size_t>(cursor_ - str);
+  } else {
+    while (IsNumberChar(*cursor_)) cursor_++;
+    len = static_cast<size_t>(cursor_ - str);
+  }
+  auto base_type = type.base_type;
+  if (len && IsIdentifierStart(*str)) {
+    if (IsBool(base_type)) {
+      if (len == 4 && !memcmp(str, "true", 4)) {
+        slot->integer = 1;
+      } else if (len == 5 && !memcmp(str, "false", 5)) {
+        slot->integer = 0;
+      } else {
+        return false;
+      }
+      return true;
+    }
+    // Anything else (e.g. nan or inf for floats) is left to the Parser.
+    return IsInteger(base_type) &&
+           ParseEnum(type, str, len, &slot->integer) &&
+           IntegerFits(base_type, slot->integer);
+  }
+  return ParseNumber(base_type, str, len, slot);
+}
+
+// Like Parser::ParseEnumFromString.
+bool JsonIngester::ParseEnum(const Type &type, const char *name, size_t len,
+                             int64_t *val) {
+  if (!type.enum_def) return false;
+  *val = 0;
+  const char *end = name + len;
+  while (name != end) {
+    auto word_end = std::find(name, end, ' ');
+    auto enum_val = type.enum_def->Lookup(
+        name, static_cast<size_t>(word_end - name));
+    if (!enum_val) return false;
+    *val |= enum_val->value;
+    name = word_end;
+    while (name != end && *name == ' ') name++;
+  }
+  return true;
+}
+
+// Parses decimal numbers, leaving other forms (e.g. hexadecimal) to the
+// Parser. Integers and most floating point numbers are converted directly,
+// the rest with StringToNumber, which gives the same result.
+bool JsonIngester::ParseNumber(BaseType type, const char *str, size_t len,
+                               Slot *slot) {
+  auto p = str;
+  auto end = str + len;
+  auto negative = p != end && *p == '-';
+  if (negative) p++;
+  // Accumulate up to 19 significant digits, which always fit in 64 bits.
+  uint64_t mantissa = 0;
+  int digits = 0;
+  int exponent = 0;
+  auto int_start = p;
+  for (; p != end && is_digit(*p); p++) {
+    if (digits < 19) {
+      if (mantissa || *p != '0') {
+        mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+        digits++;
+      }
+    } else {
+      exponent++;
+      digits++;
+    }
+  }
+  if (p == int_start) return false;
+  auto is_float = false;
+  if (p != end && *p == '.') {
+    is_float = true;
+    for (p++; p != end && is_digit(*p); p++) {
+      if (digits < 19) {
+        if (mantissa || *p != '0') {
+          mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+          digits++;
+        }
+        exponent--;
+      } else {
+        digits++;
+      }
+    }
+  }
+  if (p != end && (*p == 'e' || *p == 'E')) {
+    is_float = true;
+    p++;
+    auto exp_negative = p != end && *p == '-';
+    if (p != end && (*p == '-' || *p == '+')) p++;
+    auto exp_start = p;
+    int exp = 0;
+    for (; p != end && is_digit(*p); p++) {
+      if (exp < 100000) exp = exp * 10 + (*p - '0');
+    }
+    if (p == exp_start) return false;
+    exponent += exp_negative ? -exp : exp;
+  }
+  if (p != end) return false;
+  if (!IsFloat(type)) {
+    // Integers must be plain digits (Parser reports floats as errors).
+    if (is_float || digits > 19 || (digits == 19 && exponent)) return false;
+    if (digits == 19 && exponent == 0 && int_start + 19 < end) return false;
+    // 20 digit numbers overflow the mantissa.
+    if (static_cast<size_t>(end - int_start) > 19) {
+      uint64_t val = 0;
+      for (auto d = int_start; d != end; d++) {
+        auto next = val * 10 + static_cast<uint64_t>(*d - '0');
+        if (next / 10 != val) return false;
+        val = next;
+      }
+      mantissa = val;
+    }
+    if (type == BASE_TYPE_ULONG) {
+      if (negative && mantissa) return false;
+      slot->integer = static_cast<int64_t>(mantissa);
+      return true;
+    }
+    if (mantissa > (negative ? 0x8000000000000000ULL : 0x7FFFFFFFFFFFFFFFULL))
+      return false;
+    slot->integer = negative ? static_cast<int64_t>(0 - mantissa)
+                             : static_cast<int64_t>(mantissa);
+    return IntegerFits(type, slot->integer);
+  }
+  // clang-format off
+  #ifdef FLATBUFFERS_JSON_INGEST_FAST_FLOAT
+    // Exact when both the mantissa and the power of 10 are exactly
+    // representable, with a single rounding in the multiplication/division.
+    if (type == BASE_TYPE_DOUBLE || !FLATBUFFERS_HAS_NEW_STRTOD) {
+      if (digits <= 19 && mantissa <= (1ULL << 53) && exponent >= -22 &&
+          exponent <= 22) {
+        auto val = static_cast<double>(mantissa);
+        val = exponent < 0 ? val / kExactPowersOf10[-exponent]
+                           : val * kExactPowersOf10[exponent];
+        slot->real = negative ? -val : val;
+        if (type == BASE_TYPE_FLOAT) {
+          slot->real = static_cast<float>(slot->real);
+        }
+        return true;
+      }
+    } else if (digits <= 19 && mantissa <= (1ULL << 24) &&
+               exponent >= -10 && exponent <= 10) {
+      auto val = static_cast<float>(mantissa);
+      val = exponent < 0 ? val / kExactPowersOf10f[-exponent]
+                         : val * kExactPowersOf10f[exponent];
+      slot->real = negative ? -val : val;
+      return true;
+    }
+  #endif
+  // clang-format on
+  if (digits <= 19) {
+    if (type == BASE_TYPE_FLOAT) {
+      float val;
+      if (DecimalToFloat(mantissa, exponent, negative, &val)) {
+        slot->real = val;
+        return true;
+      }
+    } else if (DecimalToFloat(mantissa, exponent, negative, &slot->real)) {
+      return true;
+    }
+  }
+  scratch_.assign(str, len);
+  if (type == BASE_TYPE_FLOAT) {
+    float val;
+    if (!StringToNumber(scratch_.c_str(), &val)) return false;
+    slot->real = val;
+  } else {
+    if (!StringToNumber(scratch_.c_str(), &slot->real)) return false;
+  }
+  return true;
+}
+
+bool JsonIngester::ParseValue(const Type &type, const FieldPlan *field,
+                              const StructPlan *struct_plan,
+                              size_t table_start, Slot *slot) {
+  switch (type.base_type) {
+    case BASE_TYPE_UNION:
+      return field && struct_plan && ParseUnion(*field, *struct_plan,
+                                                table_start, slot);
+    case BASE_TYPE_STRUCT:
+      return *cursor_ == '{' && struct_plan && ParseObject(*struct_plan, slot);
+    case BASE_TYPE_STRING: {
+      if (*cursor_ != '\"' && *cursor_ != '\'') return false;
+      const char *str;
+      size_t len;
+      bool trivial;
+      if (!ReadString(&str, &len, &trivial)) return false;
+      slot->integer = builder_.CreateString(str, len).o;
+      return true;
+    }
+    case BASE_TYPE_VECTOR: {
+      if (*cursor_ != '[') return false;
+      uoffset_t off;
+      if (!ParseVector(type.VectorType(), field, struct_plan, &off))
+        return false;
+      slot->integer = off;
+      return true;
+    }
+    default: return ParseScalar(type, field && field->hashed, slot);
+  }
+}
+
+// Like the BASE_TYPE_UNION case of Parser::ParseAnyValue. parent_plan is the
+// table containing the union field.
+bool JsonIngester::ParseUnion(const FieldPlan &field,
+                              const StructPlan &parent_plan,
+                              size_t table_start, Slot *slot) {
+  auto enum_def = field.def->value.type.enum_def;
+  int64_t type_id = -1;
+  // Find the corresponding type field, if it came first.
+  for (auto i = slots_.size(); i > table_start; i--) {
+    auto &type = slots_[i - 1].field->value.type;
+    if (type.base_type == BASE_TYPE_UTYPE && type.enum_def == enum_def) {
+      type_id = slots_[i - 1].integer;
+      break;
+    }
+  }
+  if (type_id < 0) {
+    // Otherwise it must come right after this value.
+    auto backup = cursor_;
+    if (!SkipValue()) return false;
+    SkipWhitespace();
+    if (*cursor_ != ',') return false;
+    cursor_++;
+    SkipWhitespace();
+    const char *name;
+    size_t len;
+    if (!ReadKey(&name, &len)) return false;
+    scratch_.assign(name, len);
+    if (scratch_ != field.def->name + UnionTypeFieldSuffix()) return false;
+    auto type_field = parent_plan.def->fields.Lookup(scratch_);
+    if (!type_field) return false;
+    Slot type_slot;
+    if (!ParseScalar(type_field->value.type, false, &type_slot)) return false;
+    type_id = type_slot.integer;
+    cursor_ = backup;
+  }
+  auto enum_val = enum_def->ReverseLookup(static_cast<uint8_t>(type_id));
+  if (!enum_val) return false;
+  auto &union_type = enum_val->union_type;
+  if (union_type.base_type == BASE_TYPE_STRUCT) {
+    auto plan_it = plans_by_def_.find(union_type.struct_def);
+    if (plan_it == plans_by_def_.end() || *cursor_ != '{' ||
+        !ParseObject(*plan_it->second, slot)) {
+      return false;
+    }
+    if (union_type.struct_def->fixed) {
+      // All BASE_TYPE_UNION values are offsets, so turn this into one.
+      SerializeStruct(*union_type.struct_def, *slot, field.def->value.offset);
+      builder_.ClearOffsets();
+      slot->integer = builder_.GetSize();
+    }
+    return true;
+  }
+  return union_type.base_type == BASE_TYPE_STRING &&
+         ParseValue(union_type, nullptr, nullptr, 0, slot);
+}
+
+// Like Parser::ParseTable, for a JSON object (only).
+bool JsonIngester::ParseObject(const StructPlan &plan, Slot *slot) {
+  if (++depth_ >= FLATBUFFERS_MAX_PARSING_DEPTH - 1) return false;
+  cursor_++;
+  SkipWhitespace();
+  auto table_start = slots_.size();
+  auto bytes_start = struct_bytes_.size();
+  size_t fieldn = 0;
+  size_t hint = 0;
+  while (*cursor_ != '}') {
+    const char *name;
+    size_t len;
+    if (!ReadKey(&name, &len)) return false;
+    auto field = LookupField(plan, name, len, &hint);
+    if (!field) {
+      if (len == 7 && !memcmp(name, "$schema", 7)) {
+        const char *str;
+        bool trivial;
+        if ((*cursor_ != '\"' && *cursor_ != '\'') ||
+            !ReadString(&str, &len, &trivial)) {
+          return false;
+        }
+      } else if (!parser_.opts.skip_unexpected_fields_in_json ||
+                 !SkipValue()) {
+        return false;
+      }
+    } else if (!field->fast) {
+      return false;
+    } else if (IsNullToken(cursor_) &&
+               !IsScalar(field->def->value.type.base_type)) {
+      cursor_ += 4;  // Ignore this field.
+    } else {
+      Slot field_slot;
+      field_slot.field = field->def;
+      auto struct_plan = field->def->value.type.base_type == BASE_TYPE_UNION
+                             ? &plan
+                             : field->struct_plan;
+      if (!ParseValue(field->def->value.type, field, struct_plan, table_start,
+                      &field_slot)) {
+        return false;
+      }
+      // Keep the fields sorted by offset, as Parser::ParseTable does.
+      auto offset = field->def->value.offset;
+      auto it = slots_.end();
+      for (; it != slots_.begin() + table_start; --it) {
+        auto existing_field = (it - 1)->field;
+        if (existing_field == field->def) return false;
+        if (existing_field->value.offset < offset) break;
+      }
+      slots_.insert(it, field_slot);
+      fieldn++;
+    }
+    SkipWhitespace();
+    if (*cursor_ == '}') break;
+    if (*cursor_ != ',') return false;
+    cursor_++;
+    SkipWhitespace();
+    if (*cursor_ == '}' && parser_.opts.strict_json && fieldn) return false;
+  }
+  cursor_++;
+
+  for (auto it = plan.required.begin(); it != plan.required.end(); ++it) {
+    auto found = false;
+    for (auto i = table_start; i < slots_.size() && !found; i++) {
+      found = slots_[i].field == *it;
+    }
+    if (!found) return false;
+  }
+
+  auto &struct_def = *plan.def;
+  if (struct_def.fixed && fieldn != struct_def.fields.vec.size()) return false;
+
+  auto start = struct_def.fixed ? builder_.StartStruct(struct_def.minalign)
+                                : builder_.StartTable();
+  for (size_t size = struct_def.sortbysize ? sizeof(largest_scalar_t) : 1; size;
+       size /= 2) {
+    // Go through elements in reverse, since we're building the data backwards.
+    for (auto i = slots_.size(); i > table_start; i--) {
+      auto &field_slot = slots_[i - 1];
+      auto field = field_slot.field;
+      auto base_type = field->value.type.base_type;
+      if (struct_def.sortbysize && size != SizeOf(base_type)) continue;
+      switch (base_type) {
+        // clang-format off
+        #define FLATBUFFERS_TD(ENUM, IDLTYPE, \
+          CTYPE, JTYPE, GTYPE, NTYPE, PTYPE, RTYPE) \
+          case BASE_TYPE_ ## ENUM: \
+            builder_.Pad(field->padding); \
+            if (struct_def.fixed) { \
+              builder_.PushElement(GetScalar<CTYPE>(field_slot)); \
+            } else { \
+              builder_.AddElement(field->value.offset, \
+                                  GetScalar<CTYPE>(field_slot), \
+                                  GetScalar<CTYPE>(field->value)); \
+            } \
+            break;
+          FLATBUFFERS_GEN_TYPES_SCALAR(FLATBUFFERS_TD);
+        #undef FLATBUFFERS_TD
+        #define FLATBUFFERS_TD(ENUM, IDLTYPE, \
+          CTYPE, JTYPE, GTYPE, NTYPE, PTYPE, RTYPE) \
+          case BASE_TYPE_ ## ENUM: \
+            builder_.Pad(field->padding); \
+            if (IsStruct(field->value.type)) { \
+              SerializeStruct(*field->value.type.struct_def, field_slot, \
+                              field->value.offset); \
+            } else { \
+              builder_.AddOffset(field->value.offset, Offset<void>( \
+                  static_cast<uoffset_t>(field_slot.integer))); \
+            } \
+            break;
+          FLATBUFFERS_GEN_TYPES_POINTER(FLATBUFFERS_TD);
+        #undef FLATBUFFERS_TD
+        // clang-format on
+      }
+    }
+  }
+  slots_.resize(table_start);
+  struct_bytes_.resize(bytes_start);
+
+  if (struct_def.fixed) {
+    builder_.ClearOffsets();
+    builder_.EndStruct();
+    // Keep the bytes of this struct until it is serialized in-place elsewhere.
+    slot->struct_pos = struct_bytes_.size();
+    struct_bytes_.insert(struct_bytes_.end(),
+                         builder_.GetCurrentBufferPointer(),
+                         builder_.GetCurrentBufferPointer() +
+                             struct_def.bytesize);
+    builder_.PopBytes(struct_def.bytesize);
+  } else {
+    slot->integer = builder_.EndTable(start);
+  }
+  depth_--;
+  return true;
+}
+
+// Like Parser::ParseVector.
+bool JsonIngester::ParseVector(const Type &type, const FieldPlan *field,
+                               const StructPlan *element_plan,
+                               uoffset_t *ovalue) {
+  if (++depth_ >= FLATBUFFERS_MAX_PARSING_DEPTH - 1) return false;
+  cursor_++;
+  SkipWhitespace();
+  auto start = slots_.size();
+  auto bytes_start = struct_bytes_.size();
+  while (*cursor_ != ']') {
+    Slot slot;
+    slot.field = nullptr;
+    if (!ParseValue(type, field, element_plan, 0, &slot)) return false;
+    slots_.push_back(slot);
+    SkipWhitespace();
+    if (*cursor_ == ']') break;
+    if (*cursor_ != ',') return false;
+    cursor_++;
+    SkipWhitespace();
+    if (*cursor_ == ']' && parser_.opts.strict_json) return false;
+  }
+  cursor_++;
+
+  auto count = slots_.size() - start;
+  builder_.StartVector(count * InlineSize(type) / InlineAlignment(type),
+                       InlineAlignment(type));
+  // Start at the back, since we're building the data backwards.
+  for (auto i = slots_.size(); i > start; i--) {
+    auto &slot = slots_[i - 1];
+    switch (type.base_type) {
+      // clang-format off
+      #define FLATBUFFERS_TD(ENUM, IDLTYPE, \
+        CTYPE, JTYPE, GTYPE, NTYPE, PTYPE, RTYPE) \
+        case BASE_TYPE_ ## ENUM: \
+          builder_.PushElement(GetScalar<CTYPE>(slot)); \
+          break;
+        FLATBUFFERS_GEN_TYPES_SCALAR(FLATBUFFERS_TD);
+      #undef FLATBUFFERS_TD
+      #define FLATBUFFERS_TD(ENUM, IDLTYPE, \
+        CTYPE, JTYPE, GTYPE, NTYPE, PTYPE, RTYPE) \
+        case BASE_TYPE_ ## ENUM: \
+          if (IsStruct(type)) { \
+            SerializeStruct(*type.struct_def, slot, kNoFieldOffset); \
+          } else { \
+            builder_.PushElement(Offset<void>( \
+                static_cast<uoffset_t>(slot.integer))); \
+          } \
+          break;
+        FLATBUFFERS_GEN_TYPES_POINTER(FLATBUFFERS_TD);
+      #undef FLATBUFFERS_TD
+      // clang-format on
+    }
+  }
+  slots_.resize(start);
+  struct_bytes_.resize(bytes_start);
+
+  builder_.ClearOffsets();
+  *ovalue = builder_.EndVector(count);
+  depth_--;
+  return true;
+}
+
+void JsonIngester::SerializeStruct(const StructDef &struct_def,
+                                   const Slot &slot, voffset_t offset) {
+  builder_.Align(struct_def.minalign);
+  builder_.PushBytes(&struct_bytes_[slot.struct_pos], struct_def.bytesize);
+  builder_.AddStructOffset(offset, builder_.GetSize());
+}
+
+// The output of one thread of ParseJsonLines for one chunk of lines.
+struct JsonLinesChunk {
+  JsonLinesChunk()
+      : begin(nullptr), end(nullptr), num_lines(0), error_line(0), ok(true) {}
+
+  const char *begin;
+  const char *end;
+  std::vector<uint8_t> records;  // Size prefixed buffers, back to back.
+  size_t num_lines;
+  size_t error_line;  // Relative to the start of the chunk.
+  std::string error;
+  bool ok;
+};
+
+static void ParseJsonLinesChunk(JsonIngester &ingester, std::string &line,
+                                JsonLinesChunk &chunk) {
+  chunk.records.clear();
+  chunk.num_lines = 0;
+  for (auto p = chunk.begin; p != chunk.end; chunk.num_lines++) {
+    auto eol = std::find(p, chunk.end, '\n');
+    auto blank = true;
+    for (auto c = p; c != eol && blank; c++) blank = IsWhitespace(*c);
+    if (!blank) {
+      // JsonIngester needs a null-terminated string.
+      line.assign(p, eol);
+      if (!ingester.Parse(line.c_str())) {
+        chunk.ok = false;
+        chunk.error_line = chunk.num_lines;
+        chunk.error = ingester.error_;
+        return;
+      }
+      auto buf = ingester.builder_.GetBufferPointer();
+      chunk.records.insert(chunk.records.end(), buf,
+                           buf + ingester.builder_.GetSize());
+    }
+    p = eol == chunk.end ? eol : eol + 1;
+  }
+}
+
+bool ParseJsonLines(const Parser &parser, const char *json, size_t length,
+                    size_t num_threads, RecordStreamWriter *writer,
+                    std::string *error) {
+  // Each thread converts a chunk of about this many bytes per round, so the
+  // memory used is bounded however large the input is.
+  static const size_t kChunkSize = 1 << 18;
+  if (!num_threads) num_threads = 1;
+  std::vector<JsonLinesChunk> chunks(num_threads);
+  std::vector<std::string> lines(num_threads);
+  std::vector<JsonIngester *> ingesters;
+  for (size_t t = 0; t < num_threads; t++) {
+    ingesters.push_back(new JsonIngester(parser));
+    ingesters.back()->size_prefixed_ = true;
+  }
+  auto ok = true;
+  size_t line_number = 1;
+  for (auto p = json, end = json + length; p != end && ok;) {
+    // Divide the next round of input into chunks of whole lines.
+    size_t used = 0;
+    for (size_t t = 0; t < num_threads; t++) {
+      auto &chunk = chunks[t];
+      chunk.begin = p;
+      chunk.end = p + std::min(kChunkSize, static_cast<size_t>(end - p));
+      chunk.end = std::find(chunk.end, end, '\n');
+      if (chunk.end != end) chunk.end++;
+      p = chunk.end;
+      if (chunk.begin != chunk.end) used = t + 1;
+    }
+    // clang-format off
+    #ifndef FLATBUFFERS_CPP98_STL
+      std::vector<std::thread> threads;
+      for (size_t t = 1; t < used; t++) {
+        threads.push_back(std::thread(ParseJsonLinesChunk,
+                                      std::ref(*ingesters[t]),
+                                      std::ref(lines[t]), std::ref(chunks[t])));
+      }
+      ParseJsonLinesChunk(*ingesters[0], lines[0], chunks[0]);
+      for (auto it = threads.begin(); it != threads.end(); ++it) it->join();
+    #else
+      for (size_t t = 0; t < used; t++) {
+        ParseJsonLinesChunk(*ingesters[t], lines[t], chunks[t]);
+      }
+    #endif
+    // clang-format on
+    // Emit records in input order, up to the first error.
+    for (size_t t = 0; t < used && ok; t++) {
+      auto &chunk = chunks[t];
+      auto &records = chunk.records;
+      for (size_t pos = 0; pos < records.size();) {
+        auto len = GetPrefixedSize(&records[pos]) + sizeof(uoffset_t);
+        auto appended = writer->Append(&records[pos], len);
+        (void)appended;
+        FLATBUFFERS_ASSERT(appended);
+        pos += len;
+      }
+      if (!chunk.ok) {
+        // Errors are reported for line 1 of a single line document, so
+        // replace that with the line number in the whole input.
+        auto &msg = chunk.error;
+        auto line_end = msg.find(':');
+        if (!msg.empty() && is_digit(msg[0]) && line_end != std::string::npos)
+          msg.erase(0, line_end);
+        else
+          msg = ": " + msg;
+        *error = NumToString(line_number + chunk.error_line) + msg;
+        ok = false;
+      }
+      line_number += chunk.num_lines;
+    }
+  }
+  for (auto it = ingesters.begin(); it != ingesters.end(); ++it) delete *it;
+  return ok;
+}
+
+}  // namespace flatbuffers
@@ -152,6 +152,33 @@ inline CheckedError atot<Offset<void>>(const char *s, Parser &parser,
   return NoError();
 }
 
+// Convert the text of scalar "e" to its binary form, checking that it fits
+// its type. If "repack" is set, integers are then converted back to text to
+// remove any ambiguities like leading zeros, which can be treated as an
+// octal-literal (idl_gen_cpp/GenDefaultConstant).
+static CheckedError ConvertScalar(Value &e, Parser &parser, bool repack) {
+  switch (e.type.base_type) {
+    // clang-format off
+    #define FLATBUFFERS_TD(ENUM, IDLTYPE, \
+            CTYPE, JTYPE, GTYPE, NTYPE, PTYPE, RTYPE) \
+            case BASE_TYPE_ ## ENUM: {\
+                CTYPE val; \
+                ECHECK(atot(e.constant.c_str(), parser, &val)); \
+                if (flatbuffers::is_floating_point<CTYPE>::value) { \
+                  e.real = static_cast<double>(val); \
+                } else { \
+                  e.integer = static_cast<int64_t>(val); \
+                  if (repack) e.constant = NumToString(val); \
+                } \
+              break; }
+    FLATBUFFERS_GEN_TYPES_SCALAR(FLATBUFFERS_TD);
+    #undef FLATBUFFERS_TD
+    default: break;
+    // clang-format on
+  }
+  return NoError();
+}
+
 std::string Namespace::GetFullyQualifiedName(const std::string &name,
                                              size_t max_components) const {
   // Early exit if we don't have a defined namespace.
@@ -798,6 +825,27 @@ CheckedError Parser::ParseField(StructDef &struct_def) {
       return Error("flexbuffer attribute may only apply to a vector of ubyte");
   }
 
+  if (field->attributes.Lookup("hashed")) {
+    if (type.base_type != BASE_TYPE_VECTOR || type.element != BASE_TYPE_STRUCT)
+      return Error("hashed attribute may only apply to a vector of tables");
+    // Add a second auto-generated field after this one to hold its hash
+    // index, with a special suffix. If this field has a manually assigned
+    // id, the index gets the next one (N + 1).
+    Type index_type(BASE_TYPE_VECTOR);
+    index_type.element = BASE_TYPE_UINT;
+    FieldDef *indexfield;
+    ECHECK(AddField(struct_def, name + HashIndexFieldSuffix(), index_type,
+                    &indexfield));
+    indexfield->deprecated = field->deprecated;
+    auto attr = field->attributes.Lookup("id");
+    if (attr) {
+      auto val = new Value();
+      val->type = attr->type;
+      val->constant = NumToString(atoi(attr->constant.c_str()) + 1);
+      indexfield->attributes.Add("id", val);
+    }
+  }
+
   if (typefield) {
     if (!IsScalar(typefield->value.type.base_type)) {
       // this is a union vector field
@@ -822,7 +870,7 @@ CheckedError Parser::ParseField(StructDef &struct_def) {
 CheckedError Parser::ParseString(Value &val) {
   auto s = attribute_;
   EXPECT(kTokenStringConstant);
-  val.constant = NumToString(builder_.CreateString(s).o);
+  val.integer = builder_.CreateString(s).o;
   return NoError();
 }
 
@@ -837,18 +885,19 @@ CheckedError Parser::ParseAnyValue(Value &val, FieldDef *field,
   switch (val.type.base_type) {
     case BASE_TYPE_UNION: {
       FLATBUFFERS_ASSERT(field);
-      std::string constant;
+      const Value *type_val = nullptr;
       // Find corresponding type field we may have already parsed.
       for (auto elem = field_stack_.rbegin();
            elem != field_stack_.rbegin() + parent_fieldn; ++elem) {
         auto &type = elem->second->value.type;
         if (type.base_type == BASE_TYPE_UTYPE &&
             type.enum_def == val.type.enum_def) {
-          constant = elem->first.constant;
+          type_val = &elem->first;
           break;
         }
       }
-      if (constant.empty()) {
+      Value next_type_val;
+      if (!type_val) {
         // We haven't seen the type field yet. Sadly a lot of JSON writers
         // output these in alphabetical order, meaning it comes after this
         // value. So we scan past the value to find it, then come back here.
@@ -870,24 +919,22 @@ CheckedError Parser::ParseAnyValue(Value &val, FieldDef *field,
           return Error("missing type field after this union value: " +
                        type_name);
         EXPECT(':');
-        Value type_val = type_field->value;
-        ECHECK(ParseAnyValue(type_val, type_field, 0, nullptr));
-        constant = type_val.constant;
+        next_type_val = type_field->value;
+        ECHECK(ParseAnyValue(next_type_val, type_field, 0, nullptr));
+        type_val = &next_type_val;
         // Got the information we needed, now rewind:
         *static_cast<ParserState *>(this) = backup;
       }
-      uint8_t enum_idx;
-      ECHECK(atot(constant.c_str(), *this, &enum_idx));
+      auto enum_idx = type_val->GetValue<uint8_t>();
       auto enum_val = val.type.enum_def->ReverseLookup(enum_idx);
       if (!enum_val) return Error("illegal type id for: " + field->name);
       if (enum_val->union_type.base_type == BASE_TYPE_STRUCT) {
-        ECHECK(ParseTable(*enum_val->union_type.struct_def, &val.constant,
-                          nullptr));
+        ECHECK(ParseTable(*enum_val->union_type.struct_def, &val, nullptr));
         if (enum_val->union_type.struct_def->fixed) {
           // All BASE_TYPE_UNION values are offsets, so turn this into one.
           SerializeStruct(*enum_val->union_type.struct_def, val);
           builder_.ClearOffsets();
-          val.constant = NumToString(builder_.GetSize());
+          val.integer = builder_.GetSize();
         }
       } else if (enum_val->union_type.base_type == BASE_TYPE_STRING) {
         ECHECK(ParseString(val));
@@ -897,7 +944,7 @@ CheckedError Parser::ParseAnyValue(Value &val, FieldDef *field,
       break;
     }
     case BASE_TYPE_STRUCT:
-      ECHECK(ParseTable(*val.type.struct_def, &val.constant, nullptr));
+      ECHECK(ParseTable(*val.type.struct_def, &val, nullptr));
       break;
     case BASE_TYPE_STRING: {
       ECHECK(ParseString(val));
@@ -906,7 +953,7 @@ CheckedError Parser::ParseAnyValue(Value &val, FieldDef *field,
     case BASE_TYPE_VECTOR: {
       uoffset_t off;
       ECHECK(ParseVector(val.type.VectorType(), &off));
-      val.constant = NumToString(off);
+      val.integer = off;
       break;
     }
     case BASE_TYPE_INT:
@@ -978,7 +1025,7 @@ CheckedError Parser::ParseTableDelimiters(size_t &fieldn,
   return NoError();
 }
 
-CheckedError Parser::ParseTable(const StructDef &struct_def, std::string *value,
+CheckedError Parser::ParseTable(const StructDef &struct_def, Value *value,
                                 uoffset_t *ovalue) {
   size_t fieldn_outer = 0;
   auto err = ParseTableDelimiters(
@@ -1010,7 +1057,7 @@ CheckedError Parser::ParseTable(const StructDef &struct_def, std::string *value,
               builder_.ForceVectorAlignment(builder.GetSize(), sizeof(uint8_t),
                                             sizeof(largest_scalar_t));
               auto off = builder_.CreateVector(builder.GetBuffer());
-              val.constant = NumToString(off.o);
+              val.integer = off.o;
             } else if (field->nested_flatbuffer) {
               ECHECK(
                   ParseNestedFlatbuffer(val, field, fieldn, struct_def_inner));
@@ -1081,14 +1128,11 @@ CheckedError Parser::ParseTable(const StructDef &struct_def, std::string *value,
             case BASE_TYPE_ ## ENUM: \
               builder_.Pad(field->padding); \
               if (struct_def.fixed) { \
-                CTYPE val; \
-                ECHECK(atot(field_value.constant.c_str(), *this, &val)); \
-                builder_.PushElement(val); \
+                builder_.PushElement(field_value.GetValue<CTYPE>()); \
               } else { \
-                CTYPE val, valdef; \
-                ECHECK(atot(field_value.constant.c_str(), *this, &val)); \
-                ECHECK(atot(field->value.constant.c_str(), *this, &valdef)); \
-                builder_.AddElement(field_value.offset, val, valdef); \
+                builder_.AddElement(field_value.offset, \
+                                    field_value.GetValue<CTYPE>(), \
+                                    field->value.GetValue<CTYPE>()); \
               } \
               break;
             FLATBUFFERS_GEN_TYPES_SCALAR(FLATBUFFERS_TD);
@@ -1100,9 +1144,8 @@ CheckedError Parser::ParseTable(const StructDef &struct_def, std::string *value,
               if (IsStruct(field->value.type)) { \
                 SerializeStruct(*field->value.type.struct_def, field_value); \
               } else { \
-                CTYPE val; \
-                ECHECK(atot(field_value.constant.c_str(), *this, &val)); \
-                builder_.AddOffset(field_value.offset, val); \
+                builder_.AddOffset(field_value.offset, \
+                                   field_value.GetValue<CTYPE>()); \
               } \
               break;
             FLATBUFFERS_GEN_TYPES_POINTER(FLATBUFFERS_TD);
@@ -1120,7 +1163,7 @@ CheckedError Parser::ParseTable(const StructDef &struct_def, std::string *value,
     FLATBUFFERS_ASSERT(value);
     // Temporarily store this struct in the value string, since it is to
     // be serialized in-place elsewhere.
-    value->assign(
+    value->constant.assign(
         reinterpret_cast<const char *>(builder_.GetCurrentBufferPointer()),
         struct_def.bytesize);
     builder_.PopBytes(struct_def.bytesize);
@@ -1128,7 +1171,7 @@ CheckedError Parser::ParseTable(const StructDef &struct_def, std::string *value,
   } else {
     auto val = builder_.EndTable(start);
     if (ovalue) *ovalue = val;
-    if (value) *value = NumToString(val);
+    if (value) value->integer = val;
   }
   return NoError();
 }
@@ -1169,11 +1212,7 @@ CheckedError Parser::ParseVector(const Type &type, uoffset_t *ovalue) {
         CTYPE, JTYPE, GTYPE, NTYPE, PTYPE, RTYPE) \
         case BASE_TYPE_ ## ENUM: \
           if (IsStruct(val.type)) SerializeStruct(*val.type.struct_def, val); \
-          else { \
-             CTYPE elem; \
-             ECHECK(atot(val.constant.c_str(), *this, &elem)); \
-             builder_.PushElement(elem); \
-          } \
+          else builder_.PushElement(val.GetValue<CTYPE>()); \
           break;
         FLATBUFFERS_GEN_TYPES(FLATBUFFERS_TD)
       #undef FLATBUFFERS_TD
@@ -1215,7 +1254,7 @@ CheckedError Parser::ParseNestedFlatbuffer(Value &val, FieldDef *field,
 
     auto off = builder_.CreateVector(nested_parser.builder_.GetBufferPointer(),
                                      nested_parser.builder_.GetSize());
-    val.constant = NumToString(off.o);
+    val.integer = off.o;
 
     // Clean nested_parser before destruction to avoid deleting the elements in
     // the SymbolTables
@@ -1307,7 +1346,7 @@ CheckedError Parser::ParseEnumFromString(Type &type, int64_t *result) {
       next += word.length();
     }
     if (type.enum_def) {  // The field has an enum type
-      auto enum_val = type.enum_def->vals.Lookup(word);
+      auto enum_val = type.enum_def->Lookup(word);
       if (!enum_val)
         return Error("unknown enum value: " + word +
                      ", for enum: " + type.enum_def->name);
@@ -1323,7 +1362,7 @@ CheckedError Parser::ParseEnumFromString(Type &type, int64_t *result) {
       std::string enum_val_str(dot + 1, word.c_str() + word.length());
       auto enum_def = LookupEnum(enum_def_str);
       if (!enum_def) return Error("unknown enum: " + enum_def_str);
-      auto enum_val = enum_def->vals.Lookup(enum_val_str);
+      auto enum_val = enum_def->Lookup(enum_val_str);
       if (!enum_val) return Error("unknown enum value: " + enum_val_str);
       *result |= enum_val->value;
     }
@@ -1339,36 +1378,42 @@ CheckedError Parser::ParseHash(Value &e, FieldDef *field) {
       auto hash = FindHashFunction16(hash_name->constant.c_str());
       int16_t hashed_value = static_cast<int16_t>(hash(attribute_.c_str()));
       e.constant = NumToString(hashed_value);
+      e.integer = static_cast<int64_t>(hashed_value);
       break;
     }
     case BASE_TYPE_USHORT: {
       auto hash = FindHashFunction16(hash_name->constant.c_str());
       uint16_t hashed_value = hash(attribute_.c_str());
       e.constant = NumToString(hashed_value);
+      e.integer = static_cast<int64_t>(hashed_value);
       break;
     }
     case BASE_TYPE_INT: {
       auto hash = FindHashFunction32(hash_name->constant.c_str());
       int32_t hashed_value = static_cast<int32_t>(hash(attribute_.c_str()));
       e.constant = NumToString(hashed_value);
+      e.integer = static_cast<int64_t>(hashed_value);
       break;
     }
     case BASE_TYPE_UINT: {
       auto hash = FindHashFunction32(hash_name->constant.c_str());
       uint32_t hashed_value = hash(attribute_.c_str());
       e.constant = NumToString(hashed_value);
+      e.integer = static_cast<int64_t>(hashed_value);
       break;
     }
     case BASE_TYPE_LONG: {
       auto hash = FindHashFunction64(hash_name->constant.c_str());
       int64_t hashed_value = static_cast<int64_t>(hash(attribute_.c_str()));
       e.constant = NumToString(hashed_value);
+      e.integer = static_cast<int64_t>(hashed_value);
       break;
     }
     case BASE_TYPE_ULONG: {
       auto hash = FindHashFunction64(hash_name->constant.c_str());
       uint64_t hashed_value = hash(attribute_.c_str());
       e.constant = NumToString(hashed_value);
+      e.integer = static_cast<int64_t>(hashed_value);
       break;
     }
     default: FLATBUFFERS_ASSERT(0);
@@ -1421,7 +1466,7 @@ CheckedError Parser::ParseSingleValue(const std::string *name, Value &e,
                    ", value: " + e.constant);
     }
     e.constant = NumToString(y);
-    return NoError();
+    return ConvertScalar(e, *this, false);
   }
 
   auto match = false;
@@ -1498,29 +1543,9 @@ CheckedError Parser::ParseSingleValue(const std::string *name, Value &e,
   if (!match) return TokenError();
 
   // The check_now flag must be true when parse a fbs-schema.
-  // This flag forces to check default scalar values or metadata of field.
-  // For JSON parser the flag should be false.
-  // If it is set for JSON each value will be checked twice (see ParseTable).
-  if (check_now && IsScalar(e.type.base_type)) {
-    // "re-pack" an integer scalar to remove any ambiguities like leading zeros
-    // which can be treated as octal-literal (idl_gen_cpp/GenDefaultConstant).
-    const auto repack = IsInteger(e.type.base_type);
-    switch (e.type.base_type) {
-    // clang-format off
-    #define FLATBUFFERS_TD(ENUM, IDLTYPE, \
-            CTYPE, JTYPE, GTYPE, NTYPE, PTYPE, RTYPE) \
-            case BASE_TYPE_ ## ENUM: {\
-                CTYPE val; \
-                ECHECK(atot(e.constant.c_str(), *this, &val)); \
-                if(repack) e.constant = NumToString(val); \
-              break; }
-    FLATBUFFERS_GEN_TYPES_SCALAR(FLATBUFFERS_TD);
-    #undef FLATBUFFERS_TD
-    default: break;
-    // clang-format on
-    }
-  }
-  return NoError();
+  // This flag forces integer default scalar values or metadata of field to be
+  // re-packed. The JSON parser only needs the binary form of the value.
+  return ConvertScalar(e, *this, check_now);
 }
 
 StructDef *Parser::LookupCreateStruct(const std::string &name,
@@ -1576,6 +1601,54 @@ StructDef *Parser::LookupCreateStruct(const std::string &name,
   return struct_def;
 }
 
+static bool compareEnumValues(const std::pair<int64_t, EnumVal *> &a,
+                              const std::pair<int64_t, EnumVal *> &b) {
+  return a.first < b.first;
+}
+
+void EnumDef::BuildLookupTables() {
+  lookup_size_ = vals.vec.size();
+  dense_values_.clear();
+  sorted_values_.clear();
+  name_slots_.clear();
+  if (vals.vec.empty()) return;
+  auto min_value = vals.vec[0]->value;
+  auto max_value = min_value;
+  for (auto it = vals.vec.begin(); it != vals.vec.end(); ++it) {
+    min_value = std::min(min_value, (*it)->value);
+    max_value = std::max(max_value, (*it)->value);
+  }
+  // Index values directly unless that wastes more than half of the table.
+  auto range = static_cast<uint64_t>(max_value) -
+               static_cast<uint64_t>(min_value);
+  if (range < std::max<uint64_t>(2 * vals.vec.size(), 16)) {
+    min_value_ = min_value;
+    dense_values_.resize(static_cast<size_t>(range) + 1, nullptr);
+    for (auto it = vals.vec.begin(); it != vals.vec.end(); ++it) {
+      auto &slot = dense_values_[static_cast<size_t>(
+          static_cast<uint64_t>((*it)->value) -
+          static_cast<uint64_t>(min_value))];
+      if (!slot) slot = *it;
+    }
+  } else {
+    for (auto it = vals.vec.begin(); it != vals.vec.end(); ++it) {
+      sorted_values_.push_back(std::make_pair((*it)->value, *it));
+    }
+    // Stable, so that of equal values the first declared is found.
+    std::stable_sort(sorted_values_.begin(), sorted_values_.end(),
+                     compareEnumValues);
+  }
+  size_t size = 2;
+  while (size < 2 * vals.dict.size()) size <<= 1;
+  name_slots_.assign(size, std::pair<const std::string *, EnumVal *>(
+                               nullptr, nullptr));
+  for (auto it = vals.dict.begin(); it != vals.dict.end(); ++it) {
+    auto i = NameHash(it->first.c_str(), it->first.size()) & (size - 1);
+    while (name_slots_[i].first) i = (i + 1) & (size - 1);
+    name_slots_[i] = std::make_pair(&it->first, it->second);
+  }
+}
+
 CheckedError Parser::ParseEnum(bool is_union, EnumDef **dest) {
   std::vector<std::string> enum_comment = doc_comment_;
   NEXT();
@@ -1707,6 +1780,7 @@ CheckedError Parser::ParseEnum(bool is_union, EnumDef **dest) {
       (*it)->value = 1LL << (*it)->value;
     }
   }
+  enum_def->BuildLookupTables();
   if (dest) *dest = enum_def;
   types_.Add(current_namespace_->GetFullyQualifiedName(enum_def->name),
              new Type(BASE_TYPE_UNION, nullptr, enum_def));
@@ -1884,6 +1958,23 @@ CheckedError Parser::ParseService() {
   return NoError();
 }
 
+bool CompiledSchema::Load(const char *source, const char **include_paths,
+                          const char *source_filename) {
+  if (!parser_.Parse(source, include_paths, source_filename)) return false;
+  if (parser_.builder_.GetSize()) {
+    parser_.error_ = "schema contains JSON data";
+    parser_.builder_.Reset();
+    return false;
+  }
+  // Free what was only needed while parsing.
+  parser_.builder_.Reset();
+  return true;
+}
+
+bool CompiledSchema::LoadBinary(const uint8_t *buf, size_t size) {
+  return parser_.Deserialize(buf, size);
+}
+
 bool Parser::SetRootType(const char *name) {
   root_struct_def_ = LookupStruct(name);
   if (!root_struct_def_)
@@ -1984,6 +2075,7 @@ CheckedError Parser::ParseProtoDecl() {
       else
         ++it;
     }
+    enum_def->BuildLookupTables();
   } else if (IsIdent("syntax")) {  // Skip these.
     NEXT();
     EXPECT('=');
@@ -2125,8 +2217,10 @@ CheckedError Parser::ParseProtoFields(StructDef *struct_def, bool isextend,
           if (key == "default") {
             // Temp: skip non-numeric defaults (enums).
             auto numeric = strpbrk(val.c_str(), "0123456789-+.");
-            if (IsScalar(type.base_type) && numeric == val.c_str())
+            if (IsScalar(type.base_type) && numeric == val.c_str()) {
               field->value.constant = val;
+              ECHECK(ConvertScalar(field->value, *this, false));
+            }
           } else if (key == "deprecated") {
             field->deprecated = val == "true";
           }
@@ -2159,6 +2253,7 @@ CheckedError Parser::ParseProtoFields(StructDef *struct_def, bool isextend,
           enum_val->doc_comment = oneof_field.doc_comment;
           oneof_union->vals.Add(oneof_field.name, enum_val);
         }
+        oneof_union->BuildLookupTables();
       } else {
         EXPECT(';');
       }
@@ -2421,6 +2516,21 @@ CheckedError Parser::ParseRoot(const char *source, const char **include_paths,
     ++it;
   }
 
+  // Now that all types are defined, check the tables hashed vectors hold have
+  // a key to hash.
+  for (auto it = structs_.vec.begin(); it != structs_.vec.end(); ++it) {
+    auto &struct_def = **it;
+    for (auto field_it = struct_def.fields.vec.begin();
+         field_it != struct_def.fields.vec.end(); ++field_it) {
+      auto &field = **field_it;
+      auto element = field.value.type.struct_def;
+      if (field.attributes.Lookup("hashed") &&
+          (element->fixed || !element->has_key))
+        return Error("hashed vector " + field.name +
+                     " must hold tables with a key field");
+    }
+  }
+
   // This check has to happen here and not earlier, because only now do we
   // know for sure what the type of these are.
   for (auto it = enums_.vec.begin(); it != enums_.vec.end(); ++it) {
@@ -2800,6 +2910,304 @@ Definition::SerializeAttributes(FlatBufferBuilder *builder,
   }
 }
 
+bool Parser::Deserialize(const uint8_t *buf, const size_t size) {
+  // opts.size_prefixed applies to data binaries, .bfbs files never have one.
+  flatbuffers::Verifier verifier(buf, size);
+  if (!reflection::VerifySchemaBuffer(verifier)) {
+    error_ = "not a valid binary schema";
+    return false;
+  }
+  return Deserialize(reflection::GetSchema(buf));
+}
+
+bool Parser::Deserialize(const reflection::Schema *schema) {
+  // Types refer to definitions by their index in the schema.
+  if (!structs_.vec.empty() || !enums_.vec.empty()) {
+    error_ = "can only deserialize a schema into an empty parser";
+    return false;
+  }
+  file_identifier_ = schema->file_ident() ? schema->file_ident()->str() : "";
+  file_extension_ = schema->file_ext() ? schema->file_ext()->str() : "";
+  // Names are stored fully qualified, split them into a name and namespace.
+  auto set_name = [&](Definition &def, const std::string &qualified_name) {
+    auto ns = new Namespace();
+    size_t start = 0;
+    for (auto dot = qualified_name.find('.'); dot != std::string::npos;
+         dot = qualified_name.find('.', start)) {
+      ns->components.push_back(qualified_name.substr(start, dot - start));
+      start = dot + 1;
+    }
+    def.name = qualified_name.substr(start);
+    def.defined_namespace = UniqueNamespace(ns);
+  };
+
+  // Create all definitions first, since types refer to them by index.
+  auto objects = schema->objects();
+  for (uoffset_t i = 0; i < objects->size(); i++) {
+    auto struct_def = new StructDef();
+    auto qualified_name = objects->Get(i)->name()->str();
+    set_name(*struct_def, qualified_name);
+    struct_def->index = static_cast<int>(i);
+    if (structs_.Add(qualified_name, struct_def)) {
+      error_ = "datatype already exists: " + qualified_name;
+      return false;
+    }
+    types_.Add(qualified_name, new Type(BASE_TYPE_STRUCT, struct_def));
+  }
+  auto enums = schema->enums();
+  for (uoffset_t i = 0; i < enums->size(); i++) {
+    auto enum_def = new EnumDef();
+    auto qualified_name = enums->Get(i)->name()->str();
+    set_name(*enum_def, qualified_name);
+    enum_def->index = static_cast<int>(i);
+    if (enums_.Add(qualified_name, enum_def)) {
+      error_ = "enum already exists: " + qualified_name;
+      return false;
+    }
+  }
+
+  for (uoffset_t i = 0; i < enums->size(); i++) {
+    auto enum_def = enums_.vec[i];
+    if (!enum_def->Deserialize(*this, enums->Get(i))) {
+      error_ = "invalid definition of: " + enum_def->GetFullyQualifiedName();
+      return false;
+    }
+    if (enum_def->is_union) {
+      types_.Add(enum_def->GetFullyQualifiedName(),
+                 new Type(BASE_TYPE_UNION, nullptr, enum_def));
+    } else {
+      types_.Add(enum_def->GetFullyQualifiedName(),
+                 new Type(enum_def->underlying_type));
+    }
+  }
+  for (uoffset_t i = 0; i < objects->size(); i++) {
+    auto struct_def = structs_.vec[i];
+    if (!struct_def->Deserialize(*this, objects->Get(i))) {
+      error_ = "invalid definition of: " + struct_def->GetFullyQualifiedName();
+      return false;
+    }
+    if (objects->Get(i) == schema->root_table()) root_struct_def_ = struct_def;
+  }
+  auto services = schema->services();
+  if (services) {
+    for (auto it = services->begin(); it != services->end(); ++it) {
+      auto service_def = new ServiceDef();
+      set_name(*service_def, it->name()->str());
+      if (services_.Add(it->name()->str(), service_def)) {
+        error_ = "service already exists: " + it->name()->str();
+        return false;
+      }
+      if (!service_def->Deserialize(*this, *it)) {
+        error_ = "invalid definition of: " + it->name()->str();
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool StructDef::Deserialize(Parser &parser, const reflection::Object *object) {
+  fixed = object->is_struct();
+  predecl = false;
+  minalign = static_cast<size_t>(object->minalign());
+  bytesize = static_cast<size_t>(object->bytesize());
+  if (!DeserializeAttributes(parser, object->attributes())) return false;
+  sortbysize = attributes.Lookup("original_order") == nullptr && !fixed;
+  // Fields are sorted by name, restore the order in which they're declared.
+  auto of = object->fields();
+  std::vector<const reflection::Field *> fields_by_id(of->size(), nullptr);
+  for (auto it = of->begin(); it != of->end(); ++it) {
+    if (it->id() >= of->size() || fields_by_id[it->id()]) return false;
+    fields_by_id[it->id()] = *it;
+  }
+  for (auto it = fields_by_id.begin(); it != fields_by_id.end(); ++it) {
+    auto field_def = new FieldDef();
+    if (fields.Add((*it)->name()->str(), field_def) ||
+        !field_def->Deserialize(parser, *it)) {
+      return false;
+    }
+    if (field_def->key) has_key = true;
+    // Like types in the schema, this may be relative to the namespace.
+    auto nested = field_def->attributes.Lookup("nested_flatbuffer");
+    if (nested) {
+      field_def->nested_flatbuffer = parser.LookupStruct(
+          defined_namespace->GetFullyQualifiedName(nested->constant));
+      if (!field_def->nested_flatbuffer)
+        field_def->nested_flatbuffer = parser.LookupStruct(nested->constant);
+      if (!field_def->nested_flatbuffer) return false;
+    }
+    if (fixed) {
+      // Padding isn't stored, but follows from the offsets.
+      auto size = InlineSize(field_def->value.type);
+      auto end = it + 1 == fields_by_id.end() ? bytesize : (*(it + 1))->offset();
+      if (field_def->value.offset + size > end) return false;
+      field_def->padding = end - field_def->value.offset - size;
+    }
+  }
+  if (parser.opts.binary_schema_comments && object->documentation()) {
+    for (auto it = object->documentation()->begin();
+         it != object->documentation()->end(); ++it) {
+      doc_comment.push_back(it->str());
+    }
+  }
+  return true;
+}
+
+bool FieldDef::Deserialize(Parser &parser, const reflection::Field *field) {
+  name = field->name()->str();
+  if (!value.type.Deserialize(parser, field->type())) return false;
+  value.offset = field->offset();
+  auto base_type = value.type.base_type;
+  if (IsInteger(base_type)) {
+    value.constant = base_type == BASE_TYPE_ULONG
+                         ? NumToString(static_cast<uint64_t>(
+                               field->default_integer()))
+                         : NumToString(field->default_integer());
+    // Range checks the default and stores it in value.integer.
+    if (ConvertScalar(value, parser, false).Check()) return false;
+  } else if (IsFloat(base_type)) {
+    value.constant = NumToString(field->default_real());
+    value.real = base_type == BASE_TYPE_FLOAT
+                     ? static_cast<float>(field->default_real())
+                     : field->default_real();
+  }
+  deprecated = field->deprecated();
+  required = field->required();
+  key = field->key();
+  if (!DeserializeAttributes(parser, field->attributes())) return false;
+  native_inline = attributes.Lookup("native_inline") != nullptr;
+  if (attributes.Lookup("flexbuffer")) {
+    flexbuffer = true;
+    parser.uses_flexbuffers_ = true;
+  }
+  if (parser.opts.binary_schema_comments && field->documentation()) {
+    for (auto it = field->documentation()->begin();
+         it != field->documentation()->end(); ++it) {
+      doc_comment.push_back(it->str());
+    }
+  }
+  return true;
+}
+
+bool RPCCall::Deserialize(Parser &parser, const reflection::RPCCall *call) {
+  name = call->name()->str();
+  request = parser.LookupStruct(call->request()->name()->str());
+  response = parser.LookupStruct(call->response()->name()->str());
+  if (!request || !response) return false;
+  if (!DeserializeAttributes(parser, call->attributes())) return false;
+  if (parser.opts.binary_schema_comments && call->documentation()) {
+    for (auto it = call->documentation()->begin();
+         it != call->documentation()->end(); ++it) {
+      doc_comment.push_back(it->str());
+    }
+  }
+  return true;
+}
+
+bool ServiceDef::Deserialize(Parser &parser,
+                             const reflection::Service *service) {
+  if (service->calls()) {
+    for (auto it = service->calls()->begin(); it != service->calls()->end();
+         ++it) {
+      auto call = new RPCCall();
+      if (calls.Add(it->name()->str(), call) ||
+          !call->Deserialize(parser, *it)) {
+        return false;
+      }
+    }
+  }
+  if (!DeserializeAttributes(parser, service->attributes())) return false;
+  if (parser.opts.binary_schema_comments && service->documentation()) {
+    for (auto it = service->documentation()->begin();
+         it != service->documentation()->end(); ++it) {
+      doc_comment.push_back(it->str());
+    }
+  }
+  return true;
+}
+
+bool EnumDef::Deserialize(Parser &parser, const reflection::Enum *enum_def) {
+  is_union = enum_def->is_union();
+  if (!underlying_type.Deserialize(parser, enum_def->underlying_type()))
+    return false;
+  std::set<std::pair<BaseType, StructDef *>> union_types;
+  auto values = enum_def->values();
+  for (auto it = values->begin(); it != values->end(); ++it) {
+    auto enum_val = new EnumVal(it->name()->str(), it->value());
+    if (vals.Add(enum_val->name, enum_val) ||
+        !enum_val->Deserialize(parser, *it)) {
+      return false;
+    }
+    if (is_union) {
+      auto union_type_key = std::make_pair(enum_val->union_type.base_type,
+                                           enum_val->union_type.struct_def);
+      if (!union_types.insert(union_type_key).second)
+        uses_multiple_type_instances = true;
+    }
+  }
+  BuildLookupTables();
+  if (!DeserializeAttributes(parser, enum_def->attributes())) return false;
+  if (parser.opts.binary_schema_comments && enum_def->documentation()) {
+    for (auto it = enum_def->documentation()->begin();
+         it != enum_def->documentation()->end(); ++it) {
+      doc_comment.push_back(it->str());
+    }
+  }
+  return true;
+}
+
+bool EnumVal::Deserialize(const Parser &parser,
+                          const reflection::EnumVal *val) {
+  if (val->union_type() && !union_type.Deserialize(parser, val->union_type()))
+    return false;
+  if (parser.opts.binary_schema_comments && val->documentation()) {
+    for (auto it = val->documentation()->begin();
+         it != val->documentation()->end(); ++it) {
+      doc_comment.push_back(it->str());
+    }
+  }
+  return true;
+}
+
+bool Type::Deserialize(const Parser &parser, const reflection::Type *type) {
+  if (type == nullptr) return true;
+  base_type = static_cast<BaseType>(type->base_type());
+  element = static_cast<BaseType>(type->element());
+  if (base_type > BASE_TYPE_UNION || element > BASE_TYPE_UNION) return false;
+  if (type->index() >= 0) {
+    auto index = static_cast<size_t>(type->index());
+    if (base_type == BASE_TYPE_STRUCT ||
+        (base_type == BASE_TYPE_VECTOR && element == BASE_TYPE_STRUCT)) {
+      if (index >= parser.structs_.vec.size()) return false;
+      struct_def = parser.structs_.vec[index];
+    } else {
+      if (index >= parser.enums_.vec.size()) return false;
+      enum_def = parser.enums_.vec[index];
+    }
+  }
+  return true;
+}
+
+bool Definition::DeserializeAttributes(
+    Parser &parser, const Vector<Offset<reflection::KeyValue>> *attrs) {
+  if (attrs == nullptr) return true;
+  for (uoffset_t i = 0; i < attrs->size(); ++i) {
+    auto kv = attrs->Get(i);
+    auto value = new Value();
+    if (kv->value()) { value->constant = kv->value()->str(); }
+    if (attributes.Add(kv->key()->str(), value)) {
+      delete value;
+      return false;
+    }
+    // Non-builtin attributes have to be known to be serialized again.
+    if (parser.known_attributes_.find(kv->key()->str()) ==
+        parser.known_attributes_.end()) {
+      parser.known_attributes_[kv->key()->str()] = false;
+    }
+  }
+  return true;
+}
+
 std::string Parser::ConformTo(const Parser &base) {
   for (auto sit = structs_.vec.begin(); sit != structs_.vec.end(); ++sit) {
     auto &struct_def = **sit;
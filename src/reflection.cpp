@@ -15,6 +15,7 @@
  */
 
 #include "flatbuffers/reflection.h"
+#include "flatbuffers/flexbuffers.h"
 #include "flatbuffers/util.h"
 
 // Helper functionality for reflection.
@@ -365,6 +366,48 @@ void CopyInline(FlatBufferBuilder &fbb, const reflection::Field &fielddef,
   fbb.TrackField(fielddef.offset(), fbb.GetSize());
 }
 
+// Copies the vector stored in "fielddef" of "table" into "fbb", returning
+// its offset in the builder.
+uoffset_t CopyVector(FlatBufferBuilder &fbb, const reflection::Schema &schema,
+                     const reflection::Field &fielddef, const Table &table,
+                     bool use_string_pooling) {
+  auto vec = table.GetPointer<const Vector<Offset<Table>> *>(fielddef.offset());
+  auto element_base_type = fielddef.type()->element();
+  auto elemobjectdef = element_base_type == reflection::Obj
+                           ? schema.objects()->Get(fielddef.type()->index())
+                           : nullptr;
+  switch (element_base_type) {
+    case reflection::String: {
+      std::vector<Offset<const String *>> elements(vec->size());
+      auto vec_s = reinterpret_cast<const Vector<Offset<String>> *>(vec);
+      for (uoffset_t i = 0; i < vec_s->size(); i++) {
+        elements[i] = use_string_pooling
+                          ? fbb.CreateSharedString(vec_s->Get(i)).o
+                          : fbb.CreateString(vec_s->Get(i)).o;
+      }
+      return fbb.CreateVector(elements).o;
+    }
+    case reflection::Obj: {
+      if (!elemobjectdef->is_struct()) {
+        std::vector<Offset<const Table *>> elements(vec->size());
+        for (uoffset_t i = 0; i < vec->size(); i++) {
+          elements[i] = CopyTable(fbb, schema, *elemobjectdef, *vec->Get(i));
+        }
+        return fbb.CreateVector(elements).o;
+      }
+    }
+    // FALL-THRU
+    default: {  // Scalars and structs.
+      auto element_size = GetTypeSize(element_base_type);
+      if (elemobjectdef && elemobjectdef->is_struct())
+        element_size = elemobjectdef->bytesize();
+      fbb.StartVector(vec->size(), element_size);
+      fbb.PushBytes(vec->Data(), element_size * vec->size());
+      return fbb.EndVector(vec->size());
+    }
+  }
+}
+
 Offset<const Table *> CopyTable(FlatBufferBuilder &fbb,
                                 const reflection::Schema &schema,
                                 const reflection::Object &objectdef,
@@ -401,47 +444,7 @@ Offset<const Table *> CopyTable(FlatBufferBuilder &fbb,
         break;
       }
       case reflection::Vector: {
-        auto vec =
-            table.GetPointer<const Vector<Offset<Table>> *>(fielddef.offset());
-        auto element_base_type = fielddef.type()->element();
-        auto elemobjectdef =
-            element_base_type == reflection::Obj
-                ? schema.objects()->Get(fielddef.type()->index())
-                : nullptr;
-        switch (element_base_type) {
-          case reflection::String: {
-            std::vector<Offset<const String *>> elements(vec->size());
-            auto vec_s = reinterpret_cast<const Vector<Offset<String>> *>(vec);
-            for (uoffset_t i = 0; i < vec_s->size(); i++) {
-              elements[i] = use_string_pooling
-                                ? fbb.CreateSharedString(vec_s->Get(i)).o
-                                : fbb.CreateString(vec_s->Get(i)).o;
-            }
-            offset = fbb.CreateVector(elements).o;
-            break;
-          }
-          case reflection::Obj: {
-            if (!elemobjectdef->is_struct()) {
-              std::vector<Offset<const Table *>> elements(vec->size());
-              for (uoffset_t i = 0; i < vec->size(); i++) {
-                elements[i] =
-                    CopyTable(fbb, schema, *elemobjectdef, *vec->Get(i));
-              }
-              offset = fbb.CreateVector(elements).o;
-              break;
-            }
-          }
-          // FALL-THRU
-          default: {  // Scalars and structs.
-            auto element_size = GetTypeSize(element_base_type);
-            if (elemobjectdef && elemobjectdef->is_struct())
-              element_size = elemobjectdef->bytesize();
-            fbb.StartVector(vec->size(), element_size);
-            fbb.PushBytes(vec->Data(), element_size * vec->size());
-            offset = fbb.EndVector(vec->size());
-            break;
-          }
-        }
+        offset = CopyVector(fbb, schema, fielddef, table, use_string_pooling);
         break;
       }
       default:  // Scalars.
@@ -488,6 +491,528 @@ Offset<const Table *> CopyTable(FlatBufferBuilder &fbb,
   }
 }
 
+ColumnProjection::ColumnProjection(const reflection::Schema &schema,
+                                   const reflection::Field &vector_field)
+    : schema_(schema), vector_field_(vector_field), rows_(0) {
+  FLATBUFFERS_ASSERT(vector_field.type()->base_type() == reflection::Vector &&
+                     vector_field.type()->element() == reflection::Obj);
+  Level row;
+  row.objectdef = schema.objects()->Get(vector_field.type()->index());
+  row.parent = -1;
+  row.parent_slot = 0;
+  row.last_vtable = nullptr;
+  row.last_shape = 0;
+  levels_.push_back(row);
+}
+
+size_t ColumnProjection::AddSlot(int level_idx, voffset_t field) {
+  auto &level = levels_[level_idx];
+  auto it = std::find(level.fields.begin(), level.fields.end(), field);
+  if (it != level.fields.end()) return it - level.fields.begin();
+  // The shapes decoded so far don't include the new slot.
+  level.shapes.clear();
+  level.offsets.clear();
+  level.last_vtable = nullptr;
+  level.fields.push_back(field);
+  return level.fields.size() - 1;
+}
+
+bool ColumnProjection::AddColumn(const std::string &path) {
+  int level_idx = 0;
+  auto objectdef = levels_[0].objectdef;
+  const reflection::Field *field = nullptr;
+  bool in_struct = false;
+  ColumnSource source;
+  source.struct_offset = 0;
+  for (size_t start = 0;;) {
+    auto end = path.find('.', start);
+    if (field) {
+      // Descend into the table or struct stored in the previous field.
+      if (field->type()->base_type() != reflection::Obj) return false;
+      objectdef = schema_.objects()->Get(field->type()->index());
+      if (in_struct) {
+        source.struct_offset += field->offset();
+      } else if (objectdef->is_struct()) {
+        source.slot = AddSlot(level_idx, field->offset());
+        in_struct = true;
+      } else {
+        auto slot = AddSlot(level_idx, field->offset());
+        auto child = levels_.size();
+        for (size_t i = 1; i < levels_.size(); i++) {
+          if (levels_[i].parent == level_idx && levels_[i].parent_slot == slot)
+            child = i;
+        }
+        if (child == levels_.size()) {
+          Level level;
+          level.objectdef = objectdef;
+          level.parent = level_idx;
+          level.parent_slot = slot;
+          level.last_vtable = nullptr;
+          level.last_shape = 0;
+          levels_.push_back(level);
+        }
+        level_idx = static_cast<int>(child);
+      }
+    }
+    auto name = path.substr(start, end == std::string::npos ? end : end - start);
+    field = objectdef->fields()->LookupByKey(name.c_str());
+    if (!field) return false;
+    if (end == std::string::npos) break;
+    start = end + 1;
+  }
+  auto base_type = field->type()->base_type();
+  if (!IsScalar(base_type) && base_type != reflection::String) return false;
+  if (in_struct) {
+    source.struct_offset += field->offset();
+  } else {
+    source.slot = AddSlot(level_idx, field->offset());
+  }
+  source.field = field;
+  source.level = level_idx;
+  sources_.push_back(source);
+  columns_.push_back(ProjectedColumn());
+  columns_.back().path = path;
+  columns_.back().type = base_type;
+  return true;
+}
+
+const voffset_t *ColumnProjection::LookupShape(Level &level,
+                                               const Table &table) {
+  auto vtable = table.GetVTable();
+  if (vtable != level.last_vtable) {
+    auto it = level.shapes.find(vtable);
+    if (it == level.shapes.end()) {
+      // First table with this vtable, decode the offsets of all our slots.
+      it = level.shapes.insert(std::make_pair(vtable, level.shapes.size()))
+               .first;
+      for (auto f = level.fields.begin(); f != level.fields.end(); ++f) {
+        level.offsets.push_back(table.GetOptionalFieldOffset(*f));
+      }
+    }
+    level.last_vtable = vtable;
+    level.last_shape = it->second;
+  }
+  return vector_data(level.offsets) + level.last_shape * level.fields.size();
+}
+
+void ColumnProjection::Project(const Table &table) {
+  auto rows =
+      table.GetPointer<const Vector<Offset<Table>> *>(vector_field_.offset());
+  if (!rows) return;
+  // Vtables are cached by address, which another buffer may reuse.
+  for (auto it = levels_.begin(); it != levels_.end(); ++it) {
+    it->shapes.clear();
+    it->offsets.clear();
+    it->last_vtable = nullptr;
+  }
+  for (auto it = columns_.begin(); it != columns_.end(); ++it) {
+    it->present.reserve(rows_ + rows->size());
+  }
+  // The table of each level for the current row, and its field offsets.
+  std::vector<const uint8_t *> tables(levels_.size());
+  std::vector<const voffset_t *> shapes(levels_.size());
+  for (uoffset_t i = 0; i < rows->size(); i++) {
+    for (size_t l = 0; l < levels_.size(); l++) {
+      auto &level = levels_[l];
+      const uint8_t *t = nullptr;
+      if (!l) {
+        t = reinterpret_cast<const uint8_t *>(rows->Get(i));
+      } else if (tables[level.parent]) {
+        auto field_offset = shapes[level.parent][level.parent_slot];
+        if (field_offset) {
+          auto p = tables[level.parent] + field_offset;
+          t = p + ReadScalar<uoffset_t>(p);
+        }
+      }
+      tables[l] = t;
+      shapes[l] =
+          t ? LookupShape(level, *reinterpret_cast<const Table *>(t)) : nullptr;
+    }
+    for (size_t c = 0; c < columns_.size(); c++) {
+      auto &source = sources_[c];
+      auto &column = columns_[c];
+      const uint8_t *p = nullptr;
+      if (tables[source.level]) {
+        auto field_offset = shapes[source.level][source.slot];
+        if (field_offset)
+          p = tables[source.level] + field_offset + source.struct_offset;
+      }
+      column.present.push_back(p != nullptr);
+      if (column.type == reflection::String) {
+        column.strings.push_back(
+            p ? reinterpret_cast<const String *>(p + ReadScalar<uoffset_t>(p))
+              : nullptr);
+      } else if (IsFloat(column.type)) {
+        column.floats.push_back(p ? GetAnyValueF(column.type, p)
+                                  : source.field->default_real());
+      } else {
+        column.ints.push_back(p ? GetAnyValueI(column.type, p)
+                                : source.field->default_integer());
+      }
+    }
+  }
+  rows_ += rows->size();
+}
+
+// Operations stored in a patch created by DiffFlatBuffers. Each operation is
+// a FlexBuffer vector of [opcode, path, data], where path is a typed vector of
+// field offsets, each followed by an element index if the field is a vector
+// that is being descended into, and data is a blob.
+enum PatchOpcode {
+  kPatchInline,  // Overwrite a scalar or struct field with data.
+  kPatchVector,  // Resize a vector of scalars or structs, then overwrite it.
+  kPatchString,  // Replace a string, resizing the buffer if needed.
+  kPatchObject,  // Point an offset at a copy of the FlatBuffer in data.
+  kPatchRoot     // Replace the entire buffer with data.
+};
+
+// Walks two FlatBuffers of the same type in parallel, collecting the in-place
+// operations that turn the first into the second.
+class DiffContext {
+ public:
+  explicit DiffContext(const reflection::Schema &schema)
+      : schema_(schema), root_changed_(false) {}
+
+  // Returns false if the differences can't be expressed as in-place changes
+  // to "a", such as fields that are not stored in "a" but are in "b".
+  bool DiffTable(const reflection::Object &objectdef, const Table &a,
+                 const Table &b) {
+    auto fielddefs = objectdef.fields();
+    for (auto it = fielddefs->begin(); it != fielddefs->end(); ++it) {
+      auto &fielddef = **it;
+      path_.push_back(fielddef.offset());
+      auto ok = IsScalar(fielddef.type()->base_type())
+                    ? DiffScalar(fielddef, a, b)
+                    : DiffField(objectdef, fielddef, a, b);
+      path_.pop_back();
+      if (!ok) return false;
+    }
+    return true;
+  }
+
+  void Finish(const uint8_t *newbuf, size_t newlen,
+              std::vector<uint8_t> *patch) {
+    flexbuffers::Builder flex;
+    auto start = flex.StartVector();
+    if (root_changed_) {
+      // Nothing in the old buffer can be reused.
+      ops_.clear();
+      AddOp(kPatchRoot, newbuf, newlen);
+    }
+    for (auto it = ops_.begin(); it != ops_.end(); ++it) {
+      auto op_start = flex.StartVector();
+      flex.UInt(it->code);
+      flex.Vector(it->path);
+      flex.Blob(it->data);
+      flex.EndVector(op_start, false, false);
+    }
+    flex.EndVector(start, false, false);
+    flex.Finish();
+    *patch = flex.GetBuffer();
+  }
+
+  void RootChanged() { root_changed_ = true; }
+
+ private:
+  struct Op {
+    PatchOpcode code;
+    std::vector<uoffset_t> path;
+    std::vector<uint8_t> data;
+  };
+
+  void AddOp(PatchOpcode code, const uint8_t *data, size_t size) {
+    ops_.push_back(Op());
+    ops_.back().code = code;
+    ops_.back().path = path_;
+    ops_.back().data.assign(data, data + size);
+  }
+
+  void AddCopy(FlatBufferBuilder &fbb, uoffset_t offset) {
+    fbb.Finish(Offset<void>(offset));
+    AddOp(kPatchObject, fbb.GetBufferPointer(), fbb.GetSize());
+  }
+
+  bool DiffScalar(const reflection::Field &fielddef, const Table &a,
+                  const Table &b) {
+    auto base_type = fielddef.type()->base_type();
+    if (IsFloat(base_type)) {
+      auto fa = GetAnyFieldF(a, fielddef);
+      auto fb = GetAnyFieldF(b, fielddef);
+      if (fa == fb || (fa != fa && fb != fb)) return true;  // Equal or NaN.
+    } else if (GetAnyFieldI(a, fielddef) == GetAnyFieldI(b, fielddef)) {
+      return true;
+    }
+    // The field needs to be stored in "a" for us to be able to change it.
+    if (!a.CheckField(fielddef.offset())) return false;
+    uint8_t data[sizeof(largest_scalar_t)];
+    auto size = GetTypeSize(base_type);
+    auto pb = b.GetAddressOf(fielddef.offset());
+    if (pb) {
+      memcpy(data, pb, size);
+    } else if (IsFloat(base_type)) {
+      SetAnyValueF(base_type, data, fielddef.default_real());
+    } else {
+      SetAnyValueI(base_type, data, fielddef.default_integer());
+    }
+    AddOp(kPatchInline, data, size);
+    return true;
+  }
+
+  bool DiffField(const reflection::Object &objectdef,
+                 const reflection::Field &fielddef, const Table &a,
+                 const Table &b) {
+    auto pa = a.GetAddressOf(fielddef.offset());
+    auto pb = b.GetAddressOf(fielddef.offset());
+    auto base_type = fielddef.type()->base_type();
+    if (base_type == reflection::Vector &&
+        fielddef.type()->element() == reflection::Union && (pa || pb)) {
+      // Vectors of unions are not supported by reflection.
+      RootChanged();
+      return false;
+    }
+    if (!pa && !pb) return true;
+    // We can change existing values, but not add or remove them.
+    if (!pa || !pb) return false;
+    switch (base_type) {
+      case reflection::String:
+        DiffString(GetFieldS(a, fielddef), GetFieldS(b, fielddef));
+        return true;
+      case reflection::Obj: {
+        auto &subobjectdef = *schema_.objects()->Get(fielddef.type()->index());
+        if (subobjectdef.is_struct()) {
+          if (memcmp(pa, pb, subobjectdef.bytesize()))
+            AddOp(kPatchInline, pb, subobjectdef.bytesize());
+        } else {
+          DiffSubTable(subobjectdef, *GetFieldT(a, fielddef),
+                       *GetFieldT(b, fielddef));
+        }
+        return true;
+      }
+      case reflection::Union: {
+        auto &def_a = GetUnionType(schema_, objectdef, fielddef, a);
+        auto &def_b = GetUnionType(schema_, objectdef, fielddef, b);
+        if (&def_a == &def_b) {
+          DiffSubTable(def_a, *GetFieldT(a, fielddef), *GetFieldT(b, fielddef));
+        } else {
+          // Our "_type" field is diffed separately.
+          FlatBufferBuilder fbb;
+          AddCopy(fbb,
+                  CopyTable(fbb, schema_, def_b, *GetFieldT(b, fielddef)).o);
+        }
+        return true;
+      }
+      case reflection::Vector: DiffVector(fielddef, a, b); return true;
+      default: FLATBUFFERS_ASSERT(false); return false;
+    }
+  }
+
+  void DiffString(const String *a, const String *b) {
+    if (a->size() != b->size() || memcmp(a->Data(), b->Data(), a->size()))
+      AddOp(kPatchString, b->Data(), b->size());
+  }
+
+  // Diffs two tables stored at the current path, falling back to replacing
+  // the table with a copy of "b" if that doesn't work.
+  void DiffSubTable(const reflection::Object &objectdef, const Table &a,
+                    const Table &b) {
+    auto num_ops = ops_.size();
+    if (DiffTable(objectdef, a, b)) return;
+    ops_.resize(num_ops);
+    FlatBufferBuilder fbb;
+    AddCopy(fbb, CopyTable(fbb, schema_, objectdef, b).o);
+  }
+
+  void DiffVector(const reflection::Field &fielddef, const Table &a,
+                  const Table &b) {
+    auto va = GetFieldAnyV(a, fielddef);
+    auto vb = GetFieldAnyV(b, fielddef);
+    auto element_base_type = fielddef.type()->element();
+    auto elemobjectdef = element_base_type == reflection::Obj
+                             ? schema_.objects()->Get(fielddef.type()->index())
+                             : nullptr;
+    if (element_base_type != reflection::String &&
+        (!elemobjectdef || elemobjectdef->is_struct())) {
+      // Scalars and structs can be patched as one block of memory.
+      auto elem_size = GetTypeSizeInline(element_base_type,
+                                         fielddef.type()->index(), schema_);
+      if (va->size() != vb->size() ||
+          memcmp(va->Data(), vb->Data(), elem_size * va->size())) {
+        AddOp(kPatchVector, vb->Data(), elem_size * vb->size());
+      }
+      return;
+    }
+    if (va->size() != vb->size()) {
+      FlatBufferBuilder fbb;
+      AddCopy(fbb, CopyVector(fbb, schema_, fielddef, b, false));
+      return;
+    }
+    for (uoffset_t i = 0; i < va->size(); i++) {
+      path_.push_back(i);
+      if (elemobjectdef) {
+        DiffSubTable(*elemobjectdef, *GetAnyVectorElemPointer<const Table>(va, i),
+                     *GetAnyVectorElemPointer<const Table>(vb, i));
+      } else {
+        DiffString(GetAnyVectorElemPointer<const String>(va, i),
+                   GetAnyVectorElemPointer<const String>(vb, i));
+      }
+      path_.pop_back();
+    }
+  }
+
+  const reflection::Schema &schema_;
+  std::vector<uoffset_t> path_;
+  std::vector<Op> ops_;
+  bool root_changed_;
+};
+
+void DiffFlatBuffers(const reflection::Schema &schema, const uint8_t *oldbuf,
+                     const uint8_t *newbuf, size_t newlen,
+                     std::vector<uint8_t> *patch,
+                     const reflection::Object *root_table) {
+  DiffContext diff(schema);
+  if (!diff.DiffTable(root_table ? *root_table : *schema.root_table(),
+                      *GetAnyRoot(oldbuf), *GetAnyRoot(newbuf))) {
+    diff.RootChanged();
+  }
+  diff.Finish(newbuf, newlen, patch);
+}
+
+// Where a patch operation applies: a field of a table, or if "is_element" is
+// set, an element of the vector stored in that field.
+struct PatchLocation {
+  Table *table;
+  const reflection::Field *field;
+  bool is_element;
+  uoffset_t index;
+};
+
+bool ResolvePatchPath(const reflection::Schema &schema,
+                      const reflection::Object &root_table,
+                      const flexbuffers::TypedVector &path, uint8_t *flatbuf,
+                      PatchLocation *loc) {
+  auto table = GetAnyRoot(flatbuf);
+  auto objectdef = &root_table;
+  for (size_t i = 0; i < path.size();) {
+    auto field_offset = path[i++].AsUInt16();
+    const reflection::Field *field = nullptr;
+    auto fielddefs = objectdef->fields();
+    for (auto it = fielddefs->begin(); it != fielddefs->end(); ++it) {
+      if (it->offset() == field_offset) field = *it;
+    }
+    if (!field) return false;
+    loc->table = table;
+    loc->field = field;
+    loc->is_element = false;
+    if (i == path.size()) return true;
+    // Descend into the table this field refers to.
+    auto type = field->type();
+    switch (type->base_type()) {
+      case reflection::Obj:
+        objectdef = schema.objects()->Get(type->index());
+        table = GetFieldT(*table, *field);
+        break;
+      case reflection::Union:
+        objectdef = &GetUnionType(schema, *objectdef, *field, *table);
+        table = GetFieldT(*table, *field);
+        break;
+      case reflection::Vector: {
+        auto vec = GetFieldAnyV(*table, *field);
+        loc->is_element = true;
+        loc->index = path[i++].AsUInt32();
+        if (!vec || loc->index >= vec->size()) return false;
+        if (i == path.size()) return true;
+        if (type->element() != reflection::Obj) return false;
+        objectdef = schema.objects()->Get(type->index());
+        table = const_cast<Table *>(
+            GetAnyVectorElemPointer<const Table>(vec, loc->index));
+        break;
+      }
+      default: return false;
+    }
+    if (!table || objectdef->is_struct()) return false;
+  }
+  return false;
+}
+
+bool ApplyPatch(const reflection::Schema &schema, const uint8_t *patch,
+                size_t patch_len, std::vector<uint8_t> *flatbuf,
+                const reflection::Object *root_table) {
+  auto &rootdef = root_table ? *root_table : *schema.root_table();
+  auto ops = flexbuffers::GetRoot(patch, patch_len).AsVector();
+  for (size_t i = 0; i < ops.size(); i++) {
+    auto op = ops[i].AsVector();
+    auto code = op[0].AsUInt32();
+    auto path = op[1].AsTypedVector();
+    auto data = op[2].AsBlob();
+    if (code == kPatchRoot) {
+      flatbuf->assign(data.data(), data.data() + data.size());
+      continue;
+    }
+    PatchLocation loc;
+    if (!ResolvePatchPath(schema, rootdef, path, vector_data(*flatbuf), &loc))
+      return false;
+    auto &fielddef = *loc.field;
+    auto type = fielddef.type();
+    switch (code) {
+      case kPatchInline: {
+        auto field_ptr = loc.table->GetAddressOf(fielddef.offset());
+        if (loc.is_element || !field_ptr ||
+            data.size() != GetTypeSizeInline(type->base_type(), type->index(),
+                                             schema))
+          return false;
+        memcpy(field_ptr, data.data(), data.size());
+        break;
+      }
+      case kPatchVector: {
+        auto vec = GetFieldAnyV(*loc.table, fielddef);
+        if (loc.is_element || !vec) return false;
+        auto elem_size = static_cast<uoffset_t>(
+            GetTypeSizeInline(type->element(), type->index(), schema));
+        auto newsize = static_cast<uoffset_t>(data.size() / elem_size);
+        if (newsize * elem_size != data.size()) return false;
+        if (newsize != vec->size()) {
+          ResizeAnyVector(schema, newsize, vec, vec->size(), elem_size, flatbuf,
+                          root_table);
+          ResolvePatchPath(schema, rootdef, path, vector_data(*flatbuf), &loc);
+          vec = GetFieldAnyV(*loc.table, fielddef);
+        }
+        memcpy(vec->Data(), data.data(), data.size());
+        break;
+      }
+      case kPatchString: {
+        const String *str = nullptr;
+        if (loc.is_element && type->element() == reflection::String) {
+          str = GetAnyVectorElemPointer<const String>(
+              GetFieldAnyV(*loc.table, fielddef), loc.index);
+        } else if (!loc.is_element && type->base_type() == reflection::String) {
+          str = GetFieldS(*loc.table, fielddef);
+        }
+        if (!str) return false;
+        SetString(schema,
+                  std::string(reinterpret_cast<const char *>(data.data()),
+                              data.size()),
+                  str, flatbuf, root_table);
+        break;
+      }
+      case kPatchObject: {
+        auto obj = AddFlatBuffer(*flatbuf, data.data(), data.size());
+        // The buffer may have been reallocated.
+        ResolvePatchPath(schema, rootdef, path, vector_data(*flatbuf), &loc);
+        if (loc.is_element) {
+          reinterpret_cast<Vector<Offset<Table>> *>(
+              GetFieldAnyV(*loc.table, fielddef))
+              ->MutateOffset(loc.index, obj);
+        } else if (!loc.table->SetPointer(fielddef.offset(), obj)) {
+          return false;
+        }
+        break;
+      }
+      default: return false;
+    }
+  }
+  return true;
+}
+
 bool VerifyStruct(flatbuffers::Verifier &v,
                   const flatbuffers::Table &parent_table,
                   voffset_t field_offset, const reflection::Object &obj,
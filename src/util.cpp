@@ -18,6 +18,15 @@
 
 #include <vector>
 
+// clang-format off
+#if !defined(_WIN32) && (defined(__unix__) || defined(__APPLE__))
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <unistd.h>
+  #define FLATBUFFERS_HAS_MMAP
+#endif
+// clang-format on
+
 namespace flatbuffers {
 
 bool FileExistsRaw(const char *name) {
@@ -117,4 +126,96 @@ bool SaveFile(const char *name, const char *buf, size_t len, bool binary) {
 	return true;
 }
 
+bool MappedFile::Map(const char *name, int hints) {
+  Unmap();
+  if (DirExists(name)) return false;
+  // clang-format off
+  #if defined(_WIN32) || defined(FLATBUFFERS_HAS_MMAP)
+    // Respect custom loaders, e.g. for files that are not on the filesystem.
+    auto can_map = g_load_file_function == LoadFileRaw;
+  #else
+    (void)hints;
+    auto can_map = false;
+  #endif
+  // clang-format on
+  if (!can_map) {
+    if (!LoadFile(name, true, &loaded_)) return false;
+    data_ = reinterpret_cast<const uint8_t *>(loaded_.data());
+    size_ = loaded_.size();
+    return true;
+  }
+  // clang-format off
+  #if defined(_WIN32)
+    (void)hints;
+    auto file = CreateFileA(name, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size)) {
+      CloseHandle(file);
+      return false;
+    }
+    size_ = static_cast<size_t>(file_size.QuadPart);
+    if (size_) {
+      // The view keeps the file mapped after the handles are closed.
+      auto mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0,
+                                        nullptr);
+      mapping_ = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0)
+                         : nullptr;
+      if (mapping) CloseHandle(mapping);
+    }
+    CloseHandle(file);
+  #elif defined(FLATBUFFERS_HAS_MMAP)
+    auto fd = open(name, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat file_info;
+    if (fstat(fd, &file_info) != 0) {
+      close(fd);
+      return false;
+    }
+    size_ = static_cast<size_t>(file_info.st_size);
+    if (size_) {
+      auto addr = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+      mapping_ = addr != MAP_FAILED ? addr : nullptr;
+    }
+    close(fd);
+    if (mapping_) {
+      // These are only hints, so it is fine if any of them fail.
+      if (hints & kAccessSequential)
+        madvise(mapping_, size_, MADV_SEQUENTIAL);
+      if (hints & kAccessRandom) madvise(mapping_, size_, MADV_RANDOM);
+      if (hints & kAccessWillNeed) madvise(mapping_, size_, MADV_WILLNEED);
+      #ifdef MADV_HUGEPAGE
+        if (hints & kAccessHugePages) madvise(mapping_, size_, MADV_HUGEPAGE);
+      #endif
+    }
+  #endif
+  // clang-format on
+  if (!size_) {
+    // Empty files can't be mapped, but are valid.
+    data_ = reinterpret_cast<const uint8_t *>(loaded_.data());
+    return true;
+  }
+  if (!mapping_) {
+    size_ = 0;
+    return false;
+  }
+  data_ = reinterpret_cast<const uint8_t *>(mapping_);
+  return true;
+}
+
+void MappedFile::Unmap() {
+  // clang-format off
+  #if defined(_WIN32)
+    if (mapping_) UnmapViewOfFile(mapping_);
+  #elif defined(FLATBUFFERS_HAS_MMAP)
+    if (mapping_) munmap(mapping_, size_);
+  #endif
+  // clang-format on
+  mapping_ = nullptr;
+  data_ = nullptr;
+  size_ = 0;
+  loaded_.clear();
+}
+
 }  // namespace flatbuffers
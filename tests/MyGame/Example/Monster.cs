@@ -187,8 +187,20 @@ public struct Monster : IFlatbufferObject
 #endif
   public Color[] GetVectorOfEnumsArray() { return __p.__vector_as_array<Color>(98); }
   public bool MutateVectorOfEnums(int j, Color vector_of_enums) { int o = __p.__offset(98); if (o != 0) { __p.bb.PutSbyte(__p.__vector(o) + j * 1, (sbyte)vector_of_enums); return true; } else { return false; } }
+  public Referrable? VectorOfHashedReferrables(int j) { int o = __p.__offset(100); return o != 0 ? (Referrable?)(new Referrable()).__assign(__p.__indirect(__p.__vector(o) + j * 4), __p.bb) : null; }
+  public int VectorOfHashedReferrablesLength { get { int o = __p.__offset(100); return o != 0 ? __p.__vector_len(o) : 0; } }
+  public Referrable? VectorOfHashedReferrablesByKey(ulong key) { int o = __p.__offset(100); return o != 0 ? Referrable.__lookup_by_key(__p.__vector(o), key, __p.bb) : null; }
+  public uint VectorOfHashedReferrablesHashIndex(int j) { int o = __p.__offset(102); return o != 0 ? __p.bb.GetUint(__p.__vector(o) + j * 4) : (uint)0; }
+  public int VectorOfHashedReferrablesHashIndexLength { get { int o = __p.__offset(102); return o != 0 ? __p.__vector_len(o) : 0; } }
+#if ENABLE_SPAN_T
+  public Span<byte> GetVectorOfHashedReferrablesHashIndexBytes() { return __p.__vector_as_span(102); }
+#else
+  public ArraySegment<byte>? GetVectorOfHashedReferrablesHashIndexBytes() { return __p.__vector_as_arraysegment(102); }
+#endif
+  public uint[] GetVectorOfHashedReferrablesHashIndexArray() { return __p.__vector_as_array<uint>(102); }
+  public bool MutateVectorOfHashedReferrablesHashIndex(int j, uint vector_of_hashed_referrables_hash_index) { int o = __p.__offset(102); if (o != 0) { __p.bb.PutUint(__p.__vector(o) + j * 4, vector_of_hashed_referrables_hash_index); return true; } else { return false; } }
 
-  public static void StartMonster(FlatBufferBuilder builder) { builder.StartObject(48); }
+  public static void StartMonster(FlatBufferBuilder builder) { builder.StartObject(50); }
   public static void AddPos(FlatBufferBuilder builder, Offset<Vec3> posOffset) { builder.AddStruct(0, posOffset.Value, 0); }
   public static void AddMana(FlatBufferBuilder builder, short mana) { builder.AddShort(1, mana, 150); }
   public static void AddHp(FlatBufferBuilder builder, short hp) { builder.AddShort(2, hp, 100); }
@@ -284,6 +296,14 @@ public struct Monster : IFlatbufferObject
   public static VectorOffset CreateVectorOfEnumsVector(FlatBufferBuilder builder, Color[] data) { builder.StartVector(1, data.Length, 1); for (int i = data.Length - 1; i >= 0; i--) builder.AddSbyte((sbyte)data[i]); return builder.EndVector(); }
   public static VectorOffset CreateVectorOfEnumsVectorBlock(FlatBufferBuilder builder, Color[] data) { builder.StartVector(1, data.Length, 1); builder.Add(data); return builder.EndVector(); }
   public static void StartVectorOfEnumsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(1, numElems, 1); }
+  public static void AddVectorOfHashedReferrables(FlatBufferBuilder builder, VectorOffset vectorOfHashedReferrablesOffset) { builder.AddOffset(48, vectorOfHashedReferrablesOffset.Value, 0); }
+  public static VectorOffset CreateVectorOfHashedReferrablesVector(FlatBufferBuilder builder, Offset<Referrable>[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddOffset(data[i].Value); return builder.EndVector(); }
+  public static VectorOffset CreateVectorOfHashedReferrablesVectorBlock(FlatBufferBuilder builder, Offset<Referrable>[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static void StartVectorOfHashedReferrablesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddVectorOfHashedReferrablesHashIndex(FlatBufferBuilder builder, VectorOffset vectorOfHashedReferrablesHashIndexOffset) { builder.AddOffset(49, vectorOfHashedReferrablesHashIndexOffset.Value, 0); }
+  public static VectorOffset CreateVectorOfHashedReferrablesHashIndexVector(FlatBufferBuilder builder, uint[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddUint(data[i]); return builder.EndVector(); }
+  public static VectorOffset CreateVectorOfHashedReferrablesHashIndexVectorBlock(FlatBufferBuilder builder, uint[] data) { builder.StartVector(4, data.Length, 4); builder.Add(data); return builder.EndVector(); }
+  public static void StartVectorOfHashedReferrablesHashIndexVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
   public static Offset<Monster> EndMonster(FlatBufferBuilder builder) {
     int o = builder.EndObject();
     builder.Required(o, 10);  // name
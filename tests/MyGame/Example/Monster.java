@@ -157,8 +157,18 @@ public final class Monster extends Table {
   public ByteBuffer vectorOfEnumsAsByteBuffer() { return __vector_as_bytebuffer(98, 1); }
   public ByteBuffer vectorOfEnumsInByteBuffer(ByteBuffer _bb) { return __vector_in_bytebuffer(_bb, 98, 1); }
   public boolean mutateVectorOfEnums(int j, byte vector_of_enums) { int o = __offset(98); if (o != 0) { bb.put(__vector(o) + j * 1, vector_of_enums); return true; } else { return false; } }
+  public Referrable vectorOfHashedReferrables(int j) { return vectorOfHashedReferrables(new Referrable(), j); }
+  public Referrable vectorOfHashedReferrables(Referrable obj, int j) { int o = __offset(100); return o != 0 ? obj.__assign(__indirect(__vector(o) + j * 4), bb) : null; }
+  public int vectorOfHashedReferrablesLength() { int o = __offset(100); return o != 0 ? __vector_len(o) : 0; }
+  public Referrable vectorOfHashedReferrablesByKey(long key) { int o = __offset(100); return o != 0 ? Referrable.__lookup_by_key(null, __vector(o), key, bb) : null; }
+  public Referrable vectorOfHashedReferrablesByKey(Referrable obj, long key) { int o = __offset(100); return o != 0 ? Referrable.__lookup_by_key(obj, __vector(o), key, bb) : null; }
+  public long vectorOfHashedReferrablesHashIndex(int j) { int o = __offset(102); return o != 0 ? (long)bb.getInt(__vector(o) + j * 4) & 0xFFFFFFFFL : 0; }
+  public int vectorOfHashedReferrablesHashIndexLength() { int o = __offset(102); return o != 0 ? __vector_len(o) : 0; }
+  public ByteBuffer vectorOfHashedReferrablesHashIndexAsByteBuffer() { return __vector_as_bytebuffer(102, 4); }
+  public ByteBuffer vectorOfHashedReferrablesHashIndexInByteBuffer(ByteBuffer _bb) { return __vector_in_bytebuffer(_bb, 102, 4); }
+  public boolean mutateVectorOfHashedReferrablesHashIndex(int j, long vector_of_hashed_referrables_hash_index) { int o = __offset(102); if (o != 0) { bb.putInt(__vector(o) + j * 4, (int)vector_of_hashed_referrables_hash_index); return true; } else { return false; } }
 
-  public static void startMonster(FlatBufferBuilder builder) { builder.startObject(48); }
+  public static void startMonster(FlatBufferBuilder builder) { builder.startObject(50); }
   public static void addPos(FlatBufferBuilder builder, int posOffset) { builder.addStruct(0, posOffset, 0); }
   public static void addMana(FlatBufferBuilder builder, short mana) { builder.addShort(1, mana, 150); }
   public static void addHp(FlatBufferBuilder builder, short hp) { builder.addShort(2, hp, 100); }
@@ -239,6 +249,12 @@ public final class Monster extends Table {
   public static void addVectorOfEnums(FlatBufferBuilder builder, int vectorOfEnumsOffset) { builder.addOffset(47, vectorOfEnumsOffset, 0); }
   public static int createVectorOfEnumsVector(FlatBufferBuilder builder, byte[] data) { builder.startVector(1, data.length, 1); for (int i = data.length - 1; i >= 0; i--) builder.addByte(data[i]); return builder.endVector(); }
   public static void startVectorOfEnumsVector(FlatBufferBuilder builder, int numElems) { builder.startVector(1, numElems, 1); }
+  public static void addVectorOfHashedReferrables(FlatBufferBuilder builder, int vectorOfHashedReferrablesOffset) { builder.addOffset(48, vectorOfHashedReferrablesOffset, 0); }
+  public static int createVectorOfHashedReferrablesVector(FlatBufferBuilder builder, int[] data) { builder.startVector(4, data.length, 4); for (int i = data.length - 1; i >= 0; i--) builder.addOffset(data[i]); return builder.endVector(); }
+  public static void startVectorOfHashedReferrablesVector(FlatBufferBuilder builder, int numElems) { builder.startVector(4, numElems, 4); }
+  public static void addVectorOfHashedReferrablesHashIndex(FlatBufferBuilder builder, int vectorOfHashedReferrablesHashIndexOffset) { builder.addOffset(49, vectorOfHashedReferrablesHashIndexOffset, 0); }
+  public static int createVectorOfHashedReferrablesHashIndexVector(FlatBufferBuilder builder, int[] data) { builder.startVector(4, data.length, 4); for (int i = data.length - 1; i >= 0; i--) builder.addInt(data[i]); return builder.endVector(); }
+  public static void startVectorOfHashedReferrablesHashIndexVector(FlatBufferBuilder builder, int numElems) { builder.startVector(4, numElems, 4); }
   public static int endMonster(FlatBufferBuilder builder) {
     int o = builder.endObject();
     builder.required(o, 10);  // name
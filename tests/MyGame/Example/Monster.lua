@@ -522,7 +522,40 @@ function Monster_mt:VectorOfEnumsLength()
     end
     return 0
 end
-function Monster.Start(builder) builder:StartObject(48) end
+function Monster_mt:VectorOfHashedReferrables(j)
+    local o = self.view:Offset(100)
+    if o ~= 0 then
+        local x = self.view:Vector(o)
+        x = x + ((j-1) * 4)
+        x = self.view:Indirect(x)
+        local obj = require('MyGame.Example.Referrable').New()
+        obj:Init(self.view.bytes, x)
+        return obj
+    end
+end
+function Monster_mt:VectorOfHashedReferrablesLength()
+    local o = self.view:Offset(100)
+    if o ~= 0 then
+        return self.view:VectorLen(o)
+    end
+    return 0
+end
+function Monster_mt:VectorOfHashedReferrablesHashIndex(j)
+    local o = self.view:Offset(102)
+    if o ~= 0 then
+        local a = self.view:Vector(o)
+        return self.view:Get(flatbuffers.N.Uint32, a + ((j-1) * 4))
+    end
+    return 0
+end
+function Monster_mt:VectorOfHashedReferrablesHashIndexLength()
+    local o = self.view:Offset(102)
+    if o ~= 0 then
+        return self.view:VectorLen(o)
+    end
+    return 0
+end
+function Monster.Start(builder) builder:StartObject(50) end
 function Monster.AddPos(builder, pos) builder:PrependStructSlot(0, pos, 0) end
 function Monster.AddMana(builder, mana) builder:PrependInt16Slot(1, mana, 150) end
 function Monster.AddHp(builder, hp) builder:PrependInt16Slot(2, hp, 100) end
@@ -588,6 +621,10 @@ function Monster.AddAnyAmbiguousType(builder, anyAmbiguousType) builder:PrependU
 function Monster.AddAnyAmbiguous(builder, anyAmbiguous) builder:PrependUOffsetTRelativeSlot(46, anyAmbiguous, 0) end
 function Monster.AddVectorOfEnums(builder, vectorOfEnums) builder:PrependUOffsetTRelativeSlot(47, vectorOfEnums, 0) end
 function Monster.StartVectorOfEnumsVector(builder, numElems) return builder:StartVector(1, numElems, 1) end
+function Monster.AddVectorOfHashedReferrables(builder, vectorOfHashedReferrables) builder:PrependUOffsetTRelativeSlot(48, vectorOfHashedReferrables, 0) end
+function Monster.StartVectorOfHashedReferrablesVector(builder, numElems) return builder:StartVector(4, numElems, 4) end
+function Monster.AddVectorOfHashedReferrablesHashIndex(builder, vectorOfHashedReferrablesHashIndex) builder:PrependUOffsetTRelativeSlot(49, vectorOfHashedReferrablesHashIndex, 0) end
+function Monster.StartVectorOfHashedReferrablesHashIndexVector(builder, numElems) return builder:StartVector(4, numElems, 4) end
 function Monster.End(builder) return builder:EndObject() end
 
 return Monster -- return the module
\ No newline at end of file
@@ -0,0 +1,563 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_ARENATEST_MYGAME_ARENATEST_H_
+#define FLATBUFFERS_GENERATED_ARENATEST_MYGAME_ARENATEST_H_
+
+#include "flatbuffers/flatbuffers.h"
+#include "flatbuffers/arena.h"
+#include "flatbuffers/hash.h"
+
+namespace MyGame {
+namespace ArenaTest {
+
+struct Item;
+struct ItemT;
+
+struct Inventory;
+struct InventoryT;
+
+bool operator==(const ItemT &lhs, const ItemT &rhs);
+bool operator==(const InventoryT &lhs, const InventoryT &rhs);
+
+inline const flatbuffers::TypeTable *ItemTypeTable();
+
+inline const flatbuffers::TypeTable *InventoryTypeTable();
+
+struct ItemT : public flatbuffers::NativeTable {
+  typedef Item TableType;
+  int32_t id;
+  flatbuffers::ArenaString label;
+  size_t Hash() const;
+  inline void *operator new (std::size_t count) {
+    return flatbuffers::ArenaAllocator<ItemT>().allocate(count / sizeof(ItemT));
+  }
+  inline void operator delete (void *ptr) {
+    return flatbuffers::ArenaAllocator<ItemT>().deallocate(static_cast<ItemT*>(ptr),1);
+  }
+  ItemT()
+      : id(0) {
+  }
+};
+
+inline bool operator==(const ItemT &lhs, const ItemT &rhs) {
+  return
+      (lhs.id == rhs.id) &&
+      (lhs.label == rhs.label);
+}
+
+struct Item FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef ItemT NativeTableType;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return ItemTypeTable();
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ID = 4,
+    VT_LABEL = 6
+  };
+  int32_t id() const {
+    return GetField<int32_t>(VT_ID, 0);
+  }
+  bool mutate_id(int32_t _id) {
+    return SetField<int32_t>(VT_ID, _id, 0);
+  }
+  const flatbuffers::String *label() const {
+    return GetPointer<const flatbuffers::String *>(VT_LABEL);
+  }
+  flatbuffers::String *mutable_label() {
+    return GetPointer<flatbuffers::String *>(VT_LABEL);
+  }
+  flatbuffers::FieldPresence<2> PresenceMask() const {
+    return flatbuffers::FieldPresence<2>(this);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int32_t>(verifier, VT_ID) &&
+           VerifyOffset(verifier, VT_LABEL) &&
+           verifier.VerifyString(label()) &&
+           verifier.EndTable();
+  }
+  size_t Hash() const;
+  bool Equals(const Item &_o) const;
+  ItemT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(ItemT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<Item> Pack(flatbuffers::FlatBufferBuilder &_fbb, const ItemT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  static flatbuffers::Offset<Item> Pack(flatbuffers::FlatBufferBuilder &_fbb, const ItemT &_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct ItemBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_id(int32_t id) {
+    fbb_.AddElement<int32_t>(Item::VT_ID, id, 0);
+  }
+  void add_label(flatbuffers::Offset<flatbuffers::String> label) {
+    fbb_.AddOffset(Item::VT_LABEL, label);
+  }
+  explicit ItemBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ItemBuilder &operator=(const ItemBuilder &);
+  flatbuffers::Offset<Item> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Item>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Item> CreateItem(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    int32_t id = 0,
+    flatbuffers::Offset<flatbuffers::String> label = 0) {
+  ItemBuilder builder_(_fbb);
+  builder_.add_label(label);
+  builder_.add_id(id);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Item> CreateItemDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    int32_t id = 0,
+    const char *label = nullptr) {
+  return MyGame::ArenaTest::CreateItem(
+      _fbb,
+      id,
+      label ? _fbb.CreateString(label) : 0);
+}
+
+class ItemBufferTemplate : public flatbuffers::BufferTemplate {
+ public:
+  ItemBufferTemplate(const uint8_t *buf, size_t size)
+      : flatbuffers::BufferTemplate(buf, size) {
+    auto root = flatbuffers::GetRoot<Item>(data());
+    id_ = FieldPosition(root, Item::VT_ID);
+  }
+  bool mutate_id(uint8_t *buf, int32_t _id) const {
+    if (!id_) return false;
+    flatbuffers::WriteScalar<int32_t>(buf + id_, _id);
+    return true;
+  }
+
+ private:
+  flatbuffers::uoffset_t id_;
+};
+
+flatbuffers::Offset<Item> CreateItem(flatbuffers::FlatBufferBuilder &_fbb, const ItemT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const ItemT &_o);
+
+struct InventoryT : public flatbuffers::NativeTable {
+  typedef Inventory TableType;
+  flatbuffers::ArenaString name;
+  std::vector<flatbuffers::unique_ptr<ItemT>,flatbuffers::ArenaAllocator<flatbuffers::unique_ptr<ItemT>>> items;
+  std::vector<int32_t,flatbuffers::ArenaAllocator<int32_t>> counts;
+  std::vector<flatbuffers::ArenaString,flatbuffers::ArenaAllocator<flatbuffers::ArenaString>> tags;
+  flatbuffers::unique_ptr<ItemT> best;
+  size_t Hash() const;
+  inline void *operator new (std::size_t count) {
+    return flatbuffers::ArenaAllocator<InventoryT>().allocate(count / sizeof(InventoryT));
+  }
+  inline void operator delete (void *ptr) {
+    return flatbuffers::ArenaAllocator<InventoryT>().deallocate(static_cast<InventoryT*>(ptr),1);
+  }
+  InventoryT() {
+  }
+};
+
+inline bool operator==(const InventoryT &lhs, const InventoryT &rhs) {
+  return
+      (lhs.name == rhs.name) &&
+      (lhs.items == rhs.items) &&
+      (lhs.counts == rhs.counts) &&
+      (lhs.tags == rhs.tags) &&
+      (lhs.best == rhs.best);
+}
+
+struct Inventory FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef InventoryT NativeTableType;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return InventoryTypeTable();
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NAME = 4,
+    VT_ITEMS = 6,
+    VT_COUNTS = 8,
+    VT_TAGS = 10,
+    VT_BEST = 12
+  };
+  const flatbuffers::String *name() const {
+    return GetPointer<const flatbuffers::String *>(VT_NAME);
+  }
+  flatbuffers::String *mutable_name() {
+    return GetPointer<flatbuffers::String *>(VT_NAME);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<Item>> *items() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Item>> *>(VT_ITEMS);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<Item>> *mutable_items() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<Item>> *>(VT_ITEMS);
+  }
+  const flatbuffers::Vector<int32_t> *counts() const {
+    return GetPointer<const flatbuffers::Vector<int32_t> *>(VT_COUNTS);
+  }
+  flatbuffers::Vector<int32_t> *mutable_counts() {
+    return GetPointer<flatbuffers::Vector<int32_t> *>(VT_COUNTS);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *tags() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_TAGS);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *mutable_tags() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_TAGS);
+  }
+  const Item *best() const {
+    return GetPointer<const Item *>(VT_BEST);
+  }
+  Item *mutable_best() {
+    return GetPointer<Item *>(VT_BEST);
+  }
+  flatbuffers::FieldPresence<5> PresenceMask() const {
+    return flatbuffers::FieldPresence<5>(this);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           VerifyOffset(verifier, VT_ITEMS) &&
+           verifier.VerifyVector(items()) &&
+           verifier.VerifyVectorOfTables(items()) &&
+           VerifyOffset(verifier, VT_COUNTS) &&
+           verifier.VerifyVector(counts()) &&
+           VerifyOffset(verifier, VT_TAGS) &&
+           verifier.VerifyVector(tags()) &&
+           verifier.VerifyVectorOfStrings(tags()) &&
+           VerifyOffset(verifier, VT_BEST) &&
+           verifier.VerifyTable(best()) &&
+           verifier.EndTable();
+  }
+  size_t Hash() const;
+  bool Equals(const Inventory &_o) const;
+  InventoryT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(InventoryT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<Inventory> Pack(flatbuffers::FlatBufferBuilder &_fbb, const InventoryT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  static flatbuffers::Offset<Inventory> Pack(flatbuffers::FlatBufferBuilder &_fbb, const InventoryT &_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct InventoryBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_name(flatbuffers::Offset<flatbuffers::String> name) {
+    fbb_.AddOffset(Inventory::VT_NAME, name);
+  }
+  void add_items(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Item>>> items) {
+    fbb_.AddOffset(Inventory::VT_ITEMS, items);
+  }
+  void add_counts(flatbuffers::Offset<flatbuffers::Vector<int32_t>> counts) {
+    fbb_.AddOffset(Inventory::VT_COUNTS, counts);
+  }
+  void add_tags(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> tags) {
+    fbb_.AddOffset(Inventory::VT_TAGS, tags);
+  }
+  void add_best(flatbuffers::Offset<Item> best) {
+    fbb_.AddOffset(Inventory::VT_BEST, best);
+  }
+  explicit InventoryBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  InventoryBuilder &operator=(const InventoryBuilder &);
+  flatbuffers::Offset<Inventory> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Inventory>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Inventory> CreateInventory(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> name = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Item>>> items = 0,
+    flatbuffers::Offset<flatbuffers::Vector<int32_t>> counts = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> tags = 0,
+    flatbuffers::Offset<Item> best = 0) {
+  InventoryBuilder builder_(_fbb);
+  builder_.add_best(best);
+  builder_.add_tags(tags);
+  builder_.add_counts(counts);
+  builder_.add_items(items);
+  builder_.add_name(name);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Inventory> CreateInventoryDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    const std::vector<flatbuffers::Offset<Item>> *items = nullptr,
+    const std::vector<int32_t> *counts = nullptr,
+    const std::vector<flatbuffers::Offset<flatbuffers::String>> *tags = nullptr,
+    flatbuffers::Offset<Item> best = 0) {
+  return MyGame::ArenaTest::CreateInventory(
+      _fbb,
+      name ? _fbb.CreateString(name) : 0,
+      items ? _fbb.CreateVector<flatbuffers::Offset<Item>>(*items) : 0,
+      counts ? _fbb.CreateVector<int32_t>(*counts) : 0,
+      tags ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*tags) : 0,
+      best);
+}
+
+class InventoryBufferTemplate : public flatbuffers::BufferTemplate {
+ public:
+  InventoryBufferTemplate(const uint8_t *buf, size_t size)
+      : flatbuffers::BufferTemplate(buf, size) {
+  }
+};
+
+flatbuffers::Offset<Inventory> CreateInventory(flatbuffers::FlatBufferBuilder &_fbb, const InventoryT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const InventoryT &_o);
+
+inline ItemT *Item::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new ItemT();
+  UnPackTo(_o, _resolver);
+  return _o;
+}
+
+inline void Item::UnPackTo(ItemT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = id(); _o->id = _e; };
+  { auto _e = label(); if (_e) { _o->label.assign(_e->c_str(), _e->size()); } else { _o->label.clear(); } };
+}
+
+inline flatbuffers::Offset<Item> Item::Pack(flatbuffers::FlatBufferBuilder &_fbb, const ItemT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateItem(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<Item> Item::Pack(flatbuffers::FlatBufferBuilder &_fbb, const ItemT &_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(_o));
+  return CreateItem(_fbb, &_o, _rehasher);
+}
+
+inline flatbuffers::Offset<Item> CreateItem(flatbuffers::FlatBufferBuilder &_fbb, const ItemT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const ItemT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _id = _o->id;
+  auto _label = _o->label.empty() ? 0 : _fbb.CreateString(_o->label);
+  return MyGame::ArenaTest::CreateItem(
+      _fbb,
+      _id,
+      _label);
+}
+
+inline size_t GetPackedSizeUpperBound(const ItemT &_o) {
+  (void)_o;
+  size_t _size = 57;
+  _size += _o.label.length();
+  return _size;
+}
+
+inline size_t Item::Hash() const {
+  uint64_t _h = 0;
+  { auto _e = GetField<int32_t>(VT_ID, 0); if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_ID), _e); }
+  { auto _e = label(); if (_e && _e->size()) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, VT_LABEL), _e->c_str(), _e->size()); }
+  return static_cast<size_t>(_h);
+}
+
+inline size_t ItemT::Hash() const {
+  uint64_t _h = 0;
+  { auto _e = id; if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, Item::VT_ID), _e); }
+  { auto &_e = label; if (_e.length()) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, Item::VT_LABEL), _e.c_str(), _e.length()); }
+  return static_cast<size_t>(_h);
+}
+
+inline bool Item::Equals(const Item &_o) const {
+  return flatbuffers::ScalarEquals(GetField<int32_t>(VT_ID, 0), _o.GetField<int32_t>(VT_ID, 0)) &&
+         flatbuffers::StringEquals(label(), _o.label());
+}
+
+inline InventoryT *Inventory::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new InventoryT();
+  UnPackTo(_o, _resolver);
+  return _o;
+}
+
+inline void Inventory::UnPackTo(InventoryT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = name(); if (_e) { _o->name.assign(_e->c_str(), _e->size()); } else { _o->name.clear(); } };
+  { auto _e = items(); if (_e) { _o->items.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if (_o->items[_i]) { _e->Get(_i)->UnPackTo(_o->items[_i].get(), _resolver); } else { _o->items[_i] = flatbuffers::unique_ptr<ItemT>(_e->Get(_i)->UnPack(_resolver)); } } } else { _o->items.clear(); } };
+  { auto _e = counts(); if (_e) { flatbuffers::UnPackVector(*_e, &_o->counts); } else { _o->counts.clear(); } };
+  { auto _e = tags(); if (_e) { _o->tags.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->tags[_i].assign(_e->Get(_i)->c_str(), _e->Get(_i)->size()); } } else { _o->tags.clear(); } };
+  { auto _e = best(); if (_e) { if (_o->best) { _e->UnPackTo(_o->best.get(), _resolver); } else { _o->best = flatbuffers::unique_ptr<ItemT>(_e->UnPack(_resolver)); } } else { _o->best.reset(); } };
+}
+
+inline flatbuffers::Offset<Inventory> Inventory::Pack(flatbuffers::FlatBufferBuilder &_fbb, const InventoryT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateInventory(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<Inventory> Inventory::Pack(flatbuffers::FlatBufferBuilder &_fbb, const InventoryT &_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(_o));
+  return CreateInventory(_fbb, &_o, _rehasher);
+}
+
+inline flatbuffers::Offset<Inventory> CreateInventory(flatbuffers::FlatBufferBuilder &_fbb, const InventoryT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const InventoryT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _name = _o->name.empty() ? 0 : _fbb.CreateString(_o->name);
+  auto _items = _o->items.size() ? _fbb.CreateVector<flatbuffers::Offset<Item>> (_o->items.size(), [](size_t i, _VectorArgs *__va) { return CreateItem(*__va->__fbb, __va->__o->items[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _counts = _o->counts.size() ? _fbb.CreateVector(_o->counts) : 0;
+  auto _tags = _o->tags.size() ? _fbb.CreateVectorOfStrings(_o->tags) : 0;
+  auto _best = _o->best ? CreateItem(_fbb, _o->best.get(), _rehasher) : 0;
+  return MyGame::ArenaTest::CreateInventory(
+      _fbb,
+      _name,
+      _items,
+      _counts,
+      _tags,
+      _best);
+}
+
+inline size_t GetPackedSizeUpperBound(const InventoryT &_o) {
+  (void)_o;
+  size_t _size = 138;
+  _size += _o.name.length();
+  _size += _o.items.size() * 4;
+  for (size_t _i = 0; _i < _o.items.size(); _i++) {
+    _size += GetPackedSizeUpperBound(*_o.items[_i]);
+  }
+  _size += _o.counts.size() * 4;
+  _size += _o.tags.size() * 4;
+  for (size_t _i = 0; _i < _o.tags.size(); _i++) {
+    _size += _o.tags[_i].length() + 8;
+  }
+  if (_o.best) _size += GetPackedSizeUpperBound(*_o.best);
+  return _size;
+}
+
+inline size_t Inventory::Hash() const {
+  uint64_t _h = 0;
+  { auto _e = name(); if (_e && _e->size()) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, VT_NAME), _e->c_str(), _e->size()); }
+  { auto _e = items(); if (_e && _e->size()) _h = flatbuffers::HashTables(flatbuffers::HashCombine(_h, VT_ITEMS), *_e); }
+  { auto _e = counts(); if (_e && _e->size()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, VT_COUNTS), *_e); }
+  { auto _e = tags(); if (_e && _e->size()) _h = flatbuffers::HashStrings(flatbuffers::HashCombine(_h, VT_TAGS), *_e); }
+  { auto _e = best(); if (_e) _h = flatbuffers::HashCombine(flatbuffers::HashCombine(_h, VT_BEST), _e->Hash()); }
+  return static_cast<size_t>(_h);
+}
+
+inline size_t InventoryT::Hash() const {
+  uint64_t _h = 0;
+  { auto &_e = name; if (_e.length()) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, Inventory::VT_NAME), _e.c_str(), _e.length()); }
+  { auto &_e = items; if (!_e.empty()) _h = flatbuffers::HashTables(flatbuffers::HashCombine(_h, Inventory::VT_ITEMS), _e); }
+  { auto &_e = counts; if (!_e.empty()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, Inventory::VT_COUNTS), _e); }
+  { auto &_e = tags; if (!_e.empty()) _h = flatbuffers::HashStrings(flatbuffers::HashCombine(_h, Inventory::VT_TAGS), _e); }
+  { auto _e = best.get(); if (_e) _h = flatbuffers::HashCombine(flatbuffers::HashCombine(_h, Inventory::VT_BEST), _e->Hash()); }
+  return static_cast<size_t>(_h);
+}
+
+inline bool Inventory::Equals(const Inventory &_o) const {
+  return flatbuffers::StringEquals(name(), _o.name()) &&
+         flatbuffers::VectorEquals(items(), _o.items()) &&
+         flatbuffers::VectorEquals(counts(), _o.counts()) &&
+         flatbuffers::VectorEquals(tags(), _o.tags()) &&
+         flatbuffers::TableEquals(best(), _o.best());
+}
+
+inline const flatbuffers::TypeTable *ItemTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_INT, 0, -1 },
+    { flatbuffers::ET_STRING, 0, -1 }
+  };
+  static const char * const names[] = {
+    "id",
+    "label"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 2, type_codes, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *InventoryTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_SEQUENCE, 1, 0 },
+    { flatbuffers::ET_INT, 1, -1 },
+    { flatbuffers::ET_STRING, 1, -1 },
+    { flatbuffers::ET_SEQUENCE, 0, 0 }
+  };
+  static const flatbuffers::TypeFunction type_refs[] = {
+    ItemTypeTable
+  };
+  static const char * const names[] = {
+    "name",
+    "items",
+    "counts",
+    "tags",
+    "best"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 5, type_codes, type_refs, nullptr, names
+  };
+  return &tt;
+}
+
+inline const MyGame::ArenaTest::Inventory *GetInventory(const void *buf) {
+  return flatbuffers::GetRoot<MyGame::ArenaTest::Inventory>(buf);
+}
+
+inline const MyGame::ArenaTest::Inventory *GetSizePrefixedInventory(const void *buf) {
+  return flatbuffers::GetSizePrefixedRoot<MyGame::ArenaTest::Inventory>(buf);
+}
+
+inline Inventory *GetMutableInventory(void *buf) {
+  return flatbuffers::GetMutableRoot<Inventory>(buf);
+}
+
+inline bool VerifyInventoryBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<MyGame::ArenaTest::Inventory>(nullptr);
+}
+
+inline bool VerifySizePrefixedInventoryBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<MyGame::ArenaTest::Inventory>(nullptr);
+}
+
+inline void FinishInventoryBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<MyGame::ArenaTest::Inventory> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedInventoryBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<MyGame::ArenaTest::Inventory> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+inline flatbuffers::unique_ptr<InventoryT> UnPackInventory(
+    const void *buf,
+    const flatbuffers::resolver_function_t *res = nullptr) {
+  return flatbuffers::unique_ptr<InventoryT>(GetInventory(buf)->UnPack(res));
+}
+
+}  // namespace ArenaTest
+}  // namespace MyGame
+
+namespace std {
+
+template<> struct hash<MyGame::ArenaTest::ItemT> {
+  size_t operator()(const MyGame::ArenaTest::ItemT &_o) const {
+    return _o.Hash();
+  }
+};
+
+template<> struct hash<MyGame::ArenaTest::InventoryT> {
+  size_t operator()(const MyGame::ArenaTest::InventoryT &_o) const {
+    return _o.Hash();
+  }
+};
+
+}  // namespace std
+
+#endif  // FLATBUFFERS_GENERATED_ARENATEST_MYGAME_ARENATEST_H_
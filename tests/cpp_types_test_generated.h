@@ -0,0 +1,453 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_CPPTYPESTEST_MYGAME_CPPTYPESTEST_H_
+#define FLATBUFFERS_GENERATED_CPPTYPESTEST_MYGAME_CPPTYPESTEST_H_
+
+#include "flatbuffers/flatbuffers.h"
+#include "flatbuffers/hash.h"
+
+namespace MyGame {
+namespace CppTypesTest {
+
+struct Leaf;
+struct LeafT;
+
+struct Node;
+struct NodeT;
+
+bool operator==(const LeafT &lhs, const LeafT &rhs);
+bool operator==(const NodeT &lhs, const NodeT &rhs);
+
+inline const flatbuffers::TypeTable *LeafTypeTable();
+
+inline const flatbuffers::TypeTable *NodeTypeTable();
+
+struct LeafT : public flatbuffers::NativeTable {
+  typedef Leaf TableType;
+  int32_t id;
+  size_t Hash() const;
+  LeafT()
+      : id(0) {
+  }
+};
+
+inline bool operator==(const LeafT &lhs, const LeafT &rhs) {
+  return
+      (lhs.id == rhs.id);
+}
+
+struct Leaf FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef LeafT NativeTableType;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return LeafTypeTable();
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ID = 4
+  };
+  int32_t id() const {
+    return GetField<int32_t>(VT_ID, 0);
+  }
+  bool mutate_id(int32_t _id) {
+    return SetField<int32_t>(VT_ID, _id, 0);
+  }
+  flatbuffers::FieldPresence<1> PresenceMask() const {
+    return flatbuffers::FieldPresence<1>(this);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int32_t>(verifier, VT_ID) &&
+           verifier.EndTable();
+  }
+  size_t Hash() const;
+  bool Equals(const Leaf &_o) const;
+  LeafT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(LeafT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<Leaf> Pack(flatbuffers::FlatBufferBuilder &_fbb, const LeafT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  static flatbuffers::Offset<Leaf> Pack(flatbuffers::FlatBufferBuilder &_fbb, const LeafT &_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct LeafBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_id(int32_t id) {
+    fbb_.AddElement<int32_t>(Leaf::VT_ID, id, 0);
+  }
+  explicit LeafBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  LeafBuilder &operator=(const LeafBuilder &);
+  flatbuffers::Offset<Leaf> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Leaf>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Leaf> CreateLeaf(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    int32_t id = 0) {
+  LeafBuilder builder_(_fbb);
+  builder_.add_id(id);
+  return builder_.Finish();
+}
+
+class LeafBufferTemplate : public flatbuffers::BufferTemplate {
+ public:
+  LeafBufferTemplate(const uint8_t *buf, size_t size)
+      : flatbuffers::BufferTemplate(buf, size) {
+    auto root = flatbuffers::GetRoot<Leaf>(data());
+    id_ = FieldPosition(root, Leaf::VT_ID);
+  }
+  bool mutate_id(uint8_t *buf, int32_t _id) const {
+    if (!id_) return false;
+    flatbuffers::WriteScalar<int32_t>(buf + id_, _id);
+    return true;
+  }
+
+ private:
+  flatbuffers::uoffset_t id_;
+};
+
+flatbuffers::Offset<Leaf> CreateLeaf(flatbuffers::FlatBufferBuilder &_fbb, const LeafT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const LeafT &_o);
+
+struct NodeT : public flatbuffers::NativeTable {
+  typedef Node TableType;
+  std::shared_ptr<LeafT> shared;
+  TestString label;
+  std::string name;
+  size_t Hash() const;
+  NodeT() {
+  }
+};
+
+inline bool operator==(const NodeT &lhs, const NodeT &rhs) {
+  return
+      (lhs.shared == rhs.shared) &&
+      (lhs.label == rhs.label) &&
+      (lhs.name == rhs.name);
+}
+
+struct Node FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef NodeT NativeTableType;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return NodeTypeTable();
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_SHARED = 4,
+    VT_LABEL = 6,
+    VT_NAME = 8
+  };
+  const Leaf *shared() const {
+    return GetPointer<const Leaf *>(VT_SHARED);
+  }
+  Leaf *mutable_shared() {
+    return GetPointer<Leaf *>(VT_SHARED);
+  }
+  const flatbuffers::String *label() const {
+    return GetPointer<const flatbuffers::String *>(VT_LABEL);
+  }
+  flatbuffers::String *mutable_label() {
+    return GetPointer<flatbuffers::String *>(VT_LABEL);
+  }
+  const flatbuffers::String *name() const {
+    return GetPointer<const flatbuffers::String *>(VT_NAME);
+  }
+  flatbuffers::String *mutable_name() {
+    return GetPointer<flatbuffers::String *>(VT_NAME);
+  }
+  flatbuffers::FieldPresence<3> PresenceMask() const {
+    return flatbuffers::FieldPresence<3>(this);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_SHARED) &&
+           verifier.VerifyTable(shared()) &&
+           VerifyOffset(verifier, VT_LABEL) &&
+           verifier.VerifyString(label()) &&
+           VerifyOffset(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           verifier.EndTable();
+  }
+  size_t Hash() const;
+  bool Equals(const Node &_o) const;
+  NodeT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(NodeT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<Node> Pack(flatbuffers::FlatBufferBuilder &_fbb, const NodeT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  static flatbuffers::Offset<Node> Pack(flatbuffers::FlatBufferBuilder &_fbb, const NodeT &_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct NodeBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_shared(flatbuffers::Offset<Leaf> shared) {
+    fbb_.AddOffset(Node::VT_SHARED, shared);
+  }
+  void add_label(flatbuffers::Offset<flatbuffers::String> label) {
+    fbb_.AddOffset(Node::VT_LABEL, label);
+  }
+  void add_name(flatbuffers::Offset<flatbuffers::String> name) {
+    fbb_.AddOffset(Node::VT_NAME, name);
+  }
+  explicit NodeBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  NodeBuilder &operator=(const NodeBuilder &);
+  flatbuffers::Offset<Node> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Node>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Node> CreateNode(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<Leaf> shared = 0,
+    flatbuffers::Offset<flatbuffers::String> label = 0,
+    flatbuffers::Offset<flatbuffers::String> name = 0) {
+  NodeBuilder builder_(_fbb);
+  builder_.add_name(name);
+  builder_.add_label(label);
+  builder_.add_shared(shared);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Node> CreateNodeDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<Leaf> shared = 0,
+    const char *label = nullptr,
+    const char *name = nullptr) {
+  return MyGame::CppTypesTest::CreateNode(
+      _fbb,
+      shared,
+      label ? _fbb.CreateString(label) : 0,
+      name ? _fbb.CreateString(name) : 0);
+}
+
+class NodeBufferTemplate : public flatbuffers::BufferTemplate {
+ public:
+  NodeBufferTemplate(const uint8_t *buf, size_t size)
+      : flatbuffers::BufferTemplate(buf, size) {
+  }
+};
+
+flatbuffers::Offset<Node> CreateNode(flatbuffers::FlatBufferBuilder &_fbb, const NodeT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const NodeT &_o);
+
+inline LeafT *Leaf::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new LeafT();
+  UnPackTo(_o, _resolver);
+  return _o;
+}
+
+inline void Leaf::UnPackTo(LeafT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = id(); _o->id = _e; };
+}
+
+inline flatbuffers::Offset<Leaf> Leaf::Pack(flatbuffers::FlatBufferBuilder &_fbb, const LeafT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateLeaf(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<Leaf> Leaf::Pack(flatbuffers::FlatBufferBuilder &_fbb, const LeafT &_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(_o));
+  return CreateLeaf(_fbb, &_o, _rehasher);
+}
+
+inline flatbuffers::Offset<Leaf> CreateLeaf(flatbuffers::FlatBufferBuilder &_fbb, const LeafT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const LeafT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _id = _o->id;
+  return MyGame::CppTypesTest::CreateLeaf(
+      _fbb,
+      _id);
+}
+
+inline size_t GetPackedSizeUpperBound(const LeafT &_o) {
+  (void)_o;
+  size_t _size = 32;
+  return _size;
+}
+
+inline size_t Leaf::Hash() const {
+  uint64_t _h = 0;
+  { auto _e = GetField<int32_t>(VT_ID, 0); if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_ID), _e); }
+  return static_cast<size_t>(_h);
+}
+
+inline size_t LeafT::Hash() const {
+  uint64_t _h = 0;
+  { auto _e = id; if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, Leaf::VT_ID), _e); }
+  return static_cast<size_t>(_h);
+}
+
+inline bool Leaf::Equals(const Leaf &_o) const {
+  return flatbuffers::ScalarEquals(GetField<int32_t>(VT_ID, 0), _o.GetField<int32_t>(VT_ID, 0));
+}
+
+inline NodeT *Node::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new NodeT();
+  UnPackTo(_o, _resolver);
+  return _o;
+}
+
+inline void Node::UnPackTo(NodeT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = shared(); if (_e) { _o->shared = std::shared_ptr<LeafT>(_e->UnPack(_resolver)); } else { _o->shared = std::shared_ptr<LeafT>(); } };
+  { auto _e = label(); if (_e) { _o->label = _e->str(); } else { _o->label = TestString(); } };
+  { auto _e = name(); if (_e) { _o->name.assign(_e->c_str(), _e->size()); } else { _o->name.clear(); } };
+}
+
+inline flatbuffers::Offset<Node> Node::Pack(flatbuffers::FlatBufferBuilder &_fbb, const NodeT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateNode(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<Node> Node::Pack(flatbuffers::FlatBufferBuilder &_fbb, const NodeT &_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(_o));
+  return CreateNode(_fbb, &_o, _rehasher);
+}
+
+inline flatbuffers::Offset<Node> CreateNode(flatbuffers::FlatBufferBuilder &_fbb, const NodeT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const NodeT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _shared = _o->shared ? CreateLeaf(_fbb, _o->shared.get(), _rehasher) : 0;
+  auto _label = _o->label.empty() ? 0 : _fbb.CreateString(_o->label);
+  auto _name = _o->name.empty() ? 0 : _fbb.CreateString(_o->name);
+  return MyGame::CppTypesTest::CreateNode(
+      _fbb,
+      _shared,
+      _label,
+      _name);
+}
+
+inline size_t GetPackedSizeUpperBound(const NodeT &_o) {
+  (void)_o;
+  size_t _size = 82;
+  if (_o.shared) _size += GetPackedSizeUpperBound(*_o.shared);
+  _size += _o.label.length();
+  _size += _o.name.length();
+  return _size;
+}
+
+inline size_t Node::Hash() const {
+  uint64_t _h = 0;
+  { auto _e = shared(); if (_e) _h = flatbuffers::HashCombine(flatbuffers::HashCombine(_h, VT_SHARED), _e->Hash()); }
+  { auto _e = label(); if (_e && _e->size()) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, VT_LABEL), _e->c_str(), _e->size()); }
+  { auto _e = name(); if (_e && _e->size()) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, VT_NAME), _e->c_str(), _e->size()); }
+  return static_cast<size_t>(_h);
+}
+
+inline size_t NodeT::Hash() const {
+  uint64_t _h = 0;
+  { auto _e = shared.get(); if (_e) _h = flatbuffers::HashCombine(flatbuffers::HashCombine(_h, Node::VT_SHARED), _e->Hash()); }
+  { auto &_e = label; if (_e.length()) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, Node::VT_LABEL), _e.c_str(), _e.length()); }
+  { auto &_e = name; if (_e.length()) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, Node::VT_NAME), _e.c_str(), _e.length()); }
+  return static_cast<size_t>(_h);
+}
+
+inline bool Node::Equals(const Node &_o) const {
+  return flatbuffers::TableEquals(shared(), _o.shared()) &&
+         flatbuffers::StringEquals(label(), _o.label()) &&
+         flatbuffers::StringEquals(name(), _o.name());
+}
+
+inline const flatbuffers::TypeTable *LeafTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_INT, 0, -1 }
+  };
+  static const char * const names[] = {
+    "id"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 1, type_codes, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *NodeTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_SEQUENCE, 0, 0 },
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_STRING, 0, -1 }
+  };
+  static const flatbuffers::TypeFunction type_refs[] = {
+    LeafTypeTable
+  };
+  static const char * const names[] = {
+    "shared",
+    "label",
+    "name"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 3, type_codes, type_refs, nullptr, names
+  };
+  return &tt;
+}
+
+inline const MyGame::CppTypesTest::Node *GetNode(const void *buf) {
+  return flatbuffers::GetRoot<MyGame::CppTypesTest::Node>(buf);
+}
+
+inline const MyGame::CppTypesTest::Node *GetSizePrefixedNode(const void *buf) {
+  return flatbuffers::GetSizePrefixedRoot<MyGame::CppTypesTest::Node>(buf);
+}
+
+inline Node *GetMutableNode(void *buf) {
+  return flatbuffers::GetMutableRoot<Node>(buf);
+}
+
+inline bool VerifyNodeBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<MyGame::CppTypesTest::Node>(nullptr);
+}
+
+inline bool VerifySizePrefixedNodeBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<MyGame::CppTypesTest::Node>(nullptr);
+}
+
+inline void FinishNodeBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<MyGame::CppTypesTest::Node> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedNodeBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<MyGame::CppTypesTest::Node> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+inline flatbuffers::unique_ptr<NodeT> UnPackNode(
+    const void *buf,
+    const flatbuffers::resolver_function_t *res = nullptr) {
+  return flatbuffers::unique_ptr<NodeT>(GetNode(buf)->UnPack(res));
+}
+
+}  // namespace CppTypesTest
+}  // namespace MyGame
+
+namespace std {
+
+template<> struct hash<MyGame::CppTypesTest::LeafT> {
+  size_t operator()(const MyGame::CppTypesTest::LeafT &_o) const {
+    return _o.Hash();
+  }
+};
+
+template<> struct hash<MyGame::CppTypesTest::NodeT> {
+  size_t operator()(const MyGame::CppTypesTest::NodeT &_o) const {
+    return _o.Hash();
+  }
+};
+
+}  // namespace std
+
+#endif  // FLATBUFFERS_GENERATED_CPPTYPESTEST_MYGAME_CPPTYPESTEST_H_
@@ -0,0 +1,116 @@
+/*
+ * Copyright 2018 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "flatbuffers/idl.h"
+#include "flatbuffers/util.h"
+
+// Compares the shortest round-trip float formatting and exact parsing in
+// util.h against the stringstream and strtod based conversions they replace,
+// and measures GenerateText and Parser on a float-heavy buffer:
+//   flatbenchmarkfloat [count]
+
+static uint32_t lcg_seed = 48271;
+static uint32_t lcg_rand() {
+  return lcg_seed =
+             (static_cast<uint64_t>(lcg_seed) * 279470273UL) % 4294967291UL;
+}
+
+template<typename F> double NanosecondsPerValue(size_t count, F f) {
+  auto start = std::chrono::steady_clock::now();
+  f();
+  std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count() / static_cast<double>(count);
+}
+
+int main(int argc, const char *argv[]) {
+  size_t count = argc > 1 ? static_cast<size_t>(atoi(argv[1])) : 1000000;
+
+  // A mix of short decimals, as found in most data, and arbitrary doubles.
+  std::vector<double> values(count);
+  for (size_t i = 0; i < count; i++) {
+    if (i % 2) {
+      values[i] = static_cast<double>(lcg_rand() % 2000000) / 1000.0 - 1000.0;
+    } else {
+      values[i] = static_cast<double>(lcg_rand()) /
+                  static_cast<double>(lcg_rand() | 1) * 1e-3;
+    }
+  }
+
+  size_t checksum = 0;
+  auto old_print = NanosecondsPerValue(count, [&]() {
+    for (size_t i = 0; i < count; i++) {
+      checksum += flatbuffers::FloatToString(values[i], 12).size();
+    }
+  });
+  std::vector<std::string> strings(count);
+  auto new_print = NanosecondsPerValue(count, [&]() {
+    for (size_t i = 0; i < count; i++) {
+      strings[i] = flatbuffers::NumToString(values[i]);
+    }
+  });
+  double sum = 0;
+  auto old_parse = NanosecondsPerValue(count, [&]() {
+    for (size_t i = 0; i < count; i++) {
+      sum += strtod(strings[i].c_str(), nullptr);
+    }
+  });
+  auto new_parse = NanosecondsPerValue(count, [&]() {
+    for (size_t i = 0; i < count; i++) {
+      double d;
+      flatbuffers::StringToNumber(strings[i].c_str(), &d);
+      sum -= d;
+    }
+  });
+
+  // Text round-trip of a vector of doubles.
+  std::string json = "{ values: [";
+  for (size_t i = 0; i < count; i++) {
+    if (i) json += ", ";
+    json += strings[i];
+  }
+  json += "] }";
+  flatbuffers::Parser parser;
+  if (!parser.Parse("table T { values:[double]; } root_type T;")) {
+    printf("%s\n", parser.error_.c_str());
+    return 1;
+  }
+  bool ok = true;
+  auto parse_text = NanosecondsPerValue(
+      count, [&]() { ok = ok && parser.Parse(json.c_str()); });
+  std::string text;
+  auto generate_text = NanosecondsPerValue(count, [&]() {
+    ok = ok && GenerateText(parser, parser.builder_.GetBufferPointer(), &text);
+  });
+  if (!ok) {
+    printf("%s\n", parser.error_.c_str());
+    return 1;
+  }
+
+  printf("values:                      %zu (checksum %zu, %g)\n", count,
+         checksum, sum);
+  printf("FloatToString(12 digits):    %.1f ns\n", old_print);
+  printf("NumToString (shortest):      %.1f ns\n", new_print);
+  printf("strtod:                      %.1f ns\n", old_parse);
+  printf("StringToNumber:              %.1f ns\n", new_parse);
+  printf("Parser, per value:           %.1f ns\n", parse_text);
+  printf("GenerateText, per value:     %.1f ns\n", generate_text);
+  return 0;
+}
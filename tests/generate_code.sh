@@ -15,12 +15,15 @@
 # limitations under the License.
 set -e
 
-../flatc --cpp --java --csharp --dart --go --binary --lobster --lua --python --js --ts --php --rust --grpc --gen-mutable --reflect-names --gen-object-api --gen-compare --no-includes --cpp-ptr-type flatbuffers::unique_ptr  --no-fb-import -I include_test monster_test.fbs monsterdata_test.json
+../flatc --cpp --java --csharp --dart --go --binary --lobster --lua --python --js --ts --php --rust --grpc --gen-mutable --reflect-names --gen-object-api --gen-compare --gen-hash --gen-templates --no-includes --cpp-ptr-type flatbuffers::unique_ptr  --no-fb-import -I include_test monster_test.fbs monsterdata_test.json
 ../flatc --cpp --java --csharp --dart --go --binary --lobster --lua --python --js --ts --php --rust --gen-mutable --reflect-names --no-fb-import --cpp-ptr-type flatbuffers::unique_ptr  -o namespace_test namespace_test/namespace_test1.fbs namespace_test/namespace_test2.fbs
-../flatc --cpp --js --ts --php --gen-mutable --reflect-names --gen-object-api --gen-compare --cpp-ptr-type flatbuffers::unique_ptr -o union_vector ./union_vector/union_vector.fbs
+../flatc --cpp --js --ts --php --gen-mutable --reflect-names --gen-object-api --gen-compare --gen-hash --gen-templates --cpp-ptr-type flatbuffers::unique_ptr -o union_vector ./union_vector/union_vector.fbs
+../flatc --cpp --gen-mutable --reflect-names --gen-object-api --gen-compare --gen-hash --gen-templates --cpp-arena --no-includes --cpp-ptr-type flatbuffers::unique_ptr arena_test.fbs
+../flatc --cpp --gen-mutable --reflect-names --gen-object-api --gen-compare --gen-hash --gen-templates --cpp-views --no-includes --cpp-ptr-type flatbuffers::unique_ptr views_test.fbs
+../flatc --cpp --gen-mutable --reflect-names --gen-object-api --gen-compare --gen-hash --gen-templates --no-includes --cpp-ptr-type flatbuffers::unique_ptr cpp_types_test.fbs
 ../flatc -b --schema --bfbs-comments -I include_test monster_test.fbs
 ../flatc --jsonschema --schema -I include_test monster_test.fbs
 cd ../samples
-../flatc --cpp --lobster --gen-mutable --reflect-names --gen-object-api --gen-compare --cpp-ptr-type flatbuffers::unique_ptr monster.fbs
+../flatc --cpp --lobster --gen-mutable --reflect-names --gen-object-api --gen-compare --gen-hash --gen-templates --cpp-ptr-type flatbuffers::unique_ptr monster.fbs
 cd ../reflection
 ./generate_code.sh
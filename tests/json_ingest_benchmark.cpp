@@ -0,0 +1,94 @@
+/*
+ * Copyright 2018 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdio>
+
+#include "flatbuffers/idl.h"
+#include "flatbuffers/util.h"
+
+// Compares the throughput of Parser and JsonIngester on a large JSON file
+// made of copies of monsterdata_test.golden. Run from the root directory,
+// or pass the path to the tests directory:
+//   flatbenchmarkjson [tests_dir] [copies]
+
+template<typename F> double MegabytesPerSecond(size_t size, int runs, F f) {
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < runs; i++) {
+    if (!f()) return 0;
+  }
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return static_cast<double>(size) * runs / (1024 * 1024) / elapsed.count();
+}
+
+int main(int argc, const char *argv[]) {
+  std::string tests_dir = argc > 1 ? argv[1] : "tests/";
+  int copies = argc > 2 ? atoi(argv[2]) : 2000;
+  const int kRuns = 10;
+
+  std::string schemafile;
+  std::string jsonfile;
+  if (!flatbuffers::LoadFile((tests_dir + "monster_test.fbs").c_str(), false,
+                             &schemafile) ||
+      !flatbuffers::LoadFile((tests_dir + "monsterdata_test.golden").c_str(),
+                             false, &jsonfile)) {
+    printf("couldn't load files from %s\n", tests_dir.c_str());
+    return 1;
+  }
+  flatbuffers::Parser parser;
+  auto include_test_path =
+      flatbuffers::ConCatPathFileName(tests_dir, "include_test");
+  const char *include_directories[] = { tests_dir.c_str(),
+                                        include_test_path.c_str(), nullptr };
+  if (!parser.Parse(schemafile.c_str(), include_directories)) {
+    printf("%s\n", parser.error_.c_str());
+    return 1;
+  }
+
+  // The FlexBuffer field is always handed to the Parser, so leave it out to
+  // measure the JsonIngester itself.
+  auto flex = jsonfile.find("  flex: 1234,\n");
+  if (flex != std::string::npos) jsonfile.erase(flex, 14);
+  std::string json = "{\n  name: \"Root\",\n  testarrayoftables: [\n";
+  for (int i = 0; i < copies; i++) {
+    if (i) json += ",\n";
+    json += jsonfile.substr(0, jsonfile.find_last_of('}') + 1);
+  }
+  json += "\n  ]\n}\n";
+
+  auto parser_speed = MegabytesPerSecond(json.size(), kRuns, [&]() {
+    flatbuffers::Parser json_parser;
+    json_parser.enums_ = parser.enums_;
+    json_parser.root_struct_def_ = parser.root_struct_def_;
+    json_parser.file_identifier_ = parser.file_identifier_;
+    auto ok = json_parser.Parse(json.c_str());
+    json_parser.enums_.dict.clear();
+    json_parser.enums_.vec.clear();
+    return ok;
+  });
+  flatbuffers::JsonIngester ingester(parser);
+  auto ingester_speed = MegabytesPerSecond(
+      json.size(), kRuns, [&]() { return ingester.Parse(json.c_str()); });
+
+  printf("input:         %.1f MB\n",
+         static_cast<double>(json.size()) / (1024 * 1024));
+  printf("Parser:        %.1f MB/s\n", parser_speed);
+  printf("JsonIngester:  %.1f MB/s\n", ingester_speed);
+  if (parser_speed > 0)
+    printf("speedup:       %.1fx\n", ingester_speed / parser_speed);
+  return parser_speed > 0 && ingester_speed > 0 ? 0 : 1;
+}
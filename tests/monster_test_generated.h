@@ -6,6 +6,7 @@
 
 #include "flatbuffers/flatbuffers.h"
 #include "flatbuffers/flexbuffers.h"
+#include "flatbuffers/hash.h"
 
 namespace MyGame {
 
@@ -208,7 +209,10 @@ struct AnyUnion {
 #endif  // FLATBUFFERS_CPP98_STL
 
   static void *UnPack(const void *obj, Any type, const flatbuffers::resolver_function_t *resolver);
+  void UnPackTo(const void *obj, Any _type, const flatbuffers::resolver_function_t *resolver);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
+  size_t GetPackedSizeUpperBound() const;
+  size_t Hash() const;
 
   MonsterT *AsMonster() {
     return type == Any_Monster ?
@@ -262,6 +266,8 @@ inline bool operator==(const AnyUnion &lhs, const AnyUnion &rhs) {
 }
 bool VerifyAny(flatbuffers::Verifier &verifier, const void *obj, Any type);
 bool VerifyAnyVector(flatbuffers::Verifier &verifier, const flatbuffers::Vector<flatbuffers::Offset<void>> *values, const flatbuffers::Vector<uint8_t> *types);
+size_t HashAny(const void *obj, Any type);
+bool EqualsAny(const void *a, const void *b, Any type);
 
 enum AnyUniqueAliases {
   AnyUniqueAliases_NONE = 0,
@@ -344,7 +350,10 @@ struct AnyUniqueAliasesUnion {
 #endif  // FLATBUFFERS_CPP98_STL
 
   static void *UnPack(const void *obj, AnyUniqueAliases type, const flatbuffers::resolver_function_t *resolver);
+  void UnPackTo(const void *obj, AnyUniqueAliases _type, const flatbuffers::resolver_function_t *resolver);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
+  size_t GetPackedSizeUpperBound() const;
+  size_t Hash() const;
 
   MonsterT *AsM() {
     return type == AnyUniqueAliases_M ?
@@ -398,6 +407,8 @@ inline bool operator==(const AnyUniqueAliasesUnion &lhs, const AnyUniqueAliasesU
 }
 bool VerifyAnyUniqueAliases(flatbuffers::Verifier &verifier, const void *obj, AnyUniqueAliases type);
 bool VerifyAnyUniqueAliasesVector(flatbuffers::Verifier &verifier, const flatbuffers::Vector<flatbuffers::Offset<void>> *values, const flatbuffers::Vector<uint8_t> *types);
+size_t HashAnyUniqueAliases(const void *obj, AnyUniqueAliases type);
+bool EqualsAnyUniqueAliases(const void *a, const void *b, AnyUniqueAliases type);
 
 enum AnyAmbiguousAliases {
   AnyAmbiguousAliases_NONE = 0,
@@ -453,7 +464,10 @@ struct AnyAmbiguousAliasesUnion {
   void Reset();
 
   static void *UnPack(const void *obj, AnyAmbiguousAliases type, const flatbuffers::resolver_function_t *resolver);
+  void UnPackTo(const void *obj, AnyAmbiguousAliases _type, const flatbuffers::resolver_function_t *resolver);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
+  size_t GetPackedSizeUpperBound() const;
+  size_t Hash() const;
 
   MonsterT *AsM1() {
     return type == AnyAmbiguousAliases_M1 ?
@@ -507,6 +521,8 @@ inline bool operator==(const AnyAmbiguousAliasesUnion &lhs, const AnyAmbiguousAl
 }
 bool VerifyAnyAmbiguousAliases(flatbuffers::Verifier &verifier, const void *obj, AnyAmbiguousAliases type);
 bool VerifyAnyAmbiguousAliasesVector(flatbuffers::Verifier &verifier, const flatbuffers::Vector<flatbuffers::Offset<void>> *values, const flatbuffers::Vector<uint8_t> *types);
+size_t HashAnyAmbiguousAliases(const void *obj, AnyAmbiguousAliases type);
+bool EqualsAnyAmbiguousAliases(const void *a, const void *b, AnyAmbiguousAliases type);
 
 FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(2) Test FLATBUFFERS_FINAL_CLASS {
  private:
@@ -649,6 +665,9 @@ FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) Ability FLATBUFFERS_FINAL_CLASS {
   int KeyCompareWithValue(uint32_t val) const {
     return static_cast<int>(id() > val) - static_cast<int>(id() < val);
   }
+  uint32_t GetKey() const {
+    return id();
+  }
   uint32_t distance() const {
     return flatbuffers::EndianScalar(distance_);
   }
@@ -668,6 +687,7 @@ inline bool operator==(const Ability &lhs, const Ability &rhs) {
 
 struct InParentNamespaceT : public flatbuffers::NativeTable {
   typedef InParentNamespace TableType;
+  size_t Hash() const;
   InParentNamespaceT() {
   }
 };
@@ -681,13 +701,19 @@ struct InParentNamespace FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   static const flatbuffers::TypeTable *MiniReflectTypeTable() {
     return InParentNamespaceTypeTable();
   }
+  flatbuffers::FieldPresence<0> PresenceMask() const {
+    return flatbuffers::FieldPresence<0>(this);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            verifier.EndTable();
   }
+  size_t Hash() const;
+  bool Equals(const InParentNamespace &_o) const;
   InParentNamespaceT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(InParentNamespaceT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static flatbuffers::Offset<InParentNamespace> Pack(flatbuffers::FlatBufferBuilder &_fbb, const InParentNamespaceT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  static flatbuffers::Offset<InParentNamespace> Pack(flatbuffers::FlatBufferBuilder &_fbb, const InParentNamespaceT &_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
 struct InParentNamespaceBuilder {
@@ -711,12 +737,21 @@ inline flatbuffers::Offset<InParentNamespace> CreateInParentNamespace(
   return builder_.Finish();
 }
 
+class InParentNamespaceBufferTemplate : public flatbuffers::BufferTemplate {
+ public:
+  InParentNamespaceBufferTemplate(const uint8_t *buf, size_t size)
+      : flatbuffers::BufferTemplate(buf, size) {
+  }
+};
+
 flatbuffers::Offset<InParentNamespace> CreateInParentNamespace(flatbuffers::FlatBufferBuilder &_fbb, const InParentNamespaceT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const InParentNamespaceT &_o);
 
 namespace Example2 {
 
 struct MonsterT : public flatbuffers::NativeTable {
   typedef Monster TableType;
+  size_t Hash() const;
   MonsterT() {
   }
 };
@@ -730,13 +765,19 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   static const flatbuffers::TypeTable *MiniReflectTypeTable() {
     return MonsterTypeTable();
   }
+  flatbuffers::FieldPresence<0> PresenceMask() const {
+    return flatbuffers::FieldPresence<0>(this);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            verifier.EndTable();
   }
+  size_t Hash() const;
+  bool Equals(const Monster &_o) const;
   MonsterT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(MonsterT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static flatbuffers::Offset<Monster> Pack(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  static flatbuffers::Offset<Monster> Pack(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT &_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
 struct MonsterBuilder {
@@ -760,7 +801,15 @@ inline flatbuffers::Offset<Monster> CreateMonster(
   return builder_.Finish();
 }
 
+class MonsterBufferTemplate : public flatbuffers::BufferTemplate {
+ public:
+  MonsterBufferTemplate(const uint8_t *buf, size_t size)
+      : flatbuffers::BufferTemplate(buf, size) {
+  }
+};
+
 flatbuffers::Offset<Monster> CreateMonster(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const MonsterT &_o);
 
 }  // namespace Example2
 
@@ -769,6 +818,7 @@ namespace Example {
 struct TestSimpleTableWithEnumT : public flatbuffers::NativeTable {
   typedef TestSimpleTableWithEnum TableType;
   Color color;
+  size_t Hash() const;
   TestSimpleTableWithEnumT()
       : color(Color_Green) {
   }
@@ -793,14 +843,20 @@ struct TestSimpleTableWithEnum FLATBUFFERS_FINAL_CLASS : private flatbuffers::Ta
   bool mutate_color(Color _color) {
     return SetField<int8_t>(VT_COLOR, static_cast<int8_t>(_color), 2);
   }
+  flatbuffers::FieldPresence<1> PresenceMask() const {
+    return flatbuffers::FieldPresence<1>(this);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<int8_t>(verifier, VT_COLOR) &&
            verifier.EndTable();
   }
+  size_t Hash() const;
+  bool Equals(const TestSimpleTableWithEnum &_o) const;
   TestSimpleTableWithEnumT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(TestSimpleTableWithEnumT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static flatbuffers::Offset<TestSimpleTableWithEnum> Pack(flatbuffers::FlatBufferBuilder &_fbb, const TestSimpleTableWithEnumT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  static flatbuffers::Offset<TestSimpleTableWithEnum> Pack(flatbuffers::FlatBufferBuilder &_fbb, const TestSimpleTableWithEnumT &_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
 struct TestSimpleTableWithEnumBuilder {
@@ -829,13 +885,32 @@ inline flatbuffers::Offset<TestSimpleTableWithEnum> CreateTestSimpleTableWithEnu
   return builder_.Finish();
 }
 
+class TestSimpleTableWithEnumBufferTemplate : public flatbuffers::BufferTemplate {
+ public:
+  TestSimpleTableWithEnumBufferTemplate(const uint8_t *buf, size_t size)
+      : flatbuffers::BufferTemplate(buf, size) {
+    auto root = flatbuffers::GetRoot<TestSimpleTableWithEnum>(data());
+    color_ = FieldPosition(root, TestSimpleTableWithEnum::VT_COLOR);
+  }
+  bool mutate_color(uint8_t *buf, Color _color) const {
+    if (!color_) return false;
+    flatbuffers::WriteScalar<int8_t>(buf + color_, static_cast<int8_t>(_color));
+    return true;
+  }
+
+ private:
+  flatbuffers::uoffset_t color_;
+};
+
 flatbuffers::Offset<TestSimpleTableWithEnum> CreateTestSimpleTableWithEnum(flatbuffers::FlatBufferBuilder &_fbb, const TestSimpleTableWithEnumT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const TestSimpleTableWithEnumT &_o);
 
 struct StatT : public flatbuffers::NativeTable {
   typedef Stat TableType;
   std::string id;
   int64_t val;
   uint16_t count;
+  size_t Hash() const;
   StatT()
       : val(0),
         count(0) {
@@ -877,6 +952,9 @@ struct Stat FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   bool mutate_count(uint16_t _count) {
     return SetField<uint16_t>(VT_COUNT, _count, 0);
   }
+  flatbuffers::FieldPresence<3> PresenceMask() const {
+    return flatbuffers::FieldPresence<3>(this);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_ID) &&
@@ -885,9 +963,12 @@ struct Stat FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyField<uint16_t>(verifier, VT_COUNT) &&
            verifier.EndTable();
   }
+  size_t Hash() const;
+  bool Equals(const Stat &_o) const;
   StatT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(StatT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static flatbuffers::Offset<Stat> Pack(flatbuffers::FlatBufferBuilder &_fbb, const StatT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  static flatbuffers::Offset<Stat> Pack(flatbuffers::FlatBufferBuilder &_fbb, const StatT &_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
 struct StatBuilder {
@@ -938,11 +1019,37 @@ inline flatbuffers::Offset<Stat> CreateStatDirect(
       count);
 }
 
+class StatBufferTemplate : public flatbuffers::BufferTemplate {
+ public:
+  StatBufferTemplate(const uint8_t *buf, size_t size)
+      : flatbuffers::BufferTemplate(buf, size) {
+    auto root = flatbuffers::GetRoot<Stat>(data());
+    val_ = FieldPosition(root, Stat::VT_VAL);
+    count_ = FieldPosition(root, Stat::VT_COUNT);
+  }
+  bool mutate_val(uint8_t *buf, int64_t _val) const {
+    if (!val_) return false;
+    flatbuffers::WriteScalar<int64_t>(buf + val_, _val);
+    return true;
+  }
+  bool mutate_count(uint8_t *buf, uint16_t _count) const {
+    if (!count_) return false;
+    flatbuffers::WriteScalar<uint16_t>(buf + count_, _count);
+    return true;
+  }
+
+ private:
+  flatbuffers::uoffset_t val_;
+  flatbuffers::uoffset_t count_;
+};
+
 flatbuffers::Offset<Stat> CreateStat(flatbuffers::FlatBufferBuilder &_fbb, const StatT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const StatT &_o);
 
 struct ReferrableT : public flatbuffers::NativeTable {
   typedef Referrable TableType;
   uint64_t id;
+  size_t Hash() const;
   ReferrableT()
       : id(0) {
   }
@@ -973,14 +1080,23 @@ struct Referrable FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int KeyCompareWithValue(uint64_t val) const {
     return static_cast<int>(id() > val) - static_cast<int>(id() < val);
   }
+  uint64_t GetKey() const {
+    return id();
+  }
+  flatbuffers::FieldPresence<1> PresenceMask() const {
+    return flatbuffers::FieldPresence<1>(this);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<uint64_t>(verifier, VT_ID) &&
            verifier.EndTable();
   }
+  size_t Hash() const;
+  bool Equals(const Referrable &_o) const;
   ReferrableT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(ReferrableT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static flatbuffers::Offset<Referrable> Pack(flatbuffers::FlatBufferBuilder &_fbb, const ReferrableT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  static flatbuffers::Offset<Referrable> Pack(flatbuffers::FlatBufferBuilder &_fbb, const ReferrableT &_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
 struct ReferrableBuilder {
@@ -1009,7 +1125,25 @@ inline flatbuffers::Offset<Referrable> CreateReferrable(
   return builder_.Finish();
 }
 
+class ReferrableBufferTemplate : public flatbuffers::BufferTemplate {
+ public:
+  ReferrableBufferTemplate(const uint8_t *buf, size_t size)
+      : flatbuffers::BufferTemplate(buf, size) {
+    auto root = flatbuffers::GetRoot<Referrable>(data());
+    id_ = FieldPosition(root, Referrable::VT_ID);
+  }
+  bool mutate_id(uint8_t *buf, uint64_t _id) const {
+    if (!id_) return false;
+    flatbuffers::WriteScalar<uint64_t>(buf + id_, _id);
+    return true;
+  }
+
+ private:
+  flatbuffers::uoffset_t id_;
+};
+
 flatbuffers::Offset<Referrable> CreateReferrable(flatbuffers::FlatBufferBuilder &_fbb, const ReferrableT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const ReferrableT &_o);
 
 struct MonsterT : public flatbuffers::NativeTable {
   typedef Monster TableType;
@@ -1057,6 +1191,9 @@ struct MonsterT : public flatbuffers::NativeTable {
   AnyUniqueAliasesUnion any_unique;
   AnyAmbiguousAliasesUnion any_ambiguous;
   std::vector<Color> vector_of_enums;
+  std::vector<flatbuffers::unique_ptr<ReferrableT>> vector_of_hashed_referrables;
+  std::vector<uint32_t> vector_of_hashed_referrables_hash_index;
+  size_t Hash() const;
   MonsterT()
       : mana(150),
         hp(100),
@@ -1124,7 +1261,9 @@ inline bool operator==(const MonsterT &lhs, const MonsterT &rhs) {
       (lhs.vector_of_non_owning_references == rhs.vector_of_non_owning_references) &&
       (lhs.any_unique == rhs.any_unique) &&
       (lhs.any_ambiguous == rhs.any_ambiguous) &&
-      (lhs.vector_of_enums == rhs.vector_of_enums);
+      (lhs.vector_of_enums == rhs.vector_of_enums) &&
+      (lhs.vector_of_hashed_referrables == rhs.vector_of_hashed_referrables) &&
+      (lhs.vector_of_hashed_referrables_hash_index == rhs.vector_of_hashed_referrables_hash_index);
 }
 
 /// an example documentation comment: monster object
@@ -1180,7 +1319,9 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     VT_ANY_UNIQUE = 92,
     VT_ANY_AMBIGUOUS_TYPE = 94,
     VT_ANY_AMBIGUOUS = 96,
-    VT_VECTOR_OF_ENUMS = 98
+    VT_VECTOR_OF_ENUMS = 98,
+    VT_VECTOR_OF_HASHED_REFERRABLES = 100,
+    VT_VECTOR_OF_HASHED_REFERRABLES_HASH_INDEX = 102
   };
   const Vec3 *pos() const {
     return GetStruct<const Vec3 *>(VT_POS);
@@ -1212,6 +1353,9 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   int KeyCompareWithValue(const char *val) const {
     return strcmp(name()->c_str(), val);
   }
+  const flatbuffers::String *GetKey() const {
+    return name();
+  }
   const flatbuffers::Vector<uint8_t> *inventory() const {
     return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_INVENTORY);
   }
@@ -1507,6 +1651,24 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   flatbuffers::Vector<int8_t> *mutable_vector_of_enums() {
     return GetPointer<flatbuffers::Vector<int8_t> *>(VT_VECTOR_OF_ENUMS);
   }
+  const flatbuffers::Vector<flatbuffers::Offset<Referrable>> *vector_of_hashed_referrables() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Referrable>> *>(VT_VECTOR_OF_HASHED_REFERRABLES);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<Referrable>> *mutable_vector_of_hashed_referrables() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<Referrable>> *>(VT_VECTOR_OF_HASHED_REFERRABLES);
+  }
+  const Referrable *vector_of_hashed_referrables_by_key(uint64_t key) const {
+    return vector_of_hashed_referrables() ? vector_of_hashed_referrables()->LookupByKeyHashed(key, vector_of_hashed_referrables_hash_index()) : nullptr;
+  }
+  const flatbuffers::Vector<uint32_t> *vector_of_hashed_referrables_hash_index() const {
+    return GetPointer<const flatbuffers::Vector<uint32_t> *>(VT_VECTOR_OF_HASHED_REFERRABLES_HASH_INDEX);
+  }
+  flatbuffers::Vector<uint32_t> *mutable_vector_of_hashed_referrables_hash_index() {
+    return GetPointer<flatbuffers::Vector<uint32_t> *>(VT_VECTOR_OF_HASHED_REFERRABLES_HASH_INDEX);
+  }
+  flatbuffers::FieldPresence<50> PresenceMask() const {
+    return flatbuffers::FieldPresence<50>(this);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<Vec3>(verifier, VT_POS) &&
@@ -1586,11 +1748,20 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyAnyAmbiguousAliases(verifier, any_ambiguous(), any_ambiguous_type()) &&
            VerifyOffset(verifier, VT_VECTOR_OF_ENUMS) &&
            verifier.VerifyVector(vector_of_enums()) &&
+           VerifyOffset(verifier, VT_VECTOR_OF_HASHED_REFERRABLES) &&
+           verifier.VerifyVector(vector_of_hashed_referrables()) &&
+           verifier.VerifyVectorOfTables(vector_of_hashed_referrables()) &&
+           VerifyOffset(verifier, VT_VECTOR_OF_HASHED_REFERRABLES_HASH_INDEX) &&
+           verifier.VerifyVector(vector_of_hashed_referrables_hash_index()) &&
+           verifier.VerifyHashIndex(vector_of_hashed_referrables(), vector_of_hashed_referrables_hash_index()) &&
            verifier.EndTable();
   }
+  size_t Hash() const;
+  bool Equals(const Monster &_o) const;
   MonsterT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(MonsterT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static flatbuffers::Offset<Monster> Pack(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  static flatbuffers::Offset<Monster> Pack(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT &_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
 template<> inline const Monster *Monster::test_as<Monster>() const {
@@ -1761,6 +1932,12 @@ struct MonsterBuilder {
   void add_vector_of_enums(flatbuffers::Offset<flatbuffers::Vector<int8_t>> vector_of_enums) {
     fbb_.AddOffset(Monster::VT_VECTOR_OF_ENUMS, vector_of_enums);
   }
+  void add_vector_of_hashed_referrables(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Referrable>>> vector_of_hashed_referrables) {
+    fbb_.AddOffset(Monster::VT_VECTOR_OF_HASHED_REFERRABLES, vector_of_hashed_referrables);
+  }
+  void add_vector_of_hashed_referrables_hash_index(flatbuffers::Offset<flatbuffers::Vector<uint32_t>> vector_of_hashed_referrables_hash_index) {
+    fbb_.AddOffset(Monster::VT_VECTOR_OF_HASHED_REFERRABLES_HASH_INDEX, vector_of_hashed_referrables_hash_index);
+  }
   explicit MonsterBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -1822,7 +1999,9 @@ inline flatbuffers::Offset<Monster> CreateMonster(
     flatbuffers::Offset<void> any_unique = 0,
     AnyAmbiguousAliases any_ambiguous_type = AnyAmbiguousAliases_NONE,
     flatbuffers::Offset<void> any_ambiguous = 0,
-    flatbuffers::Offset<flatbuffers::Vector<int8_t>> vector_of_enums = 0) {
+    flatbuffers::Offset<flatbuffers::Vector<int8_t>> vector_of_enums = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Referrable>>> vector_of_hashed_referrables = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint32_t>> vector_of_hashed_referrables_hash_index = 0) {
   MonsterBuilder builder_(_fbb);
   builder_.add_non_owning_reference(non_owning_reference);
   builder_.add_co_owning_reference(co_owning_reference);
@@ -1831,6 +2010,8 @@ inline flatbuffers::Offset<Monster> CreateMonster(
   builder_.add_testhashs64_fnv1a(testhashs64_fnv1a);
   builder_.add_testhashu64_fnv1(testhashu64_fnv1);
   builder_.add_testhashs64_fnv1(testhashs64_fnv1);
+  builder_.add_vector_of_hashed_referrables_hash_index(vector_of_hashed_referrables_hash_index);
+  builder_.add_vector_of_hashed_referrables(vector_of_hashed_referrables);
   builder_.add_vector_of_enums(vector_of_enums);
   builder_.add_any_ambiguous(any_ambiguous);
   builder_.add_any_unique(any_unique);
@@ -1922,7 +2103,9 @@ inline flatbuffers::Offset<Monster> CreateMonsterDirect(
     flatbuffers::Offset<void> any_unique = 0,
     AnyAmbiguousAliases any_ambiguous_type = AnyAmbiguousAliases_NONE,
     flatbuffers::Offset<void> any_ambiguous = 0,
-    const std::vector<int8_t> *vector_of_enums = nullptr) {
+    const std::vector<int8_t> *vector_of_enums = nullptr,
+    const std::vector<flatbuffers::Offset<Referrable>> *vector_of_hashed_referrables = nullptr,
+    const std::vector<uint32_t> *vector_of_hashed_referrables_hash_index = nullptr) {
   return MyGame::Example::CreateMonster(
       _fbb,
       pos,
@@ -1971,10 +2154,156 @@ inline flatbuffers::Offset<Monster> CreateMonsterDirect(
       any_unique,
       any_ambiguous_type,
       any_ambiguous,
-      vector_of_enums ? _fbb.CreateVector<int8_t>(*vector_of_enums) : 0);
+      vector_of_enums ? _fbb.CreateVector<int8_t>(*vector_of_enums) : 0,
+      vector_of_hashed_referrables ? _fbb.CreateVector<flatbuffers::Offset<Referrable>>(*vector_of_hashed_referrables) : 0,
+      vector_of_hashed_referrables_hash_index ? _fbb.CreateVector<uint32_t>(*vector_of_hashed_referrables_hash_index) : 0);
 }
 
+class MonsterBufferTemplate : public flatbuffers::BufferTemplate {
+ public:
+  MonsterBufferTemplate(const uint8_t *buf, size_t size)
+      : flatbuffers::BufferTemplate(buf, size) {
+    auto root = flatbuffers::GetRoot<Monster>(data());
+    pos_ = FieldPosition(root, Monster::VT_POS);
+    mana_ = FieldPosition(root, Monster::VT_MANA);
+    hp_ = FieldPosition(root, Monster::VT_HP);
+    color_ = FieldPosition(root, Monster::VT_COLOR);
+    testbool_ = FieldPosition(root, Monster::VT_TESTBOOL);
+    testhashs32_fnv1_ = FieldPosition(root, Monster::VT_TESTHASHS32_FNV1);
+    testhashu32_fnv1_ = FieldPosition(root, Monster::VT_TESTHASHU32_FNV1);
+    testhashs64_fnv1_ = FieldPosition(root, Monster::VT_TESTHASHS64_FNV1);
+    testhashu64_fnv1_ = FieldPosition(root, Monster::VT_TESTHASHU64_FNV1);
+    testhashs32_fnv1a_ = FieldPosition(root, Monster::VT_TESTHASHS32_FNV1A);
+    testhashu32_fnv1a_ = FieldPosition(root, Monster::VT_TESTHASHU32_FNV1A);
+    testhashs64_fnv1a_ = FieldPosition(root, Monster::VT_TESTHASHS64_FNV1A);
+    testhashu64_fnv1a_ = FieldPosition(root, Monster::VT_TESTHASHU64_FNV1A);
+    testf_ = FieldPosition(root, Monster::VT_TESTF);
+    testf2_ = FieldPosition(root, Monster::VT_TESTF2);
+    testf3_ = FieldPosition(root, Monster::VT_TESTF3);
+    single_weak_reference_ = FieldPosition(root, Monster::VT_SINGLE_WEAK_REFERENCE);
+    co_owning_reference_ = FieldPosition(root, Monster::VT_CO_OWNING_REFERENCE);
+    non_owning_reference_ = FieldPosition(root, Monster::VT_NON_OWNING_REFERENCE);
+  }
+  bool mutate_pos(uint8_t *buf, const Vec3 &_pos) const {
+    if (!pos_) return false;
+    memcpy(buf + pos_, &_pos, sizeof(_pos));
+    return true;
+  }
+  bool mutate_mana(uint8_t *buf, int16_t _mana) const {
+    if (!mana_) return false;
+    flatbuffers::WriteScalar<int16_t>(buf + mana_, _mana);
+    return true;
+  }
+  bool mutate_hp(uint8_t *buf, int16_t _hp) const {
+    if (!hp_) return false;
+    flatbuffers::WriteScalar<int16_t>(buf + hp_, _hp);
+    return true;
+  }
+  bool mutate_color(uint8_t *buf, Color _color) const {
+    if (!color_) return false;
+    flatbuffers::WriteScalar<int8_t>(buf + color_, static_cast<int8_t>(_color));
+    return true;
+  }
+  bool mutate_testbool(uint8_t *buf, bool _testbool) const {
+    if (!testbool_) return false;
+    flatbuffers::WriteScalar<uint8_t>(buf + testbool_, static_cast<uint8_t>(_testbool));
+    return true;
+  }
+  bool mutate_testhashs32_fnv1(uint8_t *buf, int32_t _testhashs32_fnv1) const {
+    if (!testhashs32_fnv1_) return false;
+    flatbuffers::WriteScalar<int32_t>(buf + testhashs32_fnv1_, _testhashs32_fnv1);
+    return true;
+  }
+  bool mutate_testhashu32_fnv1(uint8_t *buf, uint32_t _testhashu32_fnv1) const {
+    if (!testhashu32_fnv1_) return false;
+    flatbuffers::WriteScalar<uint32_t>(buf + testhashu32_fnv1_, _testhashu32_fnv1);
+    return true;
+  }
+  bool mutate_testhashs64_fnv1(uint8_t *buf, int64_t _testhashs64_fnv1) const {
+    if (!testhashs64_fnv1_) return false;
+    flatbuffers::WriteScalar<int64_t>(buf + testhashs64_fnv1_, _testhashs64_fnv1);
+    return true;
+  }
+  bool mutate_testhashu64_fnv1(uint8_t *buf, uint64_t _testhashu64_fnv1) const {
+    if (!testhashu64_fnv1_) return false;
+    flatbuffers::WriteScalar<uint64_t>(buf + testhashu64_fnv1_, _testhashu64_fnv1);
+    return true;
+  }
+  bool mutate_testhashs32_fnv1a(uint8_t *buf, int32_t _testhashs32_fnv1a) const {
+    if (!testhashs32_fnv1a_) return false;
+    flatbuffers::WriteScalar<int32_t>(buf + testhashs32_fnv1a_, _testhashs32_fnv1a);
+    return true;
+  }
+  bool mutate_testhashu32_fnv1a(uint8_t *buf, uint32_t _testhashu32_fnv1a) const {
+    if (!testhashu32_fnv1a_) return false;
+    flatbuffers::WriteScalar<uint32_t>(buf + testhashu32_fnv1a_, _testhashu32_fnv1a);
+    return true;
+  }
+  bool mutate_testhashs64_fnv1a(uint8_t *buf, int64_t _testhashs64_fnv1a) const {
+    if (!testhashs64_fnv1a_) return false;
+    flatbuffers::WriteScalar<int64_t>(buf + testhashs64_fnv1a_, _testhashs64_fnv1a);
+    return true;
+  }
+  bool mutate_testhashu64_fnv1a(uint8_t *buf, uint64_t _testhashu64_fnv1a) const {
+    if (!testhashu64_fnv1a_) return false;
+    flatbuffers::WriteScalar<uint64_t>(buf + testhashu64_fnv1a_, _testhashu64_fnv1a);
+    return true;
+  }
+  bool mutate_testf(uint8_t *buf, float _testf) const {
+    if (!testf_) return false;
+    flatbuffers::WriteScalar<float>(buf + testf_, _testf);
+    return true;
+  }
+  bool mutate_testf2(uint8_t *buf, float _testf2) const {
+    if (!testf2_) return false;
+    flatbuffers::WriteScalar<float>(buf + testf2_, _testf2);
+    return true;
+  }
+  bool mutate_testf3(uint8_t *buf, float _testf3) const {
+    if (!testf3_) return false;
+    flatbuffers::WriteScalar<float>(buf + testf3_, _testf3);
+    return true;
+  }
+  bool mutate_single_weak_reference(uint8_t *buf, uint64_t _single_weak_reference) const {
+    if (!single_weak_reference_) return false;
+    flatbuffers::WriteScalar<uint64_t>(buf + single_weak_reference_, _single_weak_reference);
+    return true;
+  }
+  bool mutate_co_owning_reference(uint8_t *buf, uint64_t _co_owning_reference) const {
+    if (!co_owning_reference_) return false;
+    flatbuffers::WriteScalar<uint64_t>(buf + co_owning_reference_, _co_owning_reference);
+    return true;
+  }
+  bool mutate_non_owning_reference(uint8_t *buf, uint64_t _non_owning_reference) const {
+    if (!non_owning_reference_) return false;
+    flatbuffers::WriteScalar<uint64_t>(buf + non_owning_reference_, _non_owning_reference);
+    return true;
+  }
+
+ private:
+  flatbuffers::uoffset_t pos_;
+  flatbuffers::uoffset_t mana_;
+  flatbuffers::uoffset_t hp_;
+  flatbuffers::uoffset_t color_;
+  flatbuffers::uoffset_t testbool_;
+  flatbuffers::uoffset_t testhashs32_fnv1_;
+  flatbuffers::uoffset_t testhashu32_fnv1_;
+  flatbuffers::uoffset_t testhashs64_fnv1_;
+  flatbuffers::uoffset_t testhashu64_fnv1_;
+  flatbuffers::uoffset_t testhashs32_fnv1a_;
+  flatbuffers::uoffset_t testhashu32_fnv1a_;
+  flatbuffers::uoffset_t testhashs64_fnv1a_;
+  flatbuffers::uoffset_t testhashu64_fnv1a_;
+  flatbuffers::uoffset_t testf_;
+  flatbuffers::uoffset_t testf2_;
+  flatbuffers::uoffset_t testf3_;
+  flatbuffers::uoffset_t single_weak_reference_;
+  flatbuffers::uoffset_t co_owning_reference_;
+  flatbuffers::uoffset_t non_owning_reference_;
+};
+
 flatbuffers::Offset<Monster> CreateMonster(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const MonsterT &_o);
 
 struct TypeAliasesT : public flatbuffers::NativeTable {
   typedef TypeAliases TableType;
@@ -1990,6 +2319,7 @@ struct TypeAliasesT : public flatbuffers::NativeTable {
   double f64;
   std::vector<int8_t> v8;
   std::vector<double> vf64;
+  size_t Hash() const;
   TypeAliasesT()
       : i8(0),
         u8(0),
@@ -2111,6 +2441,9 @@ struct TypeAliases FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   flatbuffers::Vector<double> *mutable_vf64() {
     return GetPointer<flatbuffers::Vector<double> *>(VT_VF64);
   }
+  flatbuffers::FieldPresence<12> PresenceMask() const {
+    return flatbuffers::FieldPresence<12>(this);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<int8_t>(verifier, VT_I8) &&
@@ -2129,9 +2462,12 @@ struct TypeAliases FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            verifier.VerifyVector(vf64()) &&
            verifier.EndTable();
   }
+  size_t Hash() const;
+  bool Equals(const TypeAliases &_o) const;
   TypeAliasesT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(TypeAliasesT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static flatbuffers::Offset<TypeAliases> Pack(flatbuffers::FlatBufferBuilder &_fbb, const TypeAliasesT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  static flatbuffers::Offset<TypeAliases> Pack(flatbuffers::FlatBufferBuilder &_fbb, const TypeAliasesT &_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
 struct TypeAliasesBuilder {
@@ -2245,7 +2581,88 @@ inline flatbuffers::Offset<TypeAliases> CreateTypeAliasesDirect(
       vf64 ? _fbb.CreateVector<double>(*vf64) : 0);
 }
 
+class TypeAliasesBufferTemplate : public flatbuffers::BufferTemplate {
+ public:
+  TypeAliasesBufferTemplate(const uint8_t *buf, size_t size)
+      : flatbuffers::BufferTemplate(buf, size) {
+    auto root = flatbuffers::GetRoot<TypeAliases>(data());
+    i8_ = FieldPosition(root, TypeAliases::VT_I8);
+    u8_ = FieldPosition(root, TypeAliases::VT_U8);
+    i16_ = FieldPosition(root, TypeAliases::VT_I16);
+    u16_ = FieldPosition(root, TypeAliases::VT_U16);
+    i32_ = FieldPosition(root, TypeAliases::VT_I32);
+    u32_ = FieldPosition(root, TypeAliases::VT_U32);
+    i64_ = FieldPosition(root, TypeAliases::VT_I64);
+    u64_ = FieldPosition(root, TypeAliases::VT_U64);
+    f32_ = FieldPosition(root, TypeAliases::VT_F32);
+    f64_ = FieldPosition(root, TypeAliases::VT_F64);
+  }
+  bool mutate_i8(uint8_t *buf, int8_t _i8) const {
+    if (!i8_) return false;
+    flatbuffers::WriteScalar<int8_t>(buf + i8_, _i8);
+    return true;
+  }
+  bool mutate_u8(uint8_t *buf, uint8_t _u8) const {
+    if (!u8_) return false;
+    flatbuffers::WriteScalar<uint8_t>(buf + u8_, _u8);
+    return true;
+  }
+  bool mutate_i16(uint8_t *buf, int16_t _i16) const {
+    if (!i16_) return false;
+    flatbuffers::WriteScalar<int16_t>(buf + i16_, _i16);
+    return true;
+  }
+  bool mutate_u16(uint8_t *buf, uint16_t _u16) const {
+    if (!u16_) return false;
+    flatbuffers::WriteScalar<uint16_t>(buf + u16_, _u16);
+    return true;
+  }
+  bool mutate_i32(uint8_t *buf, int32_t _i32) const {
+    if (!i32_) return false;
+    flatbuffers::WriteScalar<int32_t>(buf + i32_, _i32);
+    return true;
+  }
+  bool mutate_u32(uint8_t *buf, uint32_t _u32) const {
+    if (!u32_) return false;
+    flatbuffers::WriteScalar<uint32_t>(buf + u32_, _u32);
+    return true;
+  }
+  bool mutate_i64(uint8_t *buf, int64_t _i64) const {
+    if (!i64_) return false;
+    flatbuffers::WriteScalar<int64_t>(buf + i64_, _i64);
+    return true;
+  }
+  bool mutate_u64(uint8_t *buf, uint64_t _u64) const {
+    if (!u64_) return false;
+    flatbuffers::WriteScalar<uint64_t>(buf + u64_, _u64);
+    return true;
+  }
+  bool mutate_f32(uint8_t *buf, float _f32) const {
+    if (!f32_) return false;
+    flatbuffers::WriteScalar<float>(buf + f32_, _f32);
+    return true;
+  }
+  bool mutate_f64(uint8_t *buf, double _f64) const {
+    if (!f64_) return false;
+    flatbuffers::WriteScalar<double>(buf + f64_, _f64);
+    return true;
+  }
+
+ private:
+  flatbuffers::uoffset_t i8_;
+  flatbuffers::uoffset_t u8_;
+  flatbuffers::uoffset_t i16_;
+  flatbuffers::uoffset_t u16_;
+  flatbuffers::uoffset_t i32_;
+  flatbuffers::uoffset_t u32_;
+  flatbuffers::uoffset_t i64_;
+  flatbuffers::uoffset_t u64_;
+  flatbuffers::uoffset_t f32_;
+  flatbuffers::uoffset_t f64_;
+};
+
 flatbuffers::Offset<TypeAliases> CreateTypeAliases(flatbuffers::FlatBufferBuilder &_fbb, const TypeAliasesT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const TypeAliasesT &_o);
 
 }  // namespace Example
 
@@ -2264,6 +2681,11 @@ inline flatbuffers::Offset<InParentNamespace> InParentNamespace::Pack(flatbuffer
   return CreateInParentNamespace(_fbb, _o, _rehasher);
 }
 
+inline flatbuffers::Offset<InParentNamespace> InParentNamespace::Pack(flatbuffers::FlatBufferBuilder &_fbb, const InParentNamespaceT &_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(_o));
+  return CreateInParentNamespace(_fbb, &_o, _rehasher);
+}
+
 inline flatbuffers::Offset<InParentNamespace> CreateInParentNamespace(flatbuffers::FlatBufferBuilder &_fbb, const InParentNamespaceT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
@@ -2272,6 +2694,27 @@ inline flatbuffers::Offset<InParentNamespace> CreateInParentNamespace(flatbuffer
       _fbb);
 }
 
+inline size_t GetPackedSizeUpperBound(const InParentNamespaceT &_o) {
+  (void)_o;
+  size_t _size = 15;
+  return _size;
+}
+
+inline size_t InParentNamespace::Hash() const {
+  uint64_t _h = 0;
+  return static_cast<size_t>(_h);
+}
+
+inline size_t InParentNamespaceT::Hash() const {
+  uint64_t _h = 0;
+  return static_cast<size_t>(_h);
+}
+
+inline bool InParentNamespace::Equals(const InParentNamespace &_o) const {
+  (void)_o;
+  return true;
+}
+
 namespace Example2 {
 
 inline MonsterT *Monster::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
@@ -2289,6 +2732,11 @@ inline flatbuffers::Offset<Monster> Monster::Pack(flatbuffers::FlatBufferBuilder
   return CreateMonster(_fbb, _o, _rehasher);
 }
 
+inline flatbuffers::Offset<Monster> Monster::Pack(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT &_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(_o));
+  return CreateMonster(_fbb, &_o, _rehasher);
+}
+
 inline flatbuffers::Offset<Monster> CreateMonster(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
@@ -2297,6 +2745,27 @@ inline flatbuffers::Offset<Monster> CreateMonster(flatbuffers::FlatBufferBuilder
       _fbb);
 }
 
+inline size_t GetPackedSizeUpperBound(const MonsterT &_o) {
+  (void)_o;
+  size_t _size = 15;
+  return _size;
+}
+
+inline size_t Monster::Hash() const {
+  uint64_t _h = 0;
+  return static_cast<size_t>(_h);
+}
+
+inline size_t MonsterT::Hash() const {
+  uint64_t _h = 0;
+  return static_cast<size_t>(_h);
+}
+
+inline bool Monster::Equals(const Monster &_o) const {
+  (void)_o;
+  return true;
+}
+
 }  // namespace Example2
 
 namespace Example {
@@ -2317,6 +2786,11 @@ inline flatbuffers::Offset<TestSimpleTableWithEnum> TestSimpleTableWithEnum::Pac
   return CreateTestSimpleTableWithEnum(_fbb, _o, _rehasher);
 }
 
+inline flatbuffers::Offset<TestSimpleTableWithEnum> TestSimpleTableWithEnum::Pack(flatbuffers::FlatBufferBuilder &_fbb, const TestSimpleTableWithEnumT &_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(_o));
+  return CreateTestSimpleTableWithEnum(_fbb, &_o, _rehasher);
+}
+
 inline flatbuffers::Offset<TestSimpleTableWithEnum> CreateTestSimpleTableWithEnum(flatbuffers::FlatBufferBuilder &_fbb, const TestSimpleTableWithEnumT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
@@ -2327,6 +2801,28 @@ inline flatbuffers::Offset<TestSimpleTableWithEnum> CreateTestSimpleTableWithEnu
       _color);
 }
 
+inline size_t GetPackedSizeUpperBound(const TestSimpleTableWithEnumT &_o) {
+  (void)_o;
+  size_t _size = 26;
+  return _size;
+}
+
+inline size_t TestSimpleTableWithEnum::Hash() const {
+  uint64_t _h = 0;
+  { auto _e = GetField<int8_t>(VT_COLOR, 2); if (_e != 2) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_COLOR), _e); }
+  return static_cast<size_t>(_h);
+}
+
+inline size_t TestSimpleTableWithEnumT::Hash() const {
+  uint64_t _h = 0;
+  { auto _e = static_cast<int8_t>(color); if (_e != 2) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, TestSimpleTableWithEnum::VT_COLOR), _e); }
+  return static_cast<size_t>(_h);
+}
+
+inline bool TestSimpleTableWithEnum::Equals(const TestSimpleTableWithEnum &_o) const {
+  return flatbuffers::ScalarEquals(GetField<int8_t>(VT_COLOR, 2), _o.GetField<int8_t>(VT_COLOR, 2));
+}
+
 inline StatT *Stat::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
   auto _o = new StatT();
   UnPackTo(_o, _resolver);
@@ -2336,7 +2832,7 @@ inline StatT *Stat::UnPack(const flatbuffers::resolver_function_t *_resolver) co
 inline void Stat::UnPackTo(StatT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = id(); if (_e) _o->id = _e->str(); };
+  { auto _e = id(); if (_e) { _o->id.assign(_e->c_str(), _e->size()); } else { _o->id.clear(); } };
   { auto _e = val(); _o->val = _e; };
   { auto _e = count(); _o->count = _e; };
 }
@@ -2345,6 +2841,11 @@ inline flatbuffers::Offset<Stat> Stat::Pack(flatbuffers::FlatBufferBuilder &_fbb
   return CreateStat(_fbb, _o, _rehasher);
 }
 
+inline flatbuffers::Offset<Stat> Stat::Pack(flatbuffers::FlatBufferBuilder &_fbb, const StatT &_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(_o));
+  return CreateStat(_fbb, &_o, _rehasher);
+}
+
 inline flatbuffers::Offset<Stat> CreateStat(flatbuffers::FlatBufferBuilder &_fbb, const StatT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
@@ -2359,6 +2860,35 @@ inline flatbuffers::Offset<Stat> CreateStat(flatbuffers::FlatBufferBuilder &_fbb
       _count);
 }
 
+inline size_t GetPackedSizeUpperBound(const StatT &_o) {
+  (void)_o;
+  size_t _size = 78;
+  _size += _o.id.length();
+  return _size;
+}
+
+inline size_t Stat::Hash() const {
+  uint64_t _h = 0;
+  { auto _e = id(); if (_e && _e->size()) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, VT_ID), _e->c_str(), _e->size()); }
+  { auto _e = GetField<int64_t>(VT_VAL, 0); if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_VAL), _e); }
+  { auto _e = GetField<uint16_t>(VT_COUNT, 0); if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_COUNT), _e); }
+  return static_cast<size_t>(_h);
+}
+
+inline size_t StatT::Hash() const {
+  uint64_t _h = 0;
+  { auto &_e = id; if (_e.length()) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, Stat::VT_ID), _e.c_str(), _e.length()); }
+  { auto _e = val; if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, Stat::VT_VAL), _e); }
+  { auto _e = count; if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, Stat::VT_COUNT), _e); }
+  return static_cast<size_t>(_h);
+}
+
+inline bool Stat::Equals(const Stat &_o) const {
+  return flatbuffers::StringEquals(id(), _o.id()) &&
+         flatbuffers::ScalarEquals(GetField<int64_t>(VT_VAL, 0), _o.GetField<int64_t>(VT_VAL, 0)) &&
+         flatbuffers::ScalarEquals(GetField<uint16_t>(VT_COUNT, 0), _o.GetField<uint16_t>(VT_COUNT, 0));
+}
+
 inline ReferrableT *Referrable::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
   auto _o = new ReferrableT();
   UnPackTo(_o, _resolver);
@@ -2375,6 +2905,11 @@ inline flatbuffers::Offset<Referrable> Referrable::Pack(flatbuffers::FlatBufferB
   return CreateReferrable(_fbb, _o, _rehasher);
 }
 
+inline flatbuffers::Offset<Referrable> Referrable::Pack(flatbuffers::FlatBufferBuilder &_fbb, const ReferrableT &_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(_o));
+  return CreateReferrable(_fbb, &_o, _rehasher);
+}
+
 inline flatbuffers::Offset<Referrable> CreateReferrable(flatbuffers::FlatBufferBuilder &_fbb, const ReferrableT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
@@ -2385,6 +2920,28 @@ inline flatbuffers::Offset<Referrable> CreateReferrable(flatbuffers::FlatBufferB
       _id);
 }
 
+inline size_t GetPackedSizeUpperBound(const ReferrableT &_o) {
+  (void)_o;
+  size_t _size = 40;
+  return _size;
+}
+
+inline size_t Referrable::Hash() const {
+  uint64_t _h = 0;
+  { auto _e = GetField<uint64_t>(VT_ID, 0); if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_ID), _e); }
+  return static_cast<size_t>(_h);
+}
+
+inline size_t ReferrableT::Hash() const {
+  uint64_t _h = 0;
+  { auto _e = id; if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, Referrable::VT_ID), _e); }
+  return static_cast<size_t>(_h);
+}
+
+inline bool Referrable::Equals(const Referrable &_o) const {
+  return flatbuffers::ScalarEquals(GetField<uint64_t>(VT_ID, 0), _o.GetField<uint64_t>(VT_ID, 0));
+}
+
 inline MonsterT *Monster::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
   auto _o = new MonsterT();
   UnPackTo(_o, _resolver);
@@ -2394,20 +2951,19 @@ inline MonsterT *Monster::UnPack(const flatbuffers::resolver_function_t *_resolv
 inline void Monster::UnPackTo(MonsterT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = pos(); if (_e) _o->pos = flatbuffers::unique_ptr<Vec3>(new Vec3(*_e)); };
+  { auto _e = pos(); if (_e) { if (_o->pos) { *_o->pos = *_e; } else { _o->pos = flatbuffers::unique_ptr<Vec3>(new Vec3(*_e)); } } else { _o->pos.reset(); } };
   { auto _e = mana(); _o->mana = _e; };
   { auto _e = hp(); _o->hp = _e; };
-  { auto _e = name(); if (_e) _o->name = _e->str(); };
-  { auto _e = inventory(); if (_e) { _o->inventory.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->inventory[_i] = _e->Get(_i); } } };
+  { auto _e = name(); if (_e) { _o->name.assign(_e->c_str(), _e->size()); } else { _o->name.clear(); } };
+  { auto _e = inventory(); if (_e) { flatbuffers::UnPackVector(*_e, &_o->inventory); } else { _o->inventory.clear(); } };
   { auto _e = color(); _o->color = _e; };
-  { auto _e = test_type(); _o->test.type = _e; };
-  { auto _e = test(); if (_e) _o->test.value = AnyUnion::UnPack(_e, test_type(), _resolver); };
-  { auto _e = test4(); if (_e) { _o->test4.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->test4[_i] = *_e->Get(_i); } } };
-  { auto _e = testarrayofstring(); if (_e) { _o->testarrayofstring.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofstring[_i] = _e->Get(_i)->str(); } } };
-  { auto _e = testarrayoftables(); if (_e) { _o->testarrayoftables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayoftables[_i] = flatbuffers::unique_ptr<MonsterT>(_e->Get(_i)->UnPack(_resolver)); } } };
-  { auto _e = enemy(); if (_e) _o->enemy = flatbuffers::unique_ptr<MonsterT>(_e->UnPack(_resolver)); };
-  { auto _e = testnestedflatbuffer(); if (_e) { _o->testnestedflatbuffer.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testnestedflatbuffer[_i] = _e->Get(_i); } } };
-  { auto _e = testempty(); if (_e) _o->testempty = flatbuffers::unique_ptr<StatT>(_e->UnPack(_resolver)); };
+  { auto _e = test(); if (_e) { _o->test.UnPackTo(_e, test_type(), _resolver); } else { _o->test.Reset(); } };
+  { auto _e = test4(); if (_e) { flatbuffers::UnPackVector(*_e, &_o->test4); } else { _o->test4.clear(); } };
+  { auto _e = testarrayofstring(); if (_e) { _o->testarrayofstring.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofstring[_i].assign(_e->Get(_i)->c_str(), _e->Get(_i)->size()); } } else { _o->testarrayofstring.clear(); } };
+  { auto _e = testarrayoftables(); if (_e) { _o->testarrayoftables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if (_o->testarrayoftables[_i]) { _e->Get(_i)->UnPackTo(_o->testarrayoftables[_i].get(), _resolver); } else { _o->testarrayoftables[_i] = flatbuffers::unique_ptr<MonsterT>(_e->Get(_i)->UnPack(_resolver)); } } } else { _o->testarrayoftables.clear(); } };
+  { auto _e = enemy(); if (_e) { if (_o->enemy) { _e->UnPackTo(_o->enemy.get(), _resolver); } else { _o->enemy = flatbuffers::unique_ptr<MonsterT>(_e->UnPack(_resolver)); } } else { _o->enemy.reset(); } };
+  { auto _e = testnestedflatbuffer(); if (_e) { flatbuffers::UnPackVector(*_e, &_o->testnestedflatbuffer); } else { _o->testnestedflatbuffer.clear(); } };
+  { auto _e = testempty(); if (_e) { if (_o->testempty) { _e->UnPackTo(_o->testempty.get(), _resolver); } else { _o->testempty = flatbuffers::unique_ptr<StatT>(_e->UnPack(_resolver)); } } else { _o->testempty.reset(); } };
   { auto _e = testbool(); _o->testbool = _e; };
   { auto _e = testhashs32_fnv1(); _o->testhashs32_fnv1 = _e; };
   { auto _e = testhashu32_fnv1(); _o->testhashu32_fnv1 = _e; };
@@ -2418,42 +2974,47 @@ inline void Monster::UnPackTo(MonsterT *_o, const flatbuffers::resolver_function
 if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->testhashu32_fnv1a), static_cast<flatbuffers::hash_value_t>(_e)); else _o->testhashu32_fnv1a = nullptr; };
   { auto _e = testhashs64_fnv1a(); _o->testhashs64_fnv1a = _e; };
   { auto _e = testhashu64_fnv1a(); _o->testhashu64_fnv1a = _e; };
-  { auto _e = testarrayofbools(); if (_e) { _o->testarrayofbools.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofbools[_i] = _e->Get(_i) != 0; } } };
+  { auto _e = testarrayofbools(); if (_e) { _o->testarrayofbools.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofbools[_i] = _e->Get(_i) != 0; } } else { _o->testarrayofbools.clear(); } };
   { auto _e = testf(); _o->testf = _e; };
   { auto _e = testf2(); _o->testf2 = _e; };
   { auto _e = testf3(); _o->testf3 = _e; };
-  { auto _e = testarrayofstring2(); if (_e) { _o->testarrayofstring2.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofstring2[_i] = _e->Get(_i)->str(); } } };
-  { auto _e = testarrayofsortedstruct(); if (_e) { _o->testarrayofsortedstruct.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofsortedstruct[_i] = *_e->Get(_i); } } };
-  { auto _e = flex(); if (_e) { _o->flex.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->flex[_i] = _e->Get(_i); } } };
-  { auto _e = test5(); if (_e) { _o->test5.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->test5[_i] = *_e->Get(_i); } } };
-  { auto _e = vector_of_longs(); if (_e) { _o->vector_of_longs.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_longs[_i] = _e->Get(_i); } } };
-  { auto _e = vector_of_doubles(); if (_e) { _o->vector_of_doubles.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_doubles[_i] = _e->Get(_i); } } };
-  { auto _e = parent_namespace_test(); if (_e) _o->parent_namespace_test = flatbuffers::unique_ptr<MyGame::InParentNamespaceT>(_e->UnPack(_resolver)); };
-  { auto _e = vector_of_referrables(); if (_e) { _o->vector_of_referrables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_referrables[_i] = flatbuffers::unique_ptr<ReferrableT>(_e->Get(_i)->UnPack(_resolver)); } } };
+  { auto _e = testarrayofstring2(); if (_e) { _o->testarrayofstring2.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofstring2[_i].assign(_e->Get(_i)->c_str(), _e->Get(_i)->size()); } } else { _o->testarrayofstring2.clear(); } };
+  { auto _e = testarrayofsortedstruct(); if (_e) { flatbuffers::UnPackVector(*_e, &_o->testarrayofsortedstruct); } else { _o->testarrayofsortedstruct.clear(); } };
+  { auto _e = flex(); if (_e) { flatbuffers::UnPackVector(*_e, &_o->flex); } else { _o->flex.clear(); } };
+  { auto _e = test5(); if (_e) { flatbuffers::UnPackVector(*_e, &_o->test5); } else { _o->test5.clear(); } };
+  { auto _e = vector_of_longs(); if (_e) { flatbuffers::UnPackVector(*_e, &_o->vector_of_longs); } else { _o->vector_of_longs.clear(); } };
+  { auto _e = vector_of_doubles(); if (_e) { flatbuffers::UnPackVector(*_e, &_o->vector_of_doubles); } else { _o->vector_of_doubles.clear(); } };
+  { auto _e = parent_namespace_test(); if (_e) { if (_o->parent_namespace_test) { _e->UnPackTo(_o->parent_namespace_test.get(), _resolver); } else { _o->parent_namespace_test = flatbuffers::unique_ptr<MyGame::InParentNamespaceT>(_e->UnPack(_resolver)); } } else { _o->parent_namespace_test.reset(); } };
+  { auto _e = vector_of_referrables(); if (_e) { _o->vector_of_referrables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if (_o->vector_of_referrables[_i]) { _e->Get(_i)->UnPackTo(_o->vector_of_referrables[_i].get(), _resolver); } else { _o->vector_of_referrables[_i] = flatbuffers::unique_ptr<ReferrableT>(_e->Get(_i)->UnPack(_resolver)); } } } else { _o->vector_of_referrables.clear(); } };
   { auto _e = single_weak_reference(); //scalar resolver, naked 
 if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->single_weak_reference), static_cast<flatbuffers::hash_value_t>(_e)); else _o->single_weak_reference = nullptr; };
   { auto _e = vector_of_weak_references(); if (_e) { _o->vector_of_weak_references.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { //vector resolver, naked
-if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_weak_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i))); else _o->vector_of_weak_references[_i] = nullptr; } } };
-  { auto _e = vector_of_strong_referrables(); if (_e) { _o->vector_of_strong_referrables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_strong_referrables[_i] = flatbuffers::unique_ptr<ReferrableT>(_e->Get(_i)->UnPack(_resolver)); } } };
+if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_weak_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i))); else _o->vector_of_weak_references[_i] = nullptr; } } else { _o->vector_of_weak_references.clear(); } };
+  { auto _e = vector_of_strong_referrables(); if (_e) { _o->vector_of_strong_referrables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if (_o->vector_of_strong_referrables[_i]) { _e->Get(_i)->UnPackTo(_o->vector_of_strong_referrables[_i].get(), _resolver); } else { _o->vector_of_strong_referrables[_i] = flatbuffers::unique_ptr<ReferrableT>(_e->Get(_i)->UnPack(_resolver)); } } } else { _o->vector_of_strong_referrables.clear(); } };
   { auto _e = co_owning_reference(); //scalar resolver, naked 
 if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->co_owning_reference), static_cast<flatbuffers::hash_value_t>(_e)); else _o->co_owning_reference = nullptr; };
   { auto _e = vector_of_co_owning_references(); if (_e) { _o->vector_of_co_owning_references.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { //vector resolver, default_ptr_type
-if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_co_owning_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i)));/* else do nothing */; } } };
+if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_co_owning_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i)));/* else do nothing */; } } else { _o->vector_of_co_owning_references.clear(); } };
   { auto _e = non_owning_reference(); //scalar resolver, naked 
 if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->non_owning_reference), static_cast<flatbuffers::hash_value_t>(_e)); else _o->non_owning_reference = nullptr; };
   { auto _e = vector_of_non_owning_references(); if (_e) { _o->vector_of_non_owning_references.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { //vector resolver, naked
-if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_non_owning_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i))); else _o->vector_of_non_owning_references[_i] = nullptr; } } };
-  { auto _e = any_unique_type(); _o->any_unique.type = _e; };
-  { auto _e = any_unique(); if (_e) _o->any_unique.value = AnyUniqueAliasesUnion::UnPack(_e, any_unique_type(), _resolver); };
-  { auto _e = any_ambiguous_type(); _o->any_ambiguous.type = _e; };
-  { auto _e = any_ambiguous(); if (_e) _o->any_ambiguous.value = AnyAmbiguousAliasesUnion::UnPack(_e, any_ambiguous_type(), _resolver); };
-  { auto _e = vector_of_enums(); if (_e) { _o->vector_of_enums.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_enums[_i] = static_cast<Color>(_e->Get(_i)); } } };
+if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_non_owning_references[_i]), static_cast<flatbuffers::hash_value_t>(_e->Get(_i))); else _o->vector_of_non_owning_references[_i] = nullptr; } } else { _o->vector_of_non_owning_references.clear(); } };
+  { auto _e = any_unique(); if (_e) { _o->any_unique.UnPackTo(_e, any_unique_type(), _resolver); } else { _o->any_unique.Reset(); } };
+  { auto _e = any_ambiguous(); if (_e) { _o->any_ambiguous.UnPackTo(_e, any_ambiguous_type(), _resolver); } else { _o->any_ambiguous.Reset(); } };
+  { auto _e = vector_of_enums(); if (_e) { _o->vector_of_enums.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_enums[_i] = static_cast<Color>(_e->Get(_i)); } } else { _o->vector_of_enums.clear(); } };
+  { auto _e = vector_of_hashed_referrables(); if (_e) { _o->vector_of_hashed_referrables.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if (_o->vector_of_hashed_referrables[_i]) { _e->Get(_i)->UnPackTo(_o->vector_of_hashed_referrables[_i].get(), _resolver); } else { _o->vector_of_hashed_referrables[_i] = flatbuffers::unique_ptr<ReferrableT>(_e->Get(_i)->UnPack(_resolver)); } } } else { _o->vector_of_hashed_referrables.clear(); } };
+  { auto _e = vector_of_hashed_referrables_hash_index(); if (_e) { flatbuffers::UnPackVector(*_e, &_o->vector_of_hashed_referrables_hash_index); } else { _o->vector_of_hashed_referrables_hash_index.clear(); } };
 }
 
 inline flatbuffers::Offset<Monster> Monster::Pack(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
   return CreateMonster(_fbb, _o, _rehasher);
 }
 
+inline flatbuffers::Offset<Monster> Monster::Pack(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT &_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(_o));
+  return CreateMonster(_fbb, &_o, _rehasher);
+}
+
 inline flatbuffers::Offset<Monster> CreateMonster(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
@@ -2505,6 +3066,8 @@ inline flatbuffers::Offset<Monster> CreateMonster(flatbuffers::FlatBufferBuilder
   auto _any_ambiguous_type = _o->any_ambiguous.type;
   auto _any_ambiguous = _o->any_ambiguous.Pack(_fbb);
   auto _vector_of_enums = _o->vector_of_enums.size() ? _fbb.CreateVectorScalarCast<int8_t>(flatbuffers::data(_o->vector_of_enums), _o->vector_of_enums.size()) : 0;
+  auto _vector_of_hashed_referrables = _o->vector_of_hashed_referrables.size() ? _fbb.CreateVector<flatbuffers::Offset<Referrable>> (_o->vector_of_hashed_referrables.size(), [](size_t i, _VectorArgs *__va) { return CreateReferrable(*__va->__fbb, __va->__o->vector_of_hashed_referrables[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _vector_of_hashed_referrables_hash_index = _fbb.CreateHashIndex(_vector_of_hashed_referrables);
   return MyGame::Example::CreateMonster(
       _fbb,
       _pos,
@@ -2553,7 +3116,200 @@ inline flatbuffers::Offset<Monster> CreateMonster(flatbuffers::FlatBufferBuilder
       _any_unique,
       _any_ambiguous_type,
       _any_ambiguous,
-      _vector_of_enums);
+      _vector_of_enums,
+      _vector_of_hashed_referrables,
+      _vector_of_hashed_referrables_hash_index);
+}
+
+inline size_t GetPackedSizeUpperBound(const MonsterT &_o) {
+  (void)_o;
+  size_t _size = 1125;
+  _size += _o.name.length();
+  _size += _o.inventory.size() * 1;
+  _size += _o.test.GetPackedSizeUpperBound();
+  _size += _o.test4.size() * 4;
+  _size += _o.testarrayofstring.size() * 4;
+  for (size_t _i = 0; _i < _o.testarrayofstring.size(); _i++) {
+    _size += _o.testarrayofstring[_i].length() + 8;
+  }
+  _size += _o.testarrayoftables.size() * 4;
+  for (size_t _i = 0; _i < _o.testarrayoftables.size(); _i++) {
+    _size += GetPackedSizeUpperBound(*_o.testarrayoftables[_i]);
+  }
+  if (_o.enemy) _size += GetPackedSizeUpperBound(*_o.enemy);
+  _size += _o.testnestedflatbuffer.size() * 1;
+  if (_o.testempty) _size += GetPackedSizeUpperBound(*_o.testempty);
+  _size += _o.testarrayofbools.size() * 1;
+  _size += _o.testarrayofstring2.size() * 4;
+  for (size_t _i = 0; _i < _o.testarrayofstring2.size(); _i++) {
+    _size += _o.testarrayofstring2[_i].length() + 8;
+  }
+  _size += _o.testarrayofsortedstruct.size() * 8;
+  _size += _o.flex.size() * 1;
+  _size += _o.test5.size() * 4;
+  _size += _o.vector_of_longs.size() * 8;
+  _size += _o.vector_of_doubles.size() * 8;
+  if (_o.parent_namespace_test) _size += GetPackedSizeUpperBound(*_o.parent_namespace_test);
+  _size += _o.vector_of_referrables.size() * 4;
+  for (size_t _i = 0; _i < _o.vector_of_referrables.size(); _i++) {
+    _size += GetPackedSizeUpperBound(*_o.vector_of_referrables[_i]);
+  }
+  _size += _o.vector_of_weak_references.size() * 8;
+  _size += _o.vector_of_strong_referrables.size() * 4;
+  for (size_t _i = 0; _i < _o.vector_of_strong_referrables.size(); _i++) {
+    _size += GetPackedSizeUpperBound(*_o.vector_of_strong_referrables[_i]);
+  }
+  _size += _o.vector_of_co_owning_references.size() * 8;
+  _size += _o.vector_of_non_owning_references.size() * 8;
+  _size += _o.any_unique.GetPackedSizeUpperBound();
+  _size += _o.any_ambiguous.GetPackedSizeUpperBound();
+  _size += _o.vector_of_enums.size() * 1;
+  _size += _o.vector_of_hashed_referrables.size() * 4;
+  for (size_t _i = 0; _i < _o.vector_of_hashed_referrables.size(); _i++) {
+    _size += GetPackedSizeUpperBound(*_o.vector_of_hashed_referrables[_i]);
+  }
+  _size += _o.vector_of_hashed_referrables_hash_index.size() * 4;
+  return _size;
+}
+
+inline size_t Monster::Hash() const {
+  uint64_t _h = 0;
+  { auto _e = pos(); if (_e) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, VT_POS), _e, sizeof(*_e)); }
+  { auto _e = GetField<int16_t>(VT_MANA, 150); if (_e != 150) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_MANA), _e); }
+  { auto _e = GetField<int16_t>(VT_HP, 100); if (_e != 100) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_HP), _e); }
+  { auto _e = name(); if (_e && _e->size()) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, VT_NAME), _e->c_str(), _e->size()); }
+  { auto _e = inventory(); if (_e && _e->size()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, VT_INVENTORY), *_e); }
+  { auto _e = GetField<int8_t>(VT_COLOR, 8); if (_e != 8) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_COLOR), _e); }
+  { auto _t = test_type(); if (_t != Any_NONE) _h = flatbuffers::HashCombine(flatbuffers::HashCombine(flatbuffers::HashCombine(_h, VT_TEST), static_cast<uint64_t>(_t)), HashAny(test(), _t)); }
+  { auto _e = test4(); if (_e && _e->size()) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, VT_TEST4), _e->Data(), _e->size() * sizeof(Test)); }
+  { auto _e = testarrayofstring(); if (_e && _e->size()) _h = flatbuffers::HashStrings(flatbuffers::HashCombine(_h, VT_TESTARRAYOFSTRING), *_e); }
+  { auto _e = testarrayoftables(); if (_e && _e->size()) _h = flatbuffers::HashTables(flatbuffers::HashCombine(_h, VT_TESTARRAYOFTABLES), *_e); }
+  { auto _e = enemy(); if (_e) _h = flatbuffers::HashCombine(flatbuffers::HashCombine(_h, VT_ENEMY), _e->Hash()); }
+  { auto _e = testnestedflatbuffer(); if (_e && _e->size()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, VT_TESTNESTEDFLATBUFFER), *_e); }
+  { auto _e = testempty(); if (_e) _h = flatbuffers::HashCombine(flatbuffers::HashCombine(_h, VT_TESTEMPTY), _e->Hash()); }
+  { auto _e = GetField<uint8_t>(VT_TESTBOOL, 0); if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_TESTBOOL), _e); }
+  { auto _e = GetField<int32_t>(VT_TESTHASHS32_FNV1, 0); if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_TESTHASHS32_FNV1), _e); }
+  { auto _e = GetField<uint32_t>(VT_TESTHASHU32_FNV1, 0); if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_TESTHASHU32_FNV1), _e); }
+  { auto _e = GetField<int64_t>(VT_TESTHASHS64_FNV1, 0); if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_TESTHASHS64_FNV1), _e); }
+  { auto _e = GetField<uint64_t>(VT_TESTHASHU64_FNV1, 0); if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_TESTHASHU64_FNV1), _e); }
+  { auto _e = GetField<int32_t>(VT_TESTHASHS32_FNV1A, 0); if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_TESTHASHS32_FNV1A), _e); }
+  { auto _e = GetField<int64_t>(VT_TESTHASHS64_FNV1A, 0); if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_TESTHASHS64_FNV1A), _e); }
+  { auto _e = GetField<uint64_t>(VT_TESTHASHU64_FNV1A, 0); if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_TESTHASHU64_FNV1A), _e); }
+  { auto _e = testarrayofbools(); if (_e && _e->size()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, VT_TESTARRAYOFBOOLS), *_e); }
+  { auto _e = GetField<float>(VT_TESTF, 3.14159f); if (_e != 3.14159f) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_TESTF), _e); }
+  { auto _e = GetField<float>(VT_TESTF2, 3.0f); if (_e != 3.0f) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_TESTF2), _e); }
+  { auto _e = GetField<float>(VT_TESTF3, 0.0f); if (_e != 0.0f) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_TESTF3), _e); }
+  { auto _e = testarrayofstring2(); if (_e && _e->size()) _h = flatbuffers::HashStrings(flatbuffers::HashCombine(_h, VT_TESTARRAYOFSTRING2), *_e); }
+  { auto _e = testarrayofsortedstruct(); if (_e && _e->size()) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, VT_TESTARRAYOFSORTEDSTRUCT), _e->Data(), _e->size() * sizeof(Ability)); }
+  { auto _e = flex(); if (_e && _e->size()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, VT_FLEX), *_e); }
+  { auto _e = test5(); if (_e && _e->size()) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, VT_TEST5), _e->Data(), _e->size() * sizeof(Test)); }
+  { auto _e = vector_of_longs(); if (_e && _e->size()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, VT_VECTOR_OF_LONGS), *_e); }
+  { auto _e = vector_of_doubles(); if (_e && _e->size()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, VT_VECTOR_OF_DOUBLES), *_e); }
+  { auto _e = parent_namespace_test(); if (_e) _h = flatbuffers::HashCombine(flatbuffers::HashCombine(_h, VT_PARENT_NAMESPACE_TEST), _e->Hash()); }
+  { auto _e = vector_of_referrables(); if (_e && _e->size()) _h = flatbuffers::HashTables(flatbuffers::HashCombine(_h, VT_VECTOR_OF_REFERRABLES), *_e); }
+  { auto _e = vector_of_strong_referrables(); if (_e && _e->size()) _h = flatbuffers::HashTables(flatbuffers::HashCombine(_h, VT_VECTOR_OF_STRONG_REFERRABLES), *_e); }
+  { auto _t = any_unique_type(); if (_t != AnyUniqueAliases_NONE) _h = flatbuffers::HashCombine(flatbuffers::HashCombine(flatbuffers::HashCombine(_h, VT_ANY_UNIQUE), static_cast<uint64_t>(_t)), HashAnyUniqueAliases(any_unique(), _t)); }
+  { auto _t = any_ambiguous_type(); if (_t != AnyAmbiguousAliases_NONE) _h = flatbuffers::HashCombine(flatbuffers::HashCombine(flatbuffers::HashCombine(_h, VT_ANY_AMBIGUOUS), static_cast<uint64_t>(_t)), HashAnyAmbiguousAliases(any_ambiguous(), _t)); }
+  { auto _e = vector_of_enums(); if (_e && _e->size()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, VT_VECTOR_OF_ENUMS), *_e); }
+  { auto _e = vector_of_hashed_referrables(); if (_e && _e->size()) _h = flatbuffers::HashTables(flatbuffers::HashCombine(_h, VT_VECTOR_OF_HASHED_REFERRABLES), *_e); }
+  { auto _e = vector_of_hashed_referrables_hash_index(); if (_e && _e->size()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, VT_VECTOR_OF_HASHED_REFERRABLES_HASH_INDEX), *_e); }
+  return static_cast<size_t>(_h);
+}
+
+inline size_t MonsterT::Hash() const {
+  uint64_t _h = 0;
+  { auto _e = pos.get(); if (_e) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, Monster::VT_POS), _e, sizeof(*_e)); }
+  { auto _e = mana; if (_e != 150) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, Monster::VT_MANA), _e); }
+  { auto _e = hp; if (_e != 100) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, Monster::VT_HP), _e); }
+  { auto &_e = name; if (_e.length()) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, Monster::VT_NAME), _e.c_str(), _e.length()); }
+  { auto &_e = inventory; if (!_e.empty()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, Monster::VT_INVENTORY), _e); }
+  { auto _e = static_cast<int8_t>(color); if (_e != 8) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, Monster::VT_COLOR), _e); }
+  if (test.type != Any_NONE) _h = flatbuffers::HashCombine(flatbuffers::HashCombine(flatbuffers::HashCombine(_h, Monster::VT_TEST), static_cast<uint64_t>(test.type)), test.Hash());
+  { auto &_e = test4; if (!_e.empty()) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, Monster::VT_TEST4), _e.data(), _e.size() * sizeof(Test)); }
+  { auto &_e = testarrayofstring; if (!_e.empty()) _h = flatbuffers::HashStrings(flatbuffers::HashCombine(_h, Monster::VT_TESTARRAYOFSTRING), _e); }
+  { auto &_e = testarrayoftables; if (!_e.empty()) _h = flatbuffers::HashTables(flatbuffers::HashCombine(_h, Monster::VT_TESTARRAYOFTABLES), _e); }
+  { auto _e = enemy.get(); if (_e) _h = flatbuffers::HashCombine(flatbuffers::HashCombine(_h, Monster::VT_ENEMY), _e->Hash()); }
+  { auto &_e = testnestedflatbuffer; if (!_e.empty()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, Monster::VT_TESTNESTEDFLATBUFFER), _e); }
+  { auto _e = testempty.get(); if (_e) _h = flatbuffers::HashCombine(flatbuffers::HashCombine(_h, Monster::VT_TESTEMPTY), _e->Hash()); }
+  { auto _e = static_cast<uint8_t>(testbool); if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, Monster::VT_TESTBOOL), _e); }
+  { auto _e = testhashs32_fnv1; if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, Monster::VT_TESTHASHS32_FNV1), _e); }
+  { auto _e = testhashu32_fnv1; if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, Monster::VT_TESTHASHU32_FNV1), _e); }
+  { auto _e = testhashs64_fnv1; if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, Monster::VT_TESTHASHS64_FNV1), _e); }
+  { auto _e = testhashu64_fnv1; if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, Monster::VT_TESTHASHU64_FNV1), _e); }
+  { auto _e = testhashs32_fnv1a; if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, Monster::VT_TESTHASHS32_FNV1A), _e); }
+  { auto _e = testhashs64_fnv1a; if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, Monster::VT_TESTHASHS64_FNV1A), _e); }
+  { auto _e = testhashu64_fnv1a; if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, Monster::VT_TESTHASHU64_FNV1A), _e); }
+  { auto &_e = testarrayofbools; if (!_e.empty()) _h = flatbuffers::HashScalarsAs<uint8_t>(flatbuffers::HashCombine(_h, Monster::VT_TESTARRAYOFBOOLS), _e); }
+  { auto _e = testf; if (_e != 3.14159f) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, Monster::VT_TESTF), _e); }
+  { auto _e = testf2; if (_e != 3.0f) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, Monster::VT_TESTF2), _e); }
+  { auto _e = testf3; if (_e != 0.0f) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, Monster::VT_TESTF3), _e); }
+  { auto &_e = testarrayofstring2; if (!_e.empty()) _h = flatbuffers::HashStrings(flatbuffers::HashCombine(_h, Monster::VT_TESTARRAYOFSTRING2), _e); }
+  { auto &_e = testarrayofsortedstruct; if (!_e.empty()) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, Monster::VT_TESTARRAYOFSORTEDSTRUCT), _e.data(), _e.size() * sizeof(Ability)); }
+  { auto &_e = flex; if (!_e.empty()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, Monster::VT_FLEX), _e); }
+  { auto &_e = test5; if (!_e.empty()) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, Monster::VT_TEST5), _e.data(), _e.size() * sizeof(Test)); }
+  { auto &_e = vector_of_longs; if (!_e.empty()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, Monster::VT_VECTOR_OF_LONGS), _e); }
+  { auto &_e = vector_of_doubles; if (!_e.empty()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, Monster::VT_VECTOR_OF_DOUBLES), _e); }
+  { auto _e = parent_namespace_test.get(); if (_e) _h = flatbuffers::HashCombine(flatbuffers::HashCombine(_h, Monster::VT_PARENT_NAMESPACE_TEST), _e->Hash()); }
+  { auto &_e = vector_of_referrables; if (!_e.empty()) _h = flatbuffers::HashTables(flatbuffers::HashCombine(_h, Monster::VT_VECTOR_OF_REFERRABLES), _e); }
+  { auto &_e = vector_of_strong_referrables; if (!_e.empty()) _h = flatbuffers::HashTables(flatbuffers::HashCombine(_h, Monster::VT_VECTOR_OF_STRONG_REFERRABLES), _e); }
+  if (any_unique.type != AnyUniqueAliases_NONE) _h = flatbuffers::HashCombine(flatbuffers::HashCombine(flatbuffers::HashCombine(_h, Monster::VT_ANY_UNIQUE), static_cast<uint64_t>(any_unique.type)), any_unique.Hash());
+  if (any_ambiguous.type != AnyAmbiguousAliases_NONE) _h = flatbuffers::HashCombine(flatbuffers::HashCombine(flatbuffers::HashCombine(_h, Monster::VT_ANY_AMBIGUOUS), static_cast<uint64_t>(any_ambiguous.type)), any_ambiguous.Hash());
+  { auto &_e = vector_of_enums; if (!_e.empty()) _h = flatbuffers::HashScalarsAs<int8_t>(flatbuffers::HashCombine(_h, Monster::VT_VECTOR_OF_ENUMS), _e); }
+  { auto &_e = vector_of_hashed_referrables; if (!_e.empty()) _h = flatbuffers::HashTables(flatbuffers::HashCombine(_h, Monster::VT_VECTOR_OF_HASHED_REFERRABLES), _e); }
+  { auto &_e = vector_of_hashed_referrables_hash_index; if (!_e.empty()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, Monster::VT_VECTOR_OF_HASHED_REFERRABLES_HASH_INDEX), _e); }
+  return static_cast<size_t>(_h);
+}
+
+inline bool Monster::Equals(const Monster &_o) const {
+  return flatbuffers::StructEquals(pos(), _o.pos()) &&
+         flatbuffers::ScalarEquals(GetField<int16_t>(VT_MANA, 150), _o.GetField<int16_t>(VT_MANA, 150)) &&
+         flatbuffers::ScalarEquals(GetField<int16_t>(VT_HP, 100), _o.GetField<int16_t>(VT_HP, 100)) &&
+         flatbuffers::StringEquals(name(), _o.name()) &&
+         flatbuffers::VectorEquals(inventory(), _o.inventory()) &&
+         flatbuffers::ScalarEquals(GetField<int8_t>(VT_COLOR, 8), _o.GetField<int8_t>(VT_COLOR, 8)) &&
+         test_type() == _o.test_type() &&
+         EqualsAny(test(), _o.test(), test_type()) &&
+         flatbuffers::VectorEquals(test4(), _o.test4()) &&
+         flatbuffers::VectorEquals(testarrayofstring(), _o.testarrayofstring()) &&
+         flatbuffers::VectorEquals(testarrayoftables(), _o.testarrayoftables()) &&
+         flatbuffers::TableEquals(enemy(), _o.enemy()) &&
+         flatbuffers::VectorEquals(testnestedflatbuffer(), _o.testnestedflatbuffer()) &&
+         flatbuffers::TableEquals(testempty(), _o.testempty()) &&
+         flatbuffers::ScalarEquals(GetField<uint8_t>(VT_TESTBOOL, 0), _o.GetField<uint8_t>(VT_TESTBOOL, 0)) &&
+         flatbuffers::ScalarEquals(GetField<int32_t>(VT_TESTHASHS32_FNV1, 0), _o.GetField<int32_t>(VT_TESTHASHS32_FNV1, 0)) &&
+         flatbuffers::ScalarEquals(GetField<uint32_t>(VT_TESTHASHU32_FNV1, 0), _o.GetField<uint32_t>(VT_TESTHASHU32_FNV1, 0)) &&
+         flatbuffers::ScalarEquals(GetField<int64_t>(VT_TESTHASHS64_FNV1, 0), _o.GetField<int64_t>(VT_TESTHASHS64_FNV1, 0)) &&
+         flatbuffers::ScalarEquals(GetField<uint64_t>(VT_TESTHASHU64_FNV1, 0), _o.GetField<uint64_t>(VT_TESTHASHU64_FNV1, 0)) &&
+         flatbuffers::ScalarEquals(GetField<int32_t>(VT_TESTHASHS32_FNV1A, 0), _o.GetField<int32_t>(VT_TESTHASHS32_FNV1A, 0)) &&
+         flatbuffers::ScalarEquals(GetField<uint32_t>(VT_TESTHASHU32_FNV1A, 0), _o.GetField<uint32_t>(VT_TESTHASHU32_FNV1A, 0)) &&
+         flatbuffers::ScalarEquals(GetField<int64_t>(VT_TESTHASHS64_FNV1A, 0), _o.GetField<int64_t>(VT_TESTHASHS64_FNV1A, 0)) &&
+         flatbuffers::ScalarEquals(GetField<uint64_t>(VT_TESTHASHU64_FNV1A, 0), _o.GetField<uint64_t>(VT_TESTHASHU64_FNV1A, 0)) &&
+         flatbuffers::VectorEquals(testarrayofbools(), _o.testarrayofbools()) &&
+         flatbuffers::ScalarEquals(GetField<float>(VT_TESTF, 3.14159f), _o.GetField<float>(VT_TESTF, 3.14159f)) &&
+         flatbuffers::ScalarEquals(GetField<float>(VT_TESTF2, 3.0f), _o.GetField<float>(VT_TESTF2, 3.0f)) &&
+         flatbuffers::ScalarEquals(GetField<float>(VT_TESTF3, 0.0f), _o.GetField<float>(VT_TESTF3, 0.0f)) &&
+         flatbuffers::VectorEquals(testarrayofstring2(), _o.testarrayofstring2()) &&
+         flatbuffers::VectorEquals(testarrayofsortedstruct(), _o.testarrayofsortedstruct()) &&
+         flatbuffers::VectorEquals(flex(), _o.flex()) &&
+         flatbuffers::VectorEquals(test5(), _o.test5()) &&
+         flatbuffers::VectorEquals(vector_of_longs(), _o.vector_of_longs()) &&
+         flatbuffers::VectorEquals(vector_of_doubles(), _o.vector_of_doubles()) &&
+         flatbuffers::TableEquals(parent_namespace_test(), _o.parent_namespace_test()) &&
+         flatbuffers::VectorEquals(vector_of_referrables(), _o.vector_of_referrables()) &&
+         flatbuffers::ScalarEquals(GetField<uint64_t>(VT_SINGLE_WEAK_REFERENCE, 0), _o.GetField<uint64_t>(VT_SINGLE_WEAK_REFERENCE, 0)) &&
+         flatbuffers::VectorEquals(vector_of_weak_references(), _o.vector_of_weak_references()) &&
+         flatbuffers::VectorEquals(vector_of_strong_referrables(), _o.vector_of_strong_referrables()) &&
+         flatbuffers::ScalarEquals(GetField<uint64_t>(VT_CO_OWNING_REFERENCE, 0), _o.GetField<uint64_t>(VT_CO_OWNING_REFERENCE, 0)) &&
+         flatbuffers::VectorEquals(vector_of_co_owning_references(), _o.vector_of_co_owning_references()) &&
+         flatbuffers::ScalarEquals(GetField<uint64_t>(VT_NON_OWNING_REFERENCE, 0), _o.GetField<uint64_t>(VT_NON_OWNING_REFERENCE, 0)) &&
+         flatbuffers::VectorEquals(vector_of_non_owning_references(), _o.vector_of_non_owning_references()) &&
+         any_unique_type() == _o.any_unique_type() &&
+         EqualsAnyUniqueAliases(any_unique(), _o.any_unique(), any_unique_type()) &&
+         any_ambiguous_type() == _o.any_ambiguous_type() &&
+         EqualsAnyAmbiguousAliases(any_ambiguous(), _o.any_ambiguous(), any_ambiguous_type()) &&
+         flatbuffers::VectorEquals(vector_of_enums(), _o.vector_of_enums()) &&
+         flatbuffers::VectorEquals(vector_of_hashed_referrables(), _o.vector_of_hashed_referrables()) &&
+         flatbuffers::VectorEquals(vector_of_hashed_referrables_hash_index(), _o.vector_of_hashed_referrables_hash_index());
 }
 
 inline TypeAliasesT *TypeAliases::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
@@ -2575,14 +3331,19 @@ inline void TypeAliases::UnPackTo(TypeAliasesT *_o, const flatbuffers::resolver_
   { auto _e = u64(); _o->u64 = _e; };
   { auto _e = f32(); _o->f32 = _e; };
   { auto _e = f64(); _o->f64 = _e; };
-  { auto _e = v8(); if (_e) { _o->v8.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->v8[_i] = _e->Get(_i); } } };
-  { auto _e = vf64(); if (_e) { _o->vf64.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vf64[_i] = _e->Get(_i); } } };
+  { auto _e = v8(); if (_e) { flatbuffers::UnPackVector(*_e, &_o->v8); } else { _o->v8.clear(); } };
+  { auto _e = vf64(); if (_e) { flatbuffers::UnPackVector(*_e, &_o->vf64); } else { _o->vf64.clear(); } };
 }
 
 inline flatbuffers::Offset<TypeAliases> TypeAliases::Pack(flatbuffers::FlatBufferBuilder &_fbb, const TypeAliasesT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
   return CreateTypeAliases(_fbb, _o, _rehasher);
 }
 
+inline flatbuffers::Offset<TypeAliases> TypeAliases::Pack(flatbuffers::FlatBufferBuilder &_fbb, const TypeAliasesT &_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(_o));
+  return CreateTypeAliases(_fbb, &_o, _rehasher);
+}
+
 inline flatbuffers::Offset<TypeAliases> CreateTypeAliases(flatbuffers::FlatBufferBuilder &_fbb, const TypeAliasesT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
@@ -2615,6 +3376,63 @@ inline flatbuffers::Offset<TypeAliases> CreateTypeAliases(flatbuffers::FlatBuffe
       _vf64);
 }
 
+inline size_t GetPackedSizeUpperBound(const TypeAliasesT &_o) {
+  (void)_o;
+  size_t _size = 244;
+  _size += _o.v8.size() * 1;
+  _size += _o.vf64.size() * 8;
+  return _size;
+}
+
+inline size_t TypeAliases::Hash() const {
+  uint64_t _h = 0;
+  { auto _e = GetField<int8_t>(VT_I8, 0); if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_I8), _e); }
+  { auto _e = GetField<uint8_t>(VT_U8, 0); if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_U8), _e); }
+  { auto _e = GetField<int16_t>(VT_I16, 0); if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_I16), _e); }
+  { auto _e = GetField<uint16_t>(VT_U16, 0); if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_U16), _e); }
+  { auto _e = GetField<int32_t>(VT_I32, 0); if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_I32), _e); }
+  { auto _e = GetField<uint32_t>(VT_U32, 0); if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_U32), _e); }
+  { auto _e = GetField<int64_t>(VT_I64, 0); if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_I64), _e); }
+  { auto _e = GetField<uint64_t>(VT_U64, 0); if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_U64), _e); }
+  { auto _e = GetField<float>(VT_F32, 0.0f); if (_e != 0.0f) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_F32), _e); }
+  { auto _e = GetField<double>(VT_F64, 0.0); if (_e != 0.0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_F64), _e); }
+  { auto _e = v8(); if (_e && _e->size()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, VT_V8), *_e); }
+  { auto _e = vf64(); if (_e && _e->size()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, VT_VF64), *_e); }
+  return static_cast<size_t>(_h);
+}
+
+inline size_t TypeAliasesT::Hash() const {
+  uint64_t _h = 0;
+  { auto _e = i8; if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, TypeAliases::VT_I8), _e); }
+  { auto _e = u8; if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, TypeAliases::VT_U8), _e); }
+  { auto _e = i16; if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, TypeAliases::VT_I16), _e); }
+  { auto _e = u16; if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, TypeAliases::VT_U16), _e); }
+  { auto _e = i32; if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, TypeAliases::VT_I32), _e); }
+  { auto _e = u32; if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, TypeAliases::VT_U32), _e); }
+  { auto _e = i64; if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, TypeAliases::VT_I64), _e); }
+  { auto _e = u64; if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, TypeAliases::VT_U64), _e); }
+  { auto _e = f32; if (_e != 0.0f) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, TypeAliases::VT_F32), _e); }
+  { auto _e = f64; if (_e != 0.0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, TypeAliases::VT_F64), _e); }
+  { auto &_e = v8; if (!_e.empty()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, TypeAliases::VT_V8), _e); }
+  { auto &_e = vf64; if (!_e.empty()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, TypeAliases::VT_VF64), _e); }
+  return static_cast<size_t>(_h);
+}
+
+inline bool TypeAliases::Equals(const TypeAliases &_o) const {
+  return flatbuffers::ScalarEquals(GetField<int8_t>(VT_I8, 0), _o.GetField<int8_t>(VT_I8, 0)) &&
+         flatbuffers::ScalarEquals(GetField<uint8_t>(VT_U8, 0), _o.GetField<uint8_t>(VT_U8, 0)) &&
+         flatbuffers::ScalarEquals(GetField<int16_t>(VT_I16, 0), _o.GetField<int16_t>(VT_I16, 0)) &&
+         flatbuffers::ScalarEquals(GetField<uint16_t>(VT_U16, 0), _o.GetField<uint16_t>(VT_U16, 0)) &&
+         flatbuffers::ScalarEquals(GetField<int32_t>(VT_I32, 0), _o.GetField<int32_t>(VT_I32, 0)) &&
+         flatbuffers::ScalarEquals(GetField<uint32_t>(VT_U32, 0), _o.GetField<uint32_t>(VT_U32, 0)) &&
+         flatbuffers::ScalarEquals(GetField<int64_t>(VT_I64, 0), _o.GetField<int64_t>(VT_I64, 0)) &&
+         flatbuffers::ScalarEquals(GetField<uint64_t>(VT_U64, 0), _o.GetField<uint64_t>(VT_U64, 0)) &&
+         flatbuffers::ScalarEquals(GetField<float>(VT_F32, 0.0f), _o.GetField<float>(VT_F32, 0.0f)) &&
+         flatbuffers::ScalarEquals(GetField<double>(VT_F64, 0.0), _o.GetField<double>(VT_F64, 0.0)) &&
+         flatbuffers::VectorEquals(v8(), _o.v8()) &&
+         flatbuffers::VectorEquals(vf64(), _o.vf64());
+}
+
 inline bool VerifyAny(flatbuffers::Verifier &verifier, const void *obj, Any type) {
   switch (type) {
     case Any_NONE: {
@@ -2648,6 +3466,44 @@ inline bool VerifyAnyVector(flatbuffers::Verifier &verifier, const flatbuffers::
   return true;
 }
 
+inline size_t HashAny(const void *obj, Any type) {
+  if (!obj) return 0;
+  switch (type) {
+    case Any_Monster: {
+      auto ptr = reinterpret_cast<const Monster *>(obj);
+      return ptr->Hash();
+    }
+    case Any_TestSimpleTableWithEnum: {
+      auto ptr = reinterpret_cast<const TestSimpleTableWithEnum *>(obj);
+      return ptr->Hash();
+    }
+    case Any_MyGame_Example2_Monster: {
+      auto ptr = reinterpret_cast<const MyGame::Example2::Monster *>(obj);
+      return ptr->Hash();
+    }
+    default: return 0;
+  }
+}
+
+inline bool EqualsAny(const void *a, const void *b, Any type) {
+  if (!a || !b) return a == b;
+  switch (type) {
+    case Any_Monster: {
+      return reinterpret_cast<const Monster *>(a)
+          ->Equals(*reinterpret_cast<const Monster *>(b));
+    }
+    case Any_TestSimpleTableWithEnum: {
+      return reinterpret_cast<const TestSimpleTableWithEnum *>(a)
+          ->Equals(*reinterpret_cast<const TestSimpleTableWithEnum *>(b));
+    }
+    case Any_MyGame_Example2_Monster: {
+      return reinterpret_cast<const MyGame::Example2::Monster *>(a)
+          ->Equals(*reinterpret_cast<const MyGame::Example2::Monster *>(b));
+    }
+    default: return true;
+  }
+}
+
 inline void *AnyUnion::UnPack(const void *obj, Any type, const flatbuffers::resolver_function_t *resolver) {
   switch (type) {
     case Any_Monster: {
@@ -2666,6 +3522,32 @@ inline void *AnyUnion::UnPack(const void *obj, Any type, const flatbuffers::reso
   }
 }
 
+inline void AnyUnion::UnPackTo(const void *obj, Any _type, const flatbuffers::resolver_function_t *resolver) {
+  if (value && type == _type) {
+    switch (type) {
+      case Any_Monster: {
+        auto ptr = reinterpret_cast<const Monster *>(obj);
+        ptr->UnPackTo(reinterpret_cast<MonsterT *>(value), resolver);
+        return;
+      }
+      case Any_TestSimpleTableWithEnum: {
+        auto ptr = reinterpret_cast<const TestSimpleTableWithEnum *>(obj);
+        ptr->UnPackTo(reinterpret_cast<TestSimpleTableWithEnumT *>(value), resolver);
+        return;
+      }
+      case Any_MyGame_Example2_Monster: {
+        auto ptr = reinterpret_cast<const MyGame::Example2::Monster *>(obj);
+        ptr->UnPackTo(reinterpret_cast<MyGame::Example2::MonsterT *>(value), resolver);
+        return;
+      }
+      default: break;
+    }
+  }
+  Reset();
+  type = _type;
+  value = UnPack(obj, _type, resolver);
+}
+
 inline flatbuffers::Offset<void> AnyUnion::Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher) const {
   switch (type) {
     case Any_Monster: {
@@ -2684,6 +3566,43 @@ inline flatbuffers::Offset<void> AnyUnion::Pack(flatbuffers::FlatBufferBuilder &
   }
 }
 
+inline size_t AnyUnion::GetPackedSizeUpperBound() const {
+  switch (type) {
+    case Any_Monster: {
+      auto ptr = reinterpret_cast<const MonsterT *>(value);
+      return ::MyGame::Example::GetPackedSizeUpperBound(*ptr);
+    }
+    case Any_TestSimpleTableWithEnum: {
+      auto ptr = reinterpret_cast<const TestSimpleTableWithEnumT *>(value);
+      return ::MyGame::Example::GetPackedSizeUpperBound(*ptr);
+    }
+    case Any_MyGame_Example2_Monster: {
+      auto ptr = reinterpret_cast<const MyGame::Example2::MonsterT *>(value);
+      return ::MyGame::Example2::GetPackedSizeUpperBound(*ptr);
+    }
+    default: return 0;
+  }
+}
+
+inline size_t AnyUnion::Hash() const {
+  if (!value) return 0;
+  switch (type) {
+    case Any_Monster: {
+      auto ptr = reinterpret_cast<const MonsterT *>(value);
+      return ptr->Hash();
+    }
+    case Any_TestSimpleTableWithEnum: {
+      auto ptr = reinterpret_cast<const TestSimpleTableWithEnumT *>(value);
+      return ptr->Hash();
+    }
+    case Any_MyGame_Example2_Monster: {
+      auto ptr = reinterpret_cast<const MyGame::Example2::MonsterT *>(value);
+      return ptr->Hash();
+    }
+    default: return 0;
+  }
+}
+
 inline AnyUnion::AnyUnion(const AnyUnion &u) FLATBUFFERS_NOEXCEPT : type(u.type), value(nullptr) {
   switch (type) {
     case Any_Monster: {
@@ -2759,6 +3678,44 @@ inline bool VerifyAnyUniqueAliasesVector(flatbuffers::Verifier &verifier, const
   return true;
 }
 
+inline size_t HashAnyUniqueAliases(const void *obj, AnyUniqueAliases type) {
+  if (!obj) return 0;
+  switch (type) {
+    case AnyUniqueAliases_M: {
+      auto ptr = reinterpret_cast<const Monster *>(obj);
+      return ptr->Hash();
+    }
+    case AnyUniqueAliases_T: {
+      auto ptr = reinterpret_cast<const TestSimpleTableWithEnum *>(obj);
+      return ptr->Hash();
+    }
+    case AnyUniqueAliases_M2: {
+      auto ptr = reinterpret_cast<const MyGame::Example2::Monster *>(obj);
+      return ptr->Hash();
+    }
+    default: return 0;
+  }
+}
+
+inline bool EqualsAnyUniqueAliases(const void *a, const void *b, AnyUniqueAliases type) {
+  if (!a || !b) return a == b;
+  switch (type) {
+    case AnyUniqueAliases_M: {
+      return reinterpret_cast<const Monster *>(a)
+          ->Equals(*reinterpret_cast<const Monster *>(b));
+    }
+    case AnyUniqueAliases_T: {
+      return reinterpret_cast<const TestSimpleTableWithEnum *>(a)
+          ->Equals(*reinterpret_cast<const TestSimpleTableWithEnum *>(b));
+    }
+    case AnyUniqueAliases_M2: {
+      return reinterpret_cast<const MyGame::Example2::Monster *>(a)
+          ->Equals(*reinterpret_cast<const MyGame::Example2::Monster *>(b));
+    }
+    default: return true;
+  }
+}
+
 inline void *AnyUniqueAliasesUnion::UnPack(const void *obj, AnyUniqueAliases type, const flatbuffers::resolver_function_t *resolver) {
   switch (type) {
     case AnyUniqueAliases_M: {
@@ -2777,6 +3734,32 @@ inline void *AnyUniqueAliasesUnion::UnPack(const void *obj, AnyUniqueAliases typ
   }
 }
 
+inline void AnyUniqueAliasesUnion::UnPackTo(const void *obj, AnyUniqueAliases _type, const flatbuffers::resolver_function_t *resolver) {
+  if (value && type == _type) {
+    switch (type) {
+      case AnyUniqueAliases_M: {
+        auto ptr = reinterpret_cast<const Monster *>(obj);
+        ptr->UnPackTo(reinterpret_cast<MonsterT *>(value), resolver);
+        return;
+      }
+      case AnyUniqueAliases_T: {
+        auto ptr = reinterpret_cast<const TestSimpleTableWithEnum *>(obj);
+        ptr->UnPackTo(reinterpret_cast<TestSimpleTableWithEnumT *>(value), resolver);
+        return;
+      }
+      case AnyUniqueAliases_M2: {
+        auto ptr = reinterpret_cast<const MyGame::Example2::Monster *>(obj);
+        ptr->UnPackTo(reinterpret_cast<MyGame::Example2::MonsterT *>(value), resolver);
+        return;
+      }
+      default: break;
+    }
+  }
+  Reset();
+  type = _type;
+  value = UnPack(obj, _type, resolver);
+}
+
 inline flatbuffers::Offset<void> AnyUniqueAliasesUnion::Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher) const {
   switch (type) {
     case AnyUniqueAliases_M: {
@@ -2795,6 +3778,43 @@ inline flatbuffers::Offset<void> AnyUniqueAliasesUnion::Pack(flatbuffers::FlatBu
   }
 }
 
+inline size_t AnyUniqueAliasesUnion::GetPackedSizeUpperBound() const {
+  switch (type) {
+    case AnyUniqueAliases_M: {
+      auto ptr = reinterpret_cast<const MonsterT *>(value);
+      return ::MyGame::Example::GetPackedSizeUpperBound(*ptr);
+    }
+    case AnyUniqueAliases_T: {
+      auto ptr = reinterpret_cast<const TestSimpleTableWithEnumT *>(value);
+      return ::MyGame::Example::GetPackedSizeUpperBound(*ptr);
+    }
+    case AnyUniqueAliases_M2: {
+      auto ptr = reinterpret_cast<const MyGame::Example2::MonsterT *>(value);
+      return ::MyGame::Example2::GetPackedSizeUpperBound(*ptr);
+    }
+    default: return 0;
+  }
+}
+
+inline size_t AnyUniqueAliasesUnion::Hash() const {
+  if (!value) return 0;
+  switch (type) {
+    case AnyUniqueAliases_M: {
+      auto ptr = reinterpret_cast<const MonsterT *>(value);
+      return ptr->Hash();
+    }
+    case AnyUniqueAliases_T: {
+      auto ptr = reinterpret_cast<const TestSimpleTableWithEnumT *>(value);
+      return ptr->Hash();
+    }
+    case AnyUniqueAliases_M2: {
+      auto ptr = reinterpret_cast<const MyGame::Example2::MonsterT *>(value);
+      return ptr->Hash();
+    }
+    default: return 0;
+  }
+}
+
 inline AnyUniqueAliasesUnion::AnyUniqueAliasesUnion(const AnyUniqueAliasesUnion &u) FLATBUFFERS_NOEXCEPT : type(u.type), value(nullptr) {
   switch (type) {
     case AnyUniqueAliases_M: {
@@ -2870,6 +3890,44 @@ inline bool VerifyAnyAmbiguousAliasesVector(flatbuffers::Verifier &verifier, con
   return true;
 }
 
+inline size_t HashAnyAmbiguousAliases(const void *obj, AnyAmbiguousAliases type) {
+  if (!obj) return 0;
+  switch (type) {
+    case AnyAmbiguousAliases_M1: {
+      auto ptr = reinterpret_cast<const Monster *>(obj);
+      return ptr->Hash();
+    }
+    case AnyAmbiguousAliases_M2: {
+      auto ptr = reinterpret_cast<const Monster *>(obj);
+      return ptr->Hash();
+    }
+    case AnyAmbiguousAliases_M3: {
+      auto ptr = reinterpret_cast<const Monster *>(obj);
+      return ptr->Hash();
+    }
+    default: return 0;
+  }
+}
+
+inline bool EqualsAnyAmbiguousAliases(const void *a, const void *b, AnyAmbiguousAliases type) {
+  if (!a || !b) return a == b;
+  switch (type) {
+    case AnyAmbiguousAliases_M1: {
+      return reinterpret_cast<const Monster *>(a)
+          ->Equals(*reinterpret_cast<const Monster *>(b));
+    }
+    case AnyAmbiguousAliases_M2: {
+      return reinterpret_cast<const Monster *>(a)
+          ->Equals(*reinterpret_cast<const Monster *>(b));
+    }
+    case AnyAmbiguousAliases_M3: {
+      return reinterpret_cast<const Monster *>(a)
+          ->Equals(*reinterpret_cast<const Monster *>(b));
+    }
+    default: return true;
+  }
+}
+
 inline void *AnyAmbiguousAliasesUnion::UnPack(const void *obj, AnyAmbiguousAliases type, const flatbuffers::resolver_function_t *resolver) {
   switch (type) {
     case AnyAmbiguousAliases_M1: {
@@ -2888,6 +3946,32 @@ inline void *AnyAmbiguousAliasesUnion::UnPack(const void *obj, AnyAmbiguousAlias
   }
 }
 
+inline void AnyAmbiguousAliasesUnion::UnPackTo(const void *obj, AnyAmbiguousAliases _type, const flatbuffers::resolver_function_t *resolver) {
+  if (value && type == _type) {
+    switch (type) {
+      case AnyAmbiguousAliases_M1: {
+        auto ptr = reinterpret_cast<const Monster *>(obj);
+        ptr->UnPackTo(reinterpret_cast<MonsterT *>(value), resolver);
+        return;
+      }
+      case AnyAmbiguousAliases_M2: {
+        auto ptr = reinterpret_cast<const Monster *>(obj);
+        ptr->UnPackTo(reinterpret_cast<MonsterT *>(value), resolver);
+        return;
+      }
+      case AnyAmbiguousAliases_M3: {
+        auto ptr = reinterpret_cast<const Monster *>(obj);
+        ptr->UnPackTo(reinterpret_cast<MonsterT *>(value), resolver);
+        return;
+      }
+      default: break;
+    }
+  }
+  Reset();
+  type = _type;
+  value = UnPack(obj, _type, resolver);
+}
+
 inline flatbuffers::Offset<void> AnyAmbiguousAliasesUnion::Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher) const {
   switch (type) {
     case AnyAmbiguousAliases_M1: {
@@ -2906,6 +3990,43 @@ inline flatbuffers::Offset<void> AnyAmbiguousAliasesUnion::Pack(flatbuffers::Fla
   }
 }
 
+inline size_t AnyAmbiguousAliasesUnion::GetPackedSizeUpperBound() const {
+  switch (type) {
+    case AnyAmbiguousAliases_M1: {
+      auto ptr = reinterpret_cast<const MonsterT *>(value);
+      return ::MyGame::Example::GetPackedSizeUpperBound(*ptr);
+    }
+    case AnyAmbiguousAliases_M2: {
+      auto ptr = reinterpret_cast<const MonsterT *>(value);
+      return ::MyGame::Example::GetPackedSizeUpperBound(*ptr);
+    }
+    case AnyAmbiguousAliases_M3: {
+      auto ptr = reinterpret_cast<const MonsterT *>(value);
+      return ::MyGame::Example::GetPackedSizeUpperBound(*ptr);
+    }
+    default: return 0;
+  }
+}
+
+inline size_t AnyAmbiguousAliasesUnion::Hash() const {
+  if (!value) return 0;
+  switch (type) {
+    case AnyAmbiguousAliases_M1: {
+      auto ptr = reinterpret_cast<const MonsterT *>(value);
+      return ptr->Hash();
+    }
+    case AnyAmbiguousAliases_M2: {
+      auto ptr = reinterpret_cast<const MonsterT *>(value);
+      return ptr->Hash();
+    }
+    case AnyAmbiguousAliases_M3: {
+      auto ptr = reinterpret_cast<const MonsterT *>(value);
+      return ptr->Hash();
+    }
+    default: return 0;
+  }
+}
+
 inline AnyAmbiguousAliasesUnion::AnyAmbiguousAliasesUnion(const AnyAmbiguousAliasesUnion &u) FLATBUFFERS_NOEXCEPT : type(u.type), value(nullptr) {
   switch (type) {
     case AnyAmbiguousAliases_M1: {
@@ -3216,7 +4337,9 @@ inline const flatbuffers::TypeTable *MonsterTypeTable() {
     { flatbuffers::ET_SEQUENCE, 0, 9 },
     { flatbuffers::ET_UTYPE, 0, 10 },
     { flatbuffers::ET_SEQUENCE, 0, 10 },
-    { flatbuffers::ET_CHAR, 1, 1 }
+    { flatbuffers::ET_CHAR, 1, 1 },
+    { flatbuffers::ET_SEQUENCE, 1, 8 },
+    { flatbuffers::ET_UINT, 1, -1 }
   };
   static const flatbuffers::TypeFunction type_refs[] = {
     Vec3TypeTable,
@@ -3279,10 +4402,12 @@ inline const flatbuffers::TypeTable *MonsterTypeTable() {
     "any_unique",
     "any_ambiguous_type",
     "any_ambiguous",
-    "vector_of_enums"
+    "vector_of_enums",
+    "vector_of_hashed_referrables",
+    "vector_of_hashed_referrables_hash_index"
   };
   static const flatbuffers::TypeTable tt = {
-    flatbuffers::ST_TABLE, 48, type_codes, type_refs, nullptr, names
+    flatbuffers::ST_TABLE, 50, type_codes, type_refs, nullptr, names
   };
   return &tt;
 }
@@ -3378,4 +4503,50 @@ inline flatbuffers::unique_ptr<MonsterT> UnPackMonster(
 }  // namespace Example
 }  // namespace MyGame
 
+namespace std {
+
+template<> struct hash<MyGame::InParentNamespaceT> {
+  size_t operator()(const MyGame::InParentNamespaceT &_o) const {
+    return _o.Hash();
+  }
+};
+
+template<> struct hash<MyGame::Example2::MonsterT> {
+  size_t operator()(const MyGame::Example2::MonsterT &_o) const {
+    return _o.Hash();
+  }
+};
+
+template<> struct hash<MyGame::Example::TestSimpleTableWithEnumT> {
+  size_t operator()(const MyGame::Example::TestSimpleTableWithEnumT &_o) const {
+    return _o.Hash();
+  }
+};
+
+template<> struct hash<MyGame::Example::StatT> {
+  size_t operator()(const MyGame::Example::StatT &_o) const {
+    return _o.Hash();
+  }
+};
+
+template<> struct hash<MyGame::Example::ReferrableT> {
+  size_t operator()(const MyGame::Example::ReferrableT &_o) const {
+    return _o.Hash();
+  }
+};
+
+template<> struct hash<MyGame::Example::MonsterT> {
+  size_t operator()(const MyGame::Example::MonsterT &_o) const {
+    return _o.Hash();
+  }
+};
+
+template<> struct hash<MyGame::Example::TypeAliasesT> {
+  size_t operator()(const MyGame::Example::TypeAliasesT &_o) const {
+    return _o.Hash();
+  }
+};
+
+}  // namespace std
+
 #endif  // FLATBUFFERS_GENERATED_MONSTERTEST_MYGAME_EXAMPLE_H_
@@ -753,10 +753,12 @@ class Monster {
     }
   }
   List<Color> get vectorOfEnums => const fb.ListReader<Color>(Color.reader).vTableGet(_bc, _bcOffset, 98, null);
+  List<Referrable> get vectorOfHashedReferrables => const fb.ListReader<Referrable>(Referrable.reader).vTableGet(_bc, _bcOffset, 100, null);
+  List<int> get vectorOfHashedReferrablesHashIndex => const fb.ListReader<int>(const fb.Uint32Reader()).vTableGet(_bc, _bcOffset, 102, null);
 
   @override
   String toString() {
-    return 'Monster{pos: $pos, mana: $mana, hp: $hp, name: $name, inventory: $inventory, color: $color, testType: $testType, test: $test, test4: $test4, testarrayofstring: $testarrayofstring, testarrayoftables: $testarrayoftables, enemy: $enemy, testnestedflatbuffer: $testnestedflatbuffer, testempty: $testempty, testbool: $testbool, testhashs32Fnv1: $testhashs32Fnv1, testhashu32Fnv1: $testhashu32Fnv1, testhashs64Fnv1: $testhashs64Fnv1, testhashu64Fnv1: $testhashu64Fnv1, testhashs32Fnv1a: $testhashs32Fnv1a, testhashu32Fnv1a: $testhashu32Fnv1a, testhashs64Fnv1a: $testhashs64Fnv1a, testhashu64Fnv1a: $testhashu64Fnv1a, testarrayofbools: $testarrayofbools, testf: $testf, testf2: $testf2, testf3: $testf3, testarrayofstring2: $testarrayofstring2, testarrayofsortedstruct: $testarrayofsortedstruct, flex: $flex, test5: $test5, vectorOfLongs: $vectorOfLongs, vectorOfDoubles: $vectorOfDoubles, parentNamespaceTest: $parentNamespaceTest, vectorOfReferrables: $vectorOfReferrables, singleWeakReference: $singleWeakReference, vectorOfWeakReferences: $vectorOfWeakReferences, vectorOfStrongReferrables: $vectorOfStrongReferrables, coOwningReference: $coOwningReference, vectorOfCoOwningReferences: $vectorOfCoOwningReferences, nonOwningReference: $nonOwningReference, vectorOfNonOwningReferences: $vectorOfNonOwningReferences, anyUniqueType: $anyUniqueType, anyUnique: $anyUnique, anyAmbiguousType: $anyAmbiguousType, anyAmbiguous: $anyAmbiguous, vectorOfEnums: $vectorOfEnums}';
+    return 'Monster{pos: $pos, mana: $mana, hp: $hp, name: $name, inventory: $inventory, color: $color, testType: $testType, test: $test, test4: $test4, testarrayofstring: $testarrayofstring, testarrayoftables: $testarrayoftables, enemy: $enemy, testnestedflatbuffer: $testnestedflatbuffer, testempty: $testempty, testbool: $testbool, testhashs32Fnv1: $testhashs32Fnv1, testhashu32Fnv1: $testhashu32Fnv1, testhashs64Fnv1: $testhashs64Fnv1, testhashu64Fnv1: $testhashu64Fnv1, testhashs32Fnv1a: $testhashs32Fnv1a, testhashu32Fnv1a: $testhashu32Fnv1a, testhashs64Fnv1a: $testhashs64Fnv1a, testhashu64Fnv1a: $testhashu64Fnv1a, testarrayofbools: $testarrayofbools, testf: $testf, testf2: $testf2, testf3: $testf3, testarrayofstring2: $testarrayofstring2, testarrayofsortedstruct: $testarrayofsortedstruct, flex: $flex, test5: $test5, vectorOfLongs: $vectorOfLongs, vectorOfDoubles: $vectorOfDoubles, parentNamespaceTest: $parentNamespaceTest, vectorOfReferrables: $vectorOfReferrables, singleWeakReference: $singleWeakReference, vectorOfWeakReferences: $vectorOfWeakReferences, vectorOfStrongReferrables: $vectorOfStrongReferrables, coOwningReference: $coOwningReference, vectorOfCoOwningReferences: $vectorOfCoOwningReferences, nonOwningReference: $nonOwningReference, vectorOfNonOwningReferences: $vectorOfNonOwningReferences, anyUniqueType: $anyUniqueType, anyUnique: $anyUnique, anyAmbiguousType: $anyAmbiguousType, anyAmbiguous: $anyAmbiguous, vectorOfEnums: $vectorOfEnums, vectorOfHashedReferrables: $vectorOfHashedReferrables, vectorOfHashedReferrablesHashIndex: $vectorOfHashedReferrablesHashIndex}';
   }
 }
 
@@ -967,6 +969,14 @@ class MonsterBuilder {
     fbBuilder.addOffset(47, offset);
     return fbBuilder.offset;
   }
+  int addVectorOfHashedReferrablesOffset(int offset) {
+    fbBuilder.addOffset(48, offset);
+    return fbBuilder.offset;
+  }
+  int addVectorOfHashedReferrablesHashIndexOffset(int offset) {
+    fbBuilder.addOffset(49, offset);
+    return fbBuilder.offset;
+  }
 
   int finish() {
     return fbBuilder.endTable();
@@ -1021,6 +1031,8 @@ class MonsterObjectBuilder extends fb.ObjectBuilder {
   final AnyAmbiguousAliasesTypeId _anyAmbiguousType;
   final dynamic _anyAmbiguous;
   final List<Color> _vectorOfEnums;
+  final List<ReferrableObjectBuilder> _vectorOfHashedReferrables;
+  final List<int> _vectorOfHashedReferrablesHashIndex;
 
   MonsterObjectBuilder({
     Vec3ObjectBuilder pos,
@@ -1070,6 +1082,8 @@ class MonsterObjectBuilder extends fb.ObjectBuilder {
     AnyAmbiguousAliasesTypeId anyAmbiguousType,
     dynamic anyAmbiguous,
     List<Color> vectorOfEnums,
+    List<ReferrableObjectBuilder> vectorOfHashedReferrables,
+    List<int> vectorOfHashedReferrablesHashIndex,
   })
       : _pos = pos,
         _mana = mana,
@@ -1117,7 +1131,9 @@ class MonsterObjectBuilder extends fb.ObjectBuilder {
         _anyUnique = anyUnique,
         _anyAmbiguousType = anyAmbiguousType,
         _anyAmbiguous = anyAmbiguous,
-        _vectorOfEnums = vectorOfEnums;
+        _vectorOfEnums = vectorOfEnums,
+        _vectorOfHashedReferrables = vectorOfHashedReferrables,
+        _vectorOfHashedReferrablesHashIndex = vectorOfHashedReferrablesHashIndex;
 
   /// Finish building, and store into the [fbBuilder].
   @override
@@ -1185,6 +1201,12 @@ class MonsterObjectBuilder extends fb.ObjectBuilder {
     final int vectorOfEnumsOffset = _vectorOfEnums?.isNotEmpty == true
         ? fbBuilder.writeListInt8(_vectorOfEnums.map((f) => f.value))
         : null;
+    final int vectorOfHashedReferrablesOffset = _vectorOfHashedReferrables?.isNotEmpty == true
+        ? fbBuilder.writeList(_vectorOfHashedReferrables.map((b) => b.getOrCreateOffset(fbBuilder)).toList())
+        : null;
+    final int vectorOfHashedReferrablesHashIndexOffset = _vectorOfHashedReferrablesHashIndex?.isNotEmpty == true
+        ? fbBuilder.writeListUint32(_vectorOfHashedReferrablesHashIndex)
+        : null;
 
     fbBuilder.startTable();
     if (_pos != null) {
@@ -1286,6 +1308,12 @@ class MonsterObjectBuilder extends fb.ObjectBuilder {
     if (vectorOfEnumsOffset != null) {
       fbBuilder.addOffset(47, vectorOfEnumsOffset);
     }
+    if (vectorOfHashedReferrablesOffset != null) {
+      fbBuilder.addOffset(48, vectorOfHashedReferrablesOffset);
+    }
+    if (vectorOfHashedReferrablesHashIndexOffset != null) {
+      fbBuilder.addOffset(49, vectorOfHashedReferrablesHashIndexOffset);
+    }
     return fbBuilder.endTable();
   }
 
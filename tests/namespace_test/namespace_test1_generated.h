@@ -91,6 +91,9 @@ struct TableInNestedNS FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   bool mutate_foo(int32_t _foo) {
     return SetField<int32_t>(VT_FOO, _foo, 0);
   }
+  flatbuffers::FieldPresence<1> PresenceMask() const {
+    return flatbuffers::FieldPresence<1>(this);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<int32_t>(verifier, VT_FOO) &&
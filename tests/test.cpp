@@ -14,9 +14,12 @@
  * limitations under the License.
  */
 #include <cmath>
+#include <sstream>
+#include "flatbuffers/arena.h"
 #include "flatbuffers/flatbuffers.h"
 #include "flatbuffers/idl.h"
 #include "flatbuffers/minireflect.h"
+#include "flatbuffers/record_stream.h"
 #include "flatbuffers/registry.h"
 #include "flatbuffers/util.h"
 
@@ -29,10 +32,24 @@
 #endif
 // clang-format on
 
+// The cpp_str_type of strings in cpp_types_test.fbs.
+struct TestString {
+  TestString() {}
+  TestString(const std::string &s) : str(s) {}
+  const char *c_str() const { return str.c_str(); }
+  size_t length() const { return str.length(); }
+  bool empty() const { return str.empty(); }
+  bool operator==(const TestString &o) const { return str == o.str; }
+  std::string str;
+};
+
+#include "arena_test_generated.h"
+#include "cpp_types_test_generated.h"
 #include "monster_test_generated.h"
 #include "namespace_test/namespace_test1_generated.h"
 #include "namespace_test/namespace_test2_generated.h"
 #include "union_vector/union_vector_generated.h"
+#include "views_test_generated.h"
 #include "test_assert.h"
 
 #include "flatbuffers/flexbuffers.h"
@@ -52,6 +69,18 @@ void lcg_reset() { lcg_seed = 48271; }
 
 std::string test_data_path = "tests/";
 
+// Count heap allocations, for tests that check there are none.
+size_t heap_allocations = 0;
+
+void *operator new(size_t size) {
+  heap_allocations++;
+  auto p = malloc(size ? size : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void *p) FLATBUFFERS_NOEXCEPT { free(p); }
+
 // example of how to build up a serialized buffer algorithmically:
 flatbuffers::DetachedBuffer CreateFlatBufferTest(std::string &buffer) {
   flatbuffers::FlatBufferBuilder builder;
@@ -413,6 +442,57 @@ void MutateFlatBuffersTest(uint8_t *flatbuf, std::size_t length) {
   AccessFlatBufferTest(flatbuf, length);
 }
 
+// Read tables through a cache of their decoded vtables.
+void VTableCacheTest(const uint8_t *flatbuf) {
+  auto monster = GetMonster(flatbuf);
+  auto monsters = monster->testarrayoftables();
+  flatbuffers::VTableCache cache;
+  std::vector<const uint8_t *> vtables;
+  for (auto it = monsters->begin(); it != monsters->end(); ++it) {
+    cache.Bind(*it);
+    TEST_EQ(cache.GetField<int16_t>(Monster::VT_HP, 100), it->hp());
+    TEST_EQ(cache.GetPointer<const flatbuffers::String *>(Monster::VT_NAME),
+            it->name());
+    TEST_EQ(cache.CheckField(Monster::VT_POS), false);
+    TEST_EQ(cache.GetOptionalFieldOffset(Monster::VT_TESTARRAYOFBOOLS), 0);
+    vtables.push_back(cache.GetVTable());
+  }
+  // Fred and Wilma only have a name, so they share a vtable.
+  TEST_EQ(vtables.size(), 3);
+  TEST_EQ(vtables[1] == vtables[2], true);
+  TEST_EQ(vtables[0] != vtables[1], true);
+
+  cache.Bind(monster);
+  auto pos = cache.GetStruct<const Vec3 *>(Monster::VT_POS);
+  TEST_NOTNULL(pos);
+  TEST_EQ(pos->z(), 3);
+  TEST_EQ_STR(
+      cache.GetPointer<const flatbuffers::String *>(Monster::VT_NAME)->c_str(),
+      "MyMonster");
+
+  // Another buffer read into the same memory may have a different vtable at
+  // the same address, which Reset makes the cache decode again.
+  std::vector<uint8_t> buf;
+  for (int with_hp = 1; with_hp >= 0; with_hp--) {
+    flatbuffers::FlatBufferBuilder fbb;
+    auto name = fbb.CreateString("Reused");
+    MonsterBuilder mb(fbb);
+    mb.add_name(name);
+    if (with_hp) {
+      mb.add_hp(7);
+    } else {
+      mb.add_mana(7);
+    }
+    FinishMonsterBuffer(fbb, mb.Finish());
+    if (!with_hp) TEST_EQ(fbb.GetSize(), buf.size());
+    buf.assign(fbb.GetBufferPointer(), fbb.GetBufferPointer() + fbb.GetSize());
+    cache.Reset();
+    cache.Bind(GetMonster(flatbuffers::vector_data(buf)));
+    TEST_EQ(cache.GetField<int16_t>(Monster::VT_HP, 100), with_hp ? 7 : 100);
+    TEST_EQ(cache.GetField<int16_t>(Monster::VT_MANA, 150), with_hp ? 150 : 7);
+  }
+}
+
 // Unpack a FlatBuffer into objects.
 void ObjectFlatBuffersTest(uint8_t *flatbuf) {
   // Optional: we can specify resolver and rehasher functions to turn hashed
@@ -498,6 +578,424 @@ void ObjectFlatBuffersTest(uint8_t *flatbuf) {
   TEST_EQ(tests[0].b(), 20);
   TEST_EQ(tests[1].a(), 30);
   TEST_EQ(tests[1].b(), 40);
+
+  // Unpacking into an existing object reuses the objects it owns.
+  auto pos_ptr = pos.get();
+  auto table_ptr = vecoftables[1].get();
+  GetMonster(fbb1.GetBufferPointer())->UnPackTo(monster2.get(), &resolver);
+  TEST_EQ(pos.get() == pos_ptr, true);
+  TEST_EQ(vecoftables[1].get() == table_ptr, true);
+  TEST_EQ(monster2->test.AsMonster() == monster3, true);
+  TEST_EQ_STR(vecoftables[1]->name.c_str(), "Fred");
+  TEST_EQ_STR(monster3->name.c_str(), "Fred");
+
+  // And resets the fields missing from the buffer.
+  flatbuffers::FlatBufferBuilder fbb3;
+  fbb3.Finish(CreateMonster(fbb3, nullptr, 0, 100, fbb3.CreateString("Min")));
+  GetMonster(fbb3.GetBufferPointer())->UnPackTo(monster2.get(), &resolver);
+  TEST_EQ_STR(monster2->name.c_str(), "Min");
+  TEST_EQ(monster2->hp, 100);
+  TEST_EQ(monster2->pos.get() == nullptr, true);
+  TEST_EQ(monster2->inventory.size(), 0);
+  TEST_EQ(monster2->testarrayoftables.size(), 0);
+  TEST_EQ(monster2->test.type, Any_NONE);
+}
+
+// Counts the memory a FlatBufferBuilder allocates.
+class CountingAllocator : public flatbuffers::DefaultAllocator {
+ public:
+  CountingAllocator() : allocations(0) {}
+  uint8_t *allocate(size_t size) FLATBUFFERS_OVERRIDE {
+    allocations++;
+    return flatbuffers::DefaultAllocator::allocate(size);
+  }
+  size_t allocations;
+};
+
+void PackedSizeUpperBoundTest(uint8_t *flatbuf) {
+  auto monster = UnPackMonster(flatbuf);
+  auto bound = GetPackedSizeUpperBound(*monster);
+
+  // Packing into a builder that starts out too small to hold the monster
+  // makes it grow repeatedly, unless the space is reserved up front. (The
+  // buffers are aligned for Vec3, whatever size they grow to.)
+  CountingAllocator grown_allocator;
+  flatbuffers::FlatBufferBuilder grown(1, &grown_allocator, false,
+                                       FLATBUFFERS_MAX_ALIGNMENT);
+  grown.Finish(Monster::Pack(grown, monster.get()), MonsterIdentifier());
+  TEST_EQ(grown_allocator.allocations > 1, true);
+
+  CountingAllocator reserved_allocator;
+  flatbuffers::FlatBufferBuilder reserved(1, &reserved_allocator, false,
+                                          FLATBUFFERS_MAX_ALIGNMENT);
+  reserved.Finish(Monster::Pack(reserved, *monster), MonsterIdentifier());
+  TEST_EQ(reserved_allocator.allocations, 1);
+  TEST_EQ(reserved.GetSize() <= bound, true);
+  TEST_EQ(reserved.GetSize(), grown.GetSize());
+  TEST_EQ(memcmp(reserved.GetBufferPointer(), grown.GetBufferPointer(),
+                 grown.GetSize()),
+          0);
+}
+
+void PresenceMaskTest(uint8_t *flatbuf) {
+  auto monster = GetMonster(flatbuf);
+  auto table = reinterpret_cast<const flatbuffers::Table *>(monster);
+  auto mask = monster->PresenceMask();
+  size_t present = 0;
+  for (size_t id = 0; id < mask.size(); id++) {
+    auto field = flatbuffers::FieldIndexToOffset(
+        static_cast<flatbuffers::voffset_t>(id));
+    TEST_EQ(mask.Test(id), table->CheckField(field));
+    TEST_EQ(mask.CheckField(field), table->CheckField(field));
+    present += mask.Test(id);
+  }
+  TEST_EQ(mask.count(), present);
+  TEST_EQ(mask.CheckField(Monster::VT_NAME), true);
+  TEST_EQ(mask.CheckField(Monster::VT_TESTF3), false);
+  size_t visited = 0;
+  for (auto id = mask.Next(0); id < mask.size(); id = mask.Next(id + 1)) {
+    TEST_EQ(mask.Test(id), true);
+    visited++;
+  }
+  TEST_EQ(visited, present);
+
+  // Vtables end at the last present field, which also covers data written
+  // with an older schema that has fewer fields.
+  flatbuffers::FlatBufferBuilder fbb;
+  auto id = fbb.CreateString("Stat");
+  fbb.Finish(CreateStat(fbb, id));
+  auto stat_mask =
+      flatbuffers::GetRoot<Stat>(fbb.GetBufferPointer())->PresenceMask();
+  TEST_EQ(stat_mask.size(), 3U);
+  TEST_EQ(stat_mask.count(), 1U);
+  TEST_EQ(stat_mask.CheckField(Stat::VT_ID), true);
+  TEST_EQ(stat_mask.CheckField(Stat::VT_COUNT), false);
+  TEST_EQ(stat_mask.Next(1), stat_mask.size());
+}
+
+void HashTest(uint8_t *flatbuf) {
+  auto monster = GetMonster(flatbuf);
+  TEST_EQ(monster->Equals(*monster), true);
+
+  // A native table hashes like the table it was unpacked from, and like the
+  // table it packs to, which is laid out differently but equal.
+  auto native = UnPackMonster(flatbuf);
+  TEST_EQ(std::hash<MonsterT>()(*native), monster->Hash());
+  flatbuffers::FlatBufferBuilder fbb(1024, nullptr, false,
+                                     FLATBUFFERS_MAX_ALIGNMENT);
+  fbb.Finish(Monster::Pack(fbb, native.get()), MonsterIdentifier());
+  auto repacked = GetMonster(fbb.GetBufferPointer());
+  TEST_EQ(repacked->Equals(*monster), true);
+  TEST_EQ(repacked->Hash(), monster->Hash());
+
+  // Any difference makes them unequal, including in nested tables.
+  native->testarrayoftables[1]->hp = 1;
+  flatbuffers::FlatBufferBuilder fbb2(1024, nullptr, false,
+                                      FLATBUFFERS_MAX_ALIGNMENT);
+  fbb2.Finish(Monster::Pack(fbb2, native.get()), MonsterIdentifier());
+  auto changed = GetMonster(fbb2.GetBufferPointer());
+  TEST_EQ(changed->Equals(*monster), false);
+  TEST_EQ(changed->Hash() != monster->Hash(), true);
+  TEST_EQ(std::hash<MonsterT>()(*native), changed->Hash());
+
+  // Absent fields are the same as default ones, and absent vectors the same
+  // as empty ones.
+  flatbuffers::FlatBufferBuilder fbb3;
+  fbb3.Finish(CreateMonster(fbb3, nullptr, 150, 80, fbb3.CreateString("Min")));
+  flatbuffers::FlatBufferBuilder fbb4;
+  fbb4.ForceDefaults(true);
+  fbb4.Finish(CreateMonster(fbb4, nullptr, 150, 80, fbb4.CreateString("Min"),
+                            fbb4.CreateVector(std::vector<uint8_t>())));
+  TEST_EQ(fbb3.GetSize() < fbb4.GetSize(), true);
+  auto min = GetMonster(fbb3.GetBufferPointer());
+  auto min_defaults = GetMonster(fbb4.GetBufferPointer());
+  TEST_EQ(min->Equals(*min_defaults), true);
+  TEST_EQ(min->Hash(), min_defaults->Hash());
+  TEST_EQ(min->Equals(*monster), false);
+}
+
+// Referrable as generated by a flatc that didn't generate GetKey().
+struct LegacyReferrable FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  uint64_t id() const { return GetField<uint64_t>(Referrable::VT_ID, 0); }
+  bool KeyCompareLessThan(const LegacyReferrable *o) const {
+    return id() < o->id();
+  }
+  int KeyCompareWithValue(uint64_t val) const {
+    return static_cast<int>(id() > val) - static_cast<int>(id() < val);
+  }
+};
+
+void LookupByKeyTest() {
+  static_assert(std::is_same<flatbuffers::KeyTypeOf<Referrable>::type,
+                             uint64_t>::value,
+                "Referrable has an integer key");
+  static_assert(std::is_same<flatbuffers::KeyTypeOf<LegacyReferrable>::type,
+                             void>::value,
+                "LegacyReferrable has no key type");
+
+  // Integer keys that are evenly spread (which are found by interpolation),
+  // or not (which falls back to binary search), or so large that they're
+  // closer together than doubles can tell apart.
+  for (int spread = 0; spread < 3; spread++) {
+    flatbuffers::FlatBufferBuilder fbb;
+    std::vector<uint64_t> ids;
+    std::vector<flatbuffers::Offset<Referrable>> referrables;
+    for (uint64_t i = 0; i < 1000; i++) {
+      ids.push_back(spread == 0 ? i * 3
+                                : spread == 1 ? i * i * i : (1ULL << 60) + i);
+      referrables.push_back(CreateReferrable(fbb, ids.back()));
+    }
+    auto vec = fbb.CreateVectorOfSortedTables(&referrables);
+    auto name = fbb.CreateString("Dictionary");
+    MonsterBuilder mb(fbb);
+    mb.add_name(name);
+    mb.add_vector_of_referrables(vec);
+    fbb.Finish(mb.Finish());
+    auto dictionary =
+        GetMonster(fbb.GetBufferPointer())->vector_of_referrables();
+
+    std::vector<uint64_t> keys;
+    for (auto it = ids.begin(); it != ids.end(); ++it) {
+      keys.push_back(*it);
+      keys.push_back(*it + 1);
+    }
+    keys.push_back(ids.back() + 1000);
+    std::vector<const Referrable *> found(keys.size());
+    dictionary->LookupByKeys(keys.data(), keys.size(), found.data());
+    for (size_t i = 0; i < keys.size(); i++) {
+      auto present = std::binary_search(ids.begin(), ids.end(), keys[i]);
+      auto referrable = dictionary->LookupByKey(keys[i]);
+      TEST_EQ(referrable != nullptr, present);
+      TEST_EQ(found[i], referrable);
+      if (present) TEST_EQ(referrable->id(), keys[i]);
+    }
+
+    // Without a GetKey(), this is a plain binary search.
+    auto legacy = reinterpret_cast<
+        const flatbuffers::Vector<flatbuffers::Offset<LegacyReferrable>> *>(
+        dictionary);
+    for (size_t i = 0; i < keys.size(); i++) {
+      TEST_EQ(reinterpret_cast<const void *>(legacy->LookupByKey(keys[i])),
+              reinterpret_cast<const void *>(dictionary->LookupByKey(keys[i])));
+    }
+    TEST_EQ(reinterpret_cast<const void *>(
+                legacy->LookupByKeyHashed(keys[1], nullptr)),
+            reinterpret_cast<const void *>(dictionary->LookupByKey(keys[1])));
+  }
+
+  // String keys.
+  flatbuffers::FlatBufferBuilder fbb;
+  const char *names[] = { "Wilma", "Barney", "Fred" };
+  flatbuffers::Offset<Monster> monsters[3];
+  for (int i = 0; i < 3; i++) {
+    auto name = fbb.CreateString(names[i]);
+    monsters[i] = CreateMonster(fbb, nullptr, 0, 100, name);
+  }
+  auto vec = fbb.CreateVectorOfSortedTables(monsters, 3);
+  fbb.Finish(vec);
+  auto dictionary = flatbuffers::GetRoot<
+      flatbuffers::Vector<flatbuffers::Offset<Monster>>>(
+      fbb.GetBufferPointer());
+  const char *keys[] = { "Alice", "Barney", "Barney", "Fred", "Wilma", "Zed" };
+  const Monster *found[6];
+  dictionary->LookupByKeys(keys, 6, found);
+  TEST_EQ(found[0], static_cast<const Monster *>(nullptr));
+  TEST_EQ_STR(found[1]->name()->c_str(), "Barney");
+  TEST_EQ(found[2], found[1]);
+  TEST_EQ_STR(found[3]->name()->c_str(), "Fred");
+  TEST_EQ(found[4], dictionary->LookupByKey("Wilma"));
+  TEST_EQ(found[5], static_cast<const Monster *>(nullptr));
+}
+
+// Whether the verifier accepts slots as the hash index of a vector of 3
+// elements, checked both directly and through the buffer's verifier.
+static bool VerifyHashIndexSlots(const std::vector<uint32_t> &slots) {
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<flatbuffers::Offset<Referrable>> elements;
+  for (uint64_t i = 0; i < 3; i++) {
+    elements.push_back(CreateReferrable(fbb, i));
+  }
+  auto vec = fbb.CreateVectorOfSortedTables(&elements);
+  auto index = fbb.CreateVector(slots);
+  auto name = fbb.CreateString("Corrupt");
+  MonsterBuilder mb(fbb);
+  mb.add_name(name);
+  mb.add_vector_of_hashed_referrables(vec);
+  mb.add_vector_of_hashed_referrables_hash_index(index);
+  FinishMonsterBuffer(fbb, mb.Finish());
+  auto monster = GetMonster(fbb.GetBufferPointer());
+  flatbuffers::Verifier index_verifier(fbb.GetBufferPointer(), fbb.GetSize());
+  auto ok = index_verifier.VerifyHashIndex(
+      monster->vector_of_hashed_referrables(),
+      monster->vector_of_hashed_referrables_hash_index());
+  flatbuffers::Verifier buffer_verifier(fbb.GetBufferPointer(),
+                                        fbb.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(buffer_verifier), ok);
+  return ok;
+}
+
+void HashIndexTest() {
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<flatbuffers::Offset<Referrable>> referrable_offsets;
+  for (uint64_t i = 0; i < 100; i++) {
+    referrable_offsets.push_back(CreateReferrable(fbb, i * i));
+  }
+  auto vec = fbb.CreateVectorOfSortedTables(&referrable_offsets);
+  auto index = fbb.CreateHashIndex(vec);
+  std::vector<flatbuffers::Offset<Monster>> monster_offsets;
+  for (int i = 0; i < 10; i++) {
+    auto name = fbb.CreateString(flatbuffers::NumToString(i * 10));
+    monster_offsets.push_back(CreateMonster(fbb, nullptr, 0, 100, name));
+  }
+  auto monster_vec = fbb.CreateVectorOfSortedTables(&monster_offsets);
+  auto monster_index = fbb.CreateHashIndex(monster_vec);
+  auto empty = fbb.CreateVector(monster_offsets.data(), 0);
+  TEST_EQ(fbb.CreateHashIndex(empty).IsNull(), true);
+  fbb.Finish(vec);
+  auto referrables = flatbuffers::GetTemporaryPointer(fbb, vec);
+  auto referrables_index = flatbuffers::GetTemporaryPointer(fbb, index);
+  auto monsters = flatbuffers::GetTemporaryPointer(fbb, monster_vec);
+  auto monsters_index = flatbuffers::GetTemporaryPointer(fbb, monster_index);
+  // At most 2/3 of the slots are used.
+  TEST_EQ(referrables_index->size(), 256U);
+  TEST_EQ(monsters_index->size(), 16U);
+
+  auto found = 0;
+  for (uint64_t key = 0; key < 100 * 100; key++) {
+    auto referrable = referrables->LookupByKeyHashed(key, referrables_index);
+    TEST_EQ(referrable, referrables->LookupByKey(key));
+    found += referrable != nullptr;
+  }
+  TEST_EQ(found, 100);
+  for (int i = 0; i < 100; i++) {
+    auto key = flatbuffers::NumToString(i);
+    auto monster = monsters->LookupByKeyHashed(key.c_str(), monsters_index);
+    TEST_EQ(monster != nullptr, i % 10 == 0);
+    if (monster) TEST_EQ_STR(monster->name()->c_str(), key.c_str());
+  }
+  // Without an index, this falls back to LookupByKey.
+  TEST_EQ(monsters->LookupByKeyHashed("50", nullptr),
+          monsters->LookupByKey("50"));
+
+  flatbuffers::Verifier verifier(fbb.GetBufferPointer(), fbb.GetSize());
+  TEST_EQ(verifier.VerifyHashIndex(referrables, referrables_index), true);
+  TEST_EQ(verifier.VerifyHashIndex(monsters, monsters_index), true);
+  const uint32_t valid[] = { 0, 1, 2, 3 };
+  TEST_EQ(VerifyHashIndexSlots(std::vector<uint32_t>(valid, valid + 4)), true);
+  // Corrupt indexes are rejected. Where every verification failure asserts,
+  // this can't be tested.
+  // clang-format off
+  #ifndef FLATBUFFERS_DEBUG_VERIFICATION_FAILURE
+    const uint32_t not_power_of_two[] = { 1, 2, 3 };
+    const uint32_t too_few_slots[] = { 1, 2 };
+    const uint32_t out_of_range[] = { 1, 2, 4, 0 };
+    const uint32_t no_empty_slot[] = { 1, 2, 3, 1 };
+    TEST_EQ(VerifyHashIndexSlots(std::vector<uint32_t>(
+                not_power_of_two, not_power_of_two + 3)),
+            false);
+    TEST_EQ(VerifyHashIndexSlots(
+                std::vector<uint32_t>(too_few_slots, too_few_slots + 2)),
+            false);
+    TEST_EQ(VerifyHashIndexSlots(
+                std::vector<uint32_t>(out_of_range, out_of_range + 4)),
+            false);
+    TEST_EQ(VerifyHashIndexSlots(
+                std::vector<uint32_t>(no_empty_slot, no_empty_slot + 4)),
+            false);
+  #endif
+  // clang-format on
+
+  // Pack writes the index of a hashed field, which the generated accessor
+  // looks keys up with.
+  MonsterT monster_object;
+  monster_object.name = "hashed";
+  for (uint64_t i = 0; i < 50; i++) {
+    monster_object.vector_of_hashed_referrables.push_back(
+        flatbuffers::unique_ptr<ReferrableT>(new ReferrableT()));
+    monster_object.vector_of_hashed_referrables.back()->id = i * 7;
+  }
+  flatbuffers::FlatBufferBuilder packed(1024, nullptr, false,
+                                        FLATBUFFERS_MAX_ALIGNMENT);
+  FinishMonsterBuffer(packed, Monster::Pack(packed, &monster_object));
+  flatbuffers::Verifier packed_verifier(packed.GetBufferPointer(),
+                                        packed.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(packed_verifier), true);
+  auto packed_monster = GetMonster(packed.GetBufferPointer());
+  TEST_EQ(packed_monster->vector_of_hashed_referrables_hash_index()->size(),
+          128U);
+  for (uint64_t key = 0; key < 50 * 7; key++) {
+    auto referrable = packed_monster->vector_of_hashed_referrables_by_key(key);
+    TEST_EQ(referrable != nullptr, key % 7 == 0);
+    if (referrable) TEST_EQ(referrable->id(), key);
+  }
+  // Unpacking and packing again rebuilds the same index.
+  flatbuffers::unique_ptr<MonsterT> unpacked(packed_monster->UnPack());
+  flatbuffers::FlatBufferBuilder repacked(1024, nullptr, false,
+                                          FLATBUFFERS_MAX_ALIGNMENT);
+  FinishMonsterBuffer(repacked, Monster::Pack(repacked, unpacked.get()));
+  auto repacked_monster = GetMonster(repacked.GetBufferPointer());
+  TEST_EQ(flatbuffers::VectorEquals(
+              repacked_monster->vector_of_hashed_referrables_hash_index(),
+              packed_monster->vector_of_hashed_referrables_hash_index()),
+          true);
+  TEST_EQ(repacked_monster->vector_of_hashed_referrables_by_key(49 * 7)->id(),
+          49U * 7);
+
+  // The parser adds a field for the index after a hashed vector.
+  flatbuffers::Parser parser;
+  TEST_EQ(parser.Parse("table K { k:string (key); }"
+                       "table X { a:int (id:0); v:[K] (id:1, hashed);"
+                       "b:int (id:3); }"),
+          true);
+  auto x = parser.LookupStruct("X");
+  auto index_field = x->fields.Lookup("v_hash_index");
+  TEST_NOTNULL(index_field);
+  TEST_EQ(index_field->value.type.element, flatbuffers::BASE_TYPE_UINT);
+  TEST_EQ(index_field->value.offset, flatbuffers::FieldIndexToOffset(2));
+}
+
+void BufferTemplateTest() {
+  // A prototype with all scalars present, even those at their default.
+  flatbuffers::FlatBufferBuilder fbb(1024, nullptr, false,
+                                     FLATBUFFERS_MAX_ALIGNMENT);
+  fbb.ForceDefaults(true);
+  Vec3 pos(1, 2, 3, 0, Color_Red, Test(10, 20));
+  auto name = fbb.CreateString("Prototype");
+  FinishMonsterBuffer(fbb, CreateMonster(fbb, &pos, 150, 100, name));
+  MonsterBufferTemplate prototype(fbb.GetBufferPointer(), fbb.GetSize());
+  TEST_EQ(prototype.size(), static_cast<size_t>(fbb.GetSize()));
+
+  std::vector<uint8_t> buf(prototype.size());
+  for (int16_t hp = 0; hp < 3; hp++) {
+    prototype.CopyTo(buf.data());
+    TEST_EQ(prototype.mutate_hp(buf.data(), hp), true);
+    TEST_EQ(prototype.mutate_color(buf.data(), Color_Green), true);
+    TEST_EQ(prototype.mutate_testbool(buf.data(), true), true);
+    TEST_EQ(prototype.mutate_pos(buf.data(), Vec3(4, 5, 6, 0, Color_Blue,
+                                                  Test(30, 40))),
+            true);
+    flatbuffers::Verifier verifier(buf.data(), buf.size());
+    TEST_EQ(VerifyMonsterBuffer(verifier), true);
+    auto monster = GetMonster(buf.data());
+    TEST_EQ(monster->hp(), hp);
+    TEST_EQ(monster->mana(), 150);
+    TEST_EQ(monster->color(), Color_Green);
+    TEST_EQ(monster->testbool(), true);
+    TEST_EQ(monster->pos()->z(), 6);
+    TEST_EQ(monster->pos()->test3().a(), 30);
+    TEST_EQ_STR(monster->name()->c_str(), "Prototype");
+  }
+
+  // Fields absent from the prototype can't be patched.
+  flatbuffers::FlatBufferBuilder sparse_fbb;
+  name = sparse_fbb.CreateString("Sparse");
+  sparse_fbb.Finish(CreateMonster(sparse_fbb, nullptr, 150, 100, name));
+  MonsterBufferTemplate sparse(sparse_fbb.GetBufferPointer(),
+                               sparse_fbb.GetSize());
+  buf.resize(sparse.size());
+  sparse.CopyTo(buf.data());
+  TEST_EQ(sparse.mutate_hp(buf.data(), 1), false);
+  TEST_EQ(GetMonster(buf.data())->hp(), 100);
 }
 
 // Prefix a FlatBuffer with a size field.
@@ -519,6 +1017,123 @@ void SizePrefixedTest() {
   TEST_EQ_STR(m->name()->c_str(), "bob");
 }
 
+void RecordStreamTest() {
+  const int num_records = 100;
+  flatbuffers::RecordStreamWriter writer(8);
+  std::vector<uint8_t> unindexed;
+  for (int i = 0; i < num_records; i++) {
+    flatbuffers::FlatBufferBuilder fbb;
+    // Vary the name length, so records need padding to stay aligned.
+    FinishSizePrefixedMonsterBuffer(
+        fbb, CreateMonster(fbb, 0, 0, static_cast<int16_t>(i),
+                           fbb.CreateString(std::string(i % 7 + 1, 'x'))));
+    TEST_EQ(writer.Append(fbb), true);
+    unindexed.insert(unindexed.end(), fbb.GetBufferPointer(),
+                     fbb.GetBufferPointer() + fbb.GetSize());
+  }
+  // Records that empty records can't pad to alignment are rejected.
+  uint8_t odd[] = { 3, 0, 0, 0, 1, 2, 3 };
+  TEST_EQ(writer.Append(odd, sizeof(odd)), false);
+  writer.Finish();
+  TEST_EQ(writer.num_records(), static_cast<size_t>(num_records));
+  auto stream = writer.Release();
+
+  // Walking the size prefixes finds all records, then the index.
+  size_t walked = 0;
+  for (size_t pos = 0; pos < stream.size();) {
+    auto record = flatbuffers::vector_data(stream) + pos;
+    size_t len = flatbuffers::GetPrefixedSize(record) + 4;
+    pos += len;
+    if (len == 4) continue;  // Padding.
+    if (flatbuffers::IsRecordStreamIndex(record, len)) {
+      TEST_EQ(pos, stream.size());
+      break;
+    }
+    TEST_EQ(GetSizePrefixedMonster(record)->hp(),
+            static_cast<int16_t>(walked++));
+  }
+  TEST_EQ(walked, static_cast<size_t>(num_records));
+
+  // Random access through the index.
+  flatbuffers::RecordStreamReader reader;
+  TEST_EQ(reader.Open(flatbuffers::vector_data(stream), stream.size()), true);
+  TEST_EQ(reader.size(), static_cast<size_t>(num_records));
+  for (int i = num_records - 1; i >= 0; i--) {
+    TEST_EQ(reader.Verify<Monster>(i, MonsterIdentifier()), true);
+    TEST_EQ(reader.GetRoot<Monster>(i)->hp(), i);
+  }
+  TEST_EQ(reader.Get(num_records) == nullptr, true);
+
+  // Partial and parallel iteration.
+  int count = 0;
+  TEST_EQ(reader.ForEach(13, 42, [&](size_t i, const uint8_t *buf, size_t) {
+    TEST_EQ(GetSizePrefixedMonster(buf)->hp(), static_cast<int16_t>(i));
+    count++;
+    return true;
+  }), true);
+  TEST_EQ(count, 42 - 13);
+  TEST_EQ(reader.VerifyAll<Monster>(MonsterIdentifier(), 4), true);
+  std::vector<int16_t> hps(num_records, -1);
+  TEST_EQ(reader.ParallelForEach(4, [&](size_t i, const uint8_t *buf, size_t) {
+    hps[i] = GetSizePrefixedMonster(buf)->hp();
+    return true;
+  }), true);
+  for (int i = 0; i < num_records; i++) TEST_EQ(hps[i], i);
+
+  // Plain concatenated buffers, without an index.
+  TEST_EQ(reader.Open(flatbuffers::vector_data(unindexed), unindexed.size()),
+          true);
+  TEST_EQ(reader.size(), static_cast<size_t>(num_records));
+  TEST_EQ(reader.GetRoot<Monster>(77)->hp(), 77);
+
+  // Truncated.
+  TEST_EQ(reader.Open(flatbuffers::vector_data(unindexed),
+                      unindexed.size() - 1),
+          false);
+
+  // Records appended to an indexed stream, as to a log file, follow its
+  // index, which is then skipped like padding.
+  flatbuffers::RecordStreamWriter appender;
+  for (int i = num_records; i < num_records + 10; i++) {
+    flatbuffers::FlatBufferBuilder fbb;
+    FinishSizePrefixedMonsterBuffer(
+        fbb, CreateMonster(fbb, 0, 0, static_cast<int16_t>(i),
+                           fbb.CreateString("appended")));
+    TEST_EQ(appender.Append(fbb), true);
+  }
+  auto appended = stream;
+  appended.insert(appended.end(), appender.data(),
+                  appender.data() + appender.size());
+  TEST_EQ(reader.Open(flatbuffers::vector_data(appended), appended.size()),
+          true);
+  TEST_EQ(reader.size(), static_cast<size_t>(num_records + 10));
+  for (int i = 0; i < num_records + 10; i++) {
+    TEST_EQ(reader.GetRoot<Monster>(i)->hp(), i);
+  }
+  count = 0;
+  TEST_EQ(reader.ForEach(0, num_records + 10,
+                         [&](size_t i, const uint8_t *buf, size_t) {
+    TEST_EQ(GetSizePrefixedMonster(buf)->hp(), static_cast<int16_t>(i));
+    count++;
+    return true;
+  }), true);
+  TEST_EQ(count, num_records + 10);
+
+  // Once those are indexed too, the last index can't be used, since its
+  // offsets are relative to the appended stream. It's walked instead.
+  appender.Finish();
+  auto concatenated = stream;
+  concatenated.insert(concatenated.end(), appender.data(),
+                      appender.data() + appender.size());
+  TEST_EQ(reader.Open(flatbuffers::vector_data(concatenated),
+                      concatenated.size()),
+          true);
+  TEST_EQ(reader.size(), static_cast<size_t>(num_records + 10));
+  for (int i = 0; i < num_records + 10; i++) {
+    TEST_EQ(reader.GetRoot<Monster>(i)->hp(), i);
+  }
+}
+
 void TriviallyCopyableTest() {
   // clang-format off
   #if __GNUG__ && __GNUC__ < 5
@@ -562,6 +1177,30 @@ void JsonDefaultTest() {
   TEST_EQ(std::string::npos != jsongen.find("testf: 3.14159"), true);
 }
 
+void JsonPrinterTest() {
+  flatbuffers::Parser parser;
+  TEST_EQ(parser.Parse("table T { a:ulong = 18446744073709551615; "
+                       "b:float = 0.5; c:short = -3; t:T; } root_type T;"
+                       "{ c: 7, t: { a: 1 } }"),
+          true);
+  parser.opts.indent_step = -1;
+  parser.opts.output_default_scalars_in_json = true;
+
+  // Defaults are printed from the plan of each table, made the first time it
+  // is printed.
+  flatbuffers::JsonPrinter printer(parser);
+  TEST_EQ(printer.Print(parser.builder_.GetBufferPointer()), true);
+  TEST_EQ_STR(printer.text_.c_str(),
+              "{a: 18446744073709551615,b: 0.5,c: 7,"
+              "t: {a: 1,b: 0.5,c: -3}}");
+
+  // Plans are remade when the options they depend on change.
+  parser.opts.strict_json = true;
+  parser.opts.output_default_scalars_in_json = false;
+  TEST_EQ(printer.Print(parser.builder_.GetBufferPointer()), true);
+  TEST_EQ_STR(printer.text_.c_str(), "{\"c\": 7,\"t\": {\"a\": 1}}");
+}
+
 // example of parsing text straight into a buffer, and generating
 // text back from it:
 void ParseAndGenerateTextTest() {
@@ -824,6 +1463,160 @@ void ReflectionTest(uint8_t *flatbuf, size_t length) {
           true);
 }
 
+void ColumnProjectionTest(const uint8_t *flatbuf) {
+  std::string bfbsfile;
+  TEST_EQ(flatbuffers::LoadFile((test_data_path + "monster_test.bfbs").c_str(),
+                                true, &bfbsfile),
+          true);
+  auto &schema = *reflection::GetSchema(bfbsfile.c_str());
+  auto &vector_field =
+      *schema.root_table()->fields()->LookupByKey("testarrayoftables");
+
+  flatbuffers::ColumnProjection projection(schema, vector_field);
+  TEST_EQ(projection.AddColumn("name"), true);
+  TEST_EQ(projection.AddColumn("hp"), true);
+  TEST_EQ(projection.AddColumn("testf"), true);
+  TEST_EQ(projection.AddColumn("pos.test3.b"), true);
+  TEST_EQ(projection.AddColumn("enemy.hp"), true);
+  TEST_EQ(projection.AddColumn("inventory"), false);
+  TEST_EQ(projection.AddColumn("pos.w"), false);
+  TEST_EQ(projection.AddColumn("test.hp"), false);
+  // Project the same vector twice.
+  projection.Project(*flatbuffers::GetAnyRoot(flatbuf));
+  projection.Project(*flatbuffers::GetAnyRoot(flatbuf));
+  TEST_EQ(projection.rows(), 6);
+
+  auto &columns = projection.columns();
+  TEST_EQ(columns.size(), 5);
+  auto &names = columns[0];
+  TEST_EQ(names.strings.size(), 6);
+  TEST_EQ_STR(names.strings[0]->c_str(), "Barney");
+  TEST_EQ_STR(names.strings[1]->c_str(), "Fred");
+  TEST_EQ_STR(names.strings[5]->c_str(), "Wilma");
+  auto &hp = columns[1];
+  TEST_EQ(hp.ints.size(), 6);
+  TEST_EQ(hp.ints[0], 1000);
+  TEST_EQ(hp.present[0], 1);
+  TEST_EQ(hp.ints[1], 100);
+  TEST_EQ(hp.present[1], 0);
+  TEST_EQ(hp.ints[3], 1000);
+  auto &testf = columns[2];
+  TEST_EQ(testf.floats.size(), 6);
+  TEST_EQ(testf.floats[2], 3.14159);
+  auto &test3_b = columns[3];
+  TEST_EQ(test3_b.type, reflection::Byte);
+  TEST_EQ(test3_b.ints[4], 0);
+  TEST_EQ(test3_b.present[4], 0);
+  TEST_EQ(columns[4].present[5], 0);
+
+  // A buffer read into memory that held another one earlier may have a
+  // different vtable at the same address.
+  std::vector<uint8_t> buf;
+  flatbuffers::ColumnProjection reused(schema, vector_field);
+  TEST_EQ(reused.AddColumn("hp"), true);
+  for (int with_hp = 1; with_hp >= 0; with_hp--) {
+    flatbuffers::FlatBufferBuilder fbb;
+    auto name = fbb.CreateString("Row");
+    MonsterBuilder row(fbb);
+    row.add_name(name);
+    if (with_hp) {
+      row.add_hp(7);
+    } else {
+      row.add_mana(7);
+    }
+    auto rows = fbb.CreateVector(
+        std::vector<flatbuffers::Offset<Monster>>(1, row.Finish()));
+    auto root_name = fbb.CreateString("Root");
+    MonsterBuilder root(fbb);
+    root.add_name(root_name);
+    root.add_testarrayoftables(rows);
+    FinishMonsterBuffer(fbb, root.Finish());
+    if (!with_hp) TEST_EQ(fbb.GetSize(), buf.size());
+    buf.assign(fbb.GetBufferPointer(), fbb.GetBufferPointer() + fbb.GetSize());
+    reused.Project(*flatbuffers::GetAnyRoot(flatbuffers::vector_data(buf)));
+  }
+  TEST_EQ(reused.rows(), 2);
+  TEST_EQ(reused.columns()[0].present[0], 1);
+  TEST_EQ(reused.columns()[0].ints[0], 7);
+  TEST_EQ(reused.columns()[0].present[1], 0);
+  TEST_EQ(reused.columns()[0].ints[1], 100);
+}
+
+void ReflectionDiffTest(const uint8_t *flatbuf, size_t length) {
+  std::string bfbsfile;
+  TEST_EQ(flatbuffers::LoadFile((test_data_path + "monster_test.bfbs").c_str(),
+                                true, &bfbsfile),
+          true);
+  auto &schema = *reflection::GetSchema(bfbsfile.c_str());
+  auto fields = schema.root_table()->fields();
+
+  // Make a modified copy of the buffer that has the same shape.
+  std::vector<uint8_t> newbuf(flatbuf, flatbuf + length);
+  auto rroot = flatbuffers::piv(
+      flatbuffers::GetAnyRoot(flatbuffers::vector_data(newbuf)), newbuf);
+  flatbuffers::SetField<int16_t>(*rroot, *fields->LookupByKey("hp"), 42);
+  SetString(schema, "Diffy", GetFieldS(**rroot, *fields->LookupByKey("name")),
+            &newbuf);
+  flatbuffers::ResizeVector<uint8_t>(
+      schema, 12, 7,
+      flatbuffers::GetFieldV<uint8_t>(**rroot,
+                                      *fields->LookupByKey("inventory")),
+      &newbuf);
+  auto monsters = GetMonster(flatbuffers::vector_data(newbuf))
+                      ->testarrayoftables();
+  SetString(schema, "Barnaby", monsters->Get(1)->name(), &newbuf);
+
+  // The patch should be much smaller than the buffer it describes.
+  std::vector<uint8_t> patch;
+  flatbuffers::DiffFlatBuffers(schema, flatbuf,
+                               flatbuffers::vector_data(newbuf), newbuf.size(),
+                               &patch);
+  TEST_EQ(patch.size() < newbuf.size() / 4, true);
+
+  std::vector<uint8_t> patched(flatbuf, flatbuf + length);
+  TEST_EQ(flatbuffers::ApplyPatch(schema, flatbuffers::vector_data(patch),
+                                  patch.size(), &patched),
+          true);
+  flatbuffers::Verifier verifier(flatbuffers::vector_data(patched),
+                                 patched.size());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  auto monster = GetMonster(flatbuffers::vector_data(patched));
+  TEST_EQ(monster->hp(), 42);
+  TEST_EQ_STR(monster->name()->c_str(), "Diffy");
+  TEST_EQ(monster->inventory()->size(), 12);
+  TEST_EQ(monster->inventory()->Get(9), 9);
+  TEST_EQ(monster->inventory()->Get(11), 7);
+  TEST_EQ_STR(monster->testarrayoftables()->Get(1)->name()->c_str(),
+              "Barnaby");
+  TEST_EQ_STR(monster->testarrayoftables()->Get(2)->name()->c_str(), "Wilma");
+
+  // Diffing the result against the target should find nothing left to do.
+  std::vector<uint8_t> empty_patch;
+  flatbuffers::DiffFlatBuffers(schema, flatbuffers::vector_data(patched),
+                               flatbuffers::vector_data(newbuf), newbuf.size(),
+                               &empty_patch);
+  TEST_EQ(flexbuffers::GetRoot(empty_patch).AsVector().size(), 0);
+
+  // Fields that are not stored in the old buffer can't be patched in-place,
+  // so their table gets sent whole instead.
+  MonsterT monster_obj;
+  GetMonster(flatbuf)->UnPackTo(&monster_obj);
+  monster_obj.testf = 1.5f;
+  monster_obj.enemy.reset(new MonsterT());
+  monster_obj.enemy->name = "Evil";
+  flatbuffers::FlatBufferBuilder fbb;
+  FinishMonsterBuffer(fbb, CreateMonster(fbb, &monster_obj));
+  flatbuffers::DiffFlatBuffers(schema, flatbuf, fbb.GetBufferPointer(),
+                               fbb.GetSize(), &patch);
+  patched.assign(flatbuf, flatbuf + length);
+  TEST_EQ(flatbuffers::ApplyPatch(schema, flatbuffers::vector_data(patch),
+                                  patch.size(), &patched),
+          true);
+  monster = GetMonster(flatbuffers::vector_data(patched));
+  TEST_EQ(monster->testf(), 1.5f);
+  TEST_EQ_STR(monster->enemy()->name()->c_str(), "Evil");
+}
+
 void MiniReflectFlatBuffersTest(uint8_t *flatbuf) {
   auto s = flatbuffers::FlatBufferToString(flatbuf, Monster::MiniReflectTypeTable());
   TEST_EQ_STR(
@@ -1226,6 +2019,7 @@ void ErrorTest() {
   TestError("table X { Y:string = \"\"; }", "default values");
   TestError("enum Y:byte { Z = 1 } table X { y:Y; }", "not part of enum");
   TestError("struct X { Y:int (deprecated); }", "deprecate");
+  TestError("table X { Y:int (hashed); }", "vector of tables");
   TestError("union Z { X } table X { Y:Z; } root_type X; { Y: {}, A:1 }",
             "missing type field");
   TestError("union Z { X } table X { Y:Z; } root_type X; { Y_type: 99, Y: {",
@@ -1256,6 +2050,7 @@ void ErrorTest() {
   TestError("root_type X;", "unknown root");
   TestError("struct X { Y:int; } root_type X;", "a table");
   TestError("union X { Y }", "referenced");
+  TestError("table Z { W:int; } table X { Y:[Z] (hashed); }", "key field");
   TestError("union Z { X } struct X { Y:int; }", "only tables");
   TestError("table X { Y:[int]; YLength:int; }", "clash");
   TestError("table X { Y:byte; } root_type X; { Y:1, Y:2 }", "more than once");
@@ -1361,6 +2156,55 @@ void EnumStringsTest() {
           true);
 }
 
+void EnumLookupTest() {
+  flatbuffers::Parser parser;
+  TEST_EQ(parser.Parse("enum Dense:int { A = -2, B, C = 5 }"
+                       "enum Sparse:long { X = -1000000000000, Y, Z = 9000 }"
+                       "table T { a:int; } union U { T }"),
+          true);
+  auto dense = parser.enums_.Lookup("Dense");
+  auto sparse = parser.enums_.Lookup("Sparse");
+  auto u = parser.enums_.Lookup("U");
+  TEST_NOTNULL(dense);
+  TEST_NOTNULL(sparse);
+  TEST_NOTNULL(u);
+  const char *names[] = { "A", "B", "C", "X", "Y", "Z" };
+  for (int i = 0; i < 6; i++) {
+    auto enum_def = i < 3 ? dense : sparse;
+    auto enum_val = enum_def->Lookup(names[i]);
+    TEST_NOTNULL(enum_val);
+    TEST_EQ_STR(enum_val->name.c_str(), names[i]);
+    TEST_EQ(enum_def->ReverseLookup(enum_val->value), enum_val);
+  }
+  TEST_EQ(dense->Lookup("X") == nullptr, true);
+  TEST_EQ(dense->Lookup("AB") == nullptr, true);
+  TEST_EQ(dense->ReverseLookup(0) == nullptr, true);
+  TEST_EQ(dense->ReverseLookup(6) == nullptr, true);
+  TEST_EQ(sparse->ReverseLookup(0) == nullptr, true);
+  TEST_EQ(sparse->ReverseLookup(-1000000000001LL) == nullptr, true);
+  // The NONE value of a union is only found when asked for.
+  TEST_EQ(u->ReverseLookup(0) == nullptr, true);
+  TEST_EQ(u->ReverseLookup(0, false), u->Lookup("NONE"));
+  TEST_EQ(u->ReverseLookup(1), u->Lookup("T"));
+  // Enough names that no single slot per name can be relied upon.
+  std::string schema = "enum Large:int {";
+  for (int i = 0; i < 1000; i++) {
+    schema += (i ? ", V" : " V") + flatbuffers::NumToString(i);
+  }
+  TEST_EQ(parser.Parse((schema + " }").c_str()), true);
+  auto large = parser.enums_.Lookup("Large");
+  TEST_NOTNULL(large);
+  for (int i = 0; i < 1000; i++) {
+    auto name = "V" + flatbuffers::NumToString(i);
+    auto enum_val = large->Lookup(name);
+    TEST_NOTNULL(enum_val);
+    TEST_EQ_STR(enum_val->name.c_str(), name.c_str());
+    TEST_EQ(enum_val->value, i);
+  }
+  TEST_EQ(large->Lookup("V1000") == nullptr, true);
+  TEST_EQ(large->Lookup("V") == nullptr, true);
+}
+
 void EnumNamesTest() {
   TEST_EQ_STR("Red", EnumNameColor(Color_Red));
   TEST_EQ_STR("Green", EnumNameColor(Color_Green));
@@ -1676,6 +2520,66 @@ void NumericUtilsTest() {
   NumericUtilsTestFloat<float>("-1.7977e+308", "+1.7977e+308");
 }
 
+void NumToStringTest() {
+  TEST_EQ_STR(flatbuffers::NumToString(0).c_str(), "0");
+  TEST_EQ_STR(flatbuffers::NumToString(static_cast<int8_t>(-128)).c_str(),
+              "-128");
+  TEST_EQ_STR(flatbuffers::NumToString(flatbuffers::numeric_limits<
+                                           int64_t>::lowest()).c_str(),
+              "-9223372036854775808");
+  TEST_EQ_STR(flatbuffers::NumToString(flatbuffers::numeric_limits<
+                                           uint64_t>::max()).c_str(),
+              "18446744073709551615");
+  // Floating point values print the shortest string that round-trips.
+  TEST_EQ_STR(flatbuffers::NumToString(0.1).c_str(), "0.1");
+  TEST_EQ_STR(flatbuffers::NumToString(0.1f).c_str(), "0.1");
+  TEST_EQ_STR(flatbuffers::NumToString(3.14159265359).c_str(),
+              "3.14159265359");
+  TEST_EQ_STR(flatbuffers::NumToString(-2.0).c_str(), "-2.0");
+  TEST_EQ_STR(flatbuffers::NumToString(-0.0).c_str(), "-0.0");
+  TEST_EQ_STR(flatbuffers::NumToString(1e20).c_str(),
+              "100000000000000000000.0");
+  TEST_EQ_STR(flatbuffers::NumToString(1e21).c_str(), "1e+21");
+  TEST_EQ_STR(flatbuffers::NumToString(0.000001).c_str(), "0.000001");
+  TEST_EQ_STR(flatbuffers::NumToString(1.5e-7).c_str(), "1.5e-07");
+  TEST_EQ_STR(flatbuffers::NumToString(5e-324).c_str(), "5e-324");
+  TEST_EQ_STR(flatbuffers::NumToString(1.7976931348623157e308).c_str(),
+              "1.7976931348623157e+308");
+  TEST_EQ_STR(flatbuffers::NumToString(3.4028235e38f).c_str(),
+              "3.4028235e+38");
+  // Random bit patterns survive a round-trip through text, and the parser
+  // agrees with strtod.
+  for (int i = 0; i < 10000; i++) {
+    uint64_t bits = (static_cast<uint64_t>(lcg_rand()) << 32) | lcg_rand();
+    double d;
+    memcpy(&d, &bits, sizeof(d));
+    if (d != d) continue;
+    auto s = flatbuffers::NumToString(d);
+    double back;
+    TEST_EQ(flatbuffers::StringToNumber(s.c_str(), &back), true);
+    TEST_EQ(memcmp(&d, &back, sizeof(d)), 0);
+    TEST_EQ(back, strtod(s.c_str(), nullptr));
+    auto fbits = lcg_rand();
+    float f;
+    memcpy(&f, &fbits, sizeof(f));
+    if (f != f) continue;
+    s = flatbuffers::NumToString(f);
+    float fback;
+    TEST_EQ(flatbuffers::StringToNumber(s.c_str(), &fback), true);
+    TEST_EQ(memcmp(&f, &fback, sizeof(f)), 0);
+  }
+  // Halfway cases round to even, and long inputs fall back to strtod.
+  const char *inputs[] = { "9007199254740993", "9007199254740995",
+                           "2.2250738585072011e-308", "4.9e-324", "1e-400",
+                           "1e400", "0.1000000000000000055511151231257827",
+                           "+.5", "5.", "1e+0", "000000000000000000000123" };
+  for (size_t i = 0; i < sizeof(inputs) / sizeof(inputs[0]); i++) {
+    double d;
+    TEST_EQ(flatbuffers::StringToNumber(inputs[i], &d), true);
+    TEST_EQ(d, strtod(inputs[i], nullptr));
+  }
+}
+
 void IsAsciiUtilsTest() {
   char c = -128;
   for (int cnt = 0; cnt < 256; cnt++) {
@@ -2038,6 +2942,8 @@ void UnionVectorTest() {
   TEST_EQ(movie_object->characters[2].AsBookFan()->books_read(), 2);
   TEST_EQ_STR(movie_object->characters[3].AsOther()->c_str(), "Other");
   TEST_EQ_STR(movie_object->characters[4].AsUnused()->c_str(), "Unused");
+  auto movie_hash = flat_movie->Hash();
+  TEST_EQ(std::hash<MovieT>()(*movie_object), movie_hash);
 
   fbb.Clear();
   fbb.Finish(Movie::Pack(fbb, movie_object));
@@ -2047,6 +2953,7 @@ void UnionVectorTest() {
   auto repacked_movie = GetMovie(fbb.GetBufferPointer());
 
   TestMovie(repacked_movie);
+  TEST_EQ(repacked_movie->Hash(), movie_hash);
 
   auto s =
       flatbuffers::FlatBufferToString(fbb.GetBufferPointer(), MovieTypeTable());
@@ -2370,6 +3277,625 @@ void LoadVerifyBinaryTest() {
   }
 }
 
+void MappedFileTest() {
+  flatbuffers::MappedFile file;
+  TEST_EQ(file.Map((test_data_path + "monsterdata_test.mon").c_str(),
+                   flatbuffers::MappedFile::kAccessRandom),
+          true);
+  TEST_NOTNULL(file.data());
+  flatbuffers::Verifier verifier(file.data(), file.size());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  TEST_EQ(GetMonster(file.data())->hp(), 80);
+
+  // Must be identical to what LoadFile returns.
+  std::string binary;
+  TEST_EQ(flatbuffers::LoadFile(
+              (test_data_path + "monsterdata_test.mon").c_str(), true, &binary),
+          true);
+  TEST_EQ(binary.size(), file.size());
+  TEST_EQ(memcmp(binary.data(), file.data(), file.size()), 0);
+
+  // Remapping releases the previous mapping first.
+  TEST_EQ(file.Map((test_data_path + "does_not_exist.mon").c_str()), false);
+  TEST_EQ(file.mapped(), false);
+  TEST_EQ(file.size(), 0);
+}
+
+// Parse json with both a JsonIngester and a Parser, which must agree.
+void CheckJsonIngest(const flatbuffers::Parser &schema, const char *json) {
+  flatbuffers::JsonIngester ingester(schema);
+  auto ok = ingester.Parse(json);
+  flatbuffers::Parser parser(schema.opts);
+  parser.enums_ = schema.enums_;
+  parser.root_struct_def_ = schema.root_struct_def_;
+  parser.file_identifier_ = schema.file_identifier_;
+  TEST_EQ(parser.Parse(json), ok);
+  TEST_EQ_STR(ingester.error_.c_str(), parser.error_.c_str());
+  if (ok) {
+    TEST_EQ(ingester.builder_.GetSize(), parser.builder_.GetSize());
+    TEST_EQ(memcmp(ingester.builder_.GetBufferPointer(),
+                   parser.builder_.GetBufferPointer(),
+                   parser.builder_.GetSize()),
+            0);
+  }
+  parser.enums_.dict.clear();
+  parser.enums_.vec.clear();
+}
+
+void JsonIngesterTest() {
+  std::string schemafile;
+  std::string jsonfile;
+  TEST_EQ(flatbuffers::LoadFile((test_data_path + "monster_test.fbs").c_str(),
+                                false, &schemafile),
+          true);
+  TEST_EQ(flatbuffers::LoadFile(
+              (test_data_path + "monsterdata_test.golden").c_str(), false,
+              &jsonfile),
+          true);
+  flatbuffers::Parser parser;
+  auto include_test_path =
+      flatbuffers::ConCatPathFileName(test_data_path, "include_test");
+  const char *include_directories[] = { test_data_path.c_str(),
+                                        include_test_path.c_str(), nullptr };
+  TEST_EQ(parser.Parse(schemafile.c_str(), include_directories), true);
+
+  flatbuffers::JsonIngester ingester(parser);
+  TEST_EQ(ingester.Parse(jsonfile.c_str()), true);
+  flatbuffers::Verifier verifier(ingester.builder_.GetBufferPointer(),
+                                 ingester.builder_.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  // An ingester can be reused.
+  TEST_EQ(ingester.Parse("{ name: \"Reused\", hp: 10 }"), true);
+  TEST_EQ_STR(GetMonster(ingester.builder_.GetBufferPointer())->name()->c_str(),
+              "Reused");
+
+  CheckJsonIngest(parser, jsonfile.c_str());
+  // Union type after the value, and a struct union member.
+  CheckJsonIngest(parser,
+                  "{ name: \"U\", test: { name: \"Inner\", hp: 3 }, "
+                  "test_type: Monster }");
+  CheckJsonIngest(parser,
+                  "{ name: \"U\", test_type: \"TestSimpleTableWithEnum\", "
+                  "test: { color: Green } }");
+  // Escapes, non-ASCII and quoted numbers.
+  CheckJsonIngest(parser,
+                  "{ \"name\": \"a\\tb\\u00e9\\ud83d\\ude00\\x41\\/\", "
+                  "'hp': \"42 \", mana: -0, color: \"Red Blue\", "
+                  "testarrayofstring: [ \"\xc3\xa9t\xc3\xa9\", \"\" ] }");
+  // Vectors of structs, doubles and floats of all sizes.
+  CheckJsonIngest(parser,
+                  "{ name: \"V\", test4: [ { a: 1, b: 2 }, { a: -3, b: 4 } ],"
+                  " pos: { x: 1.5, y: 2e3, z: -0.1, test1: 3.14159265358979,"
+                  " test2: Blue, test3: { a: 5, b: 6 } },"
+                  " testf: 1e-45, testf2: 3.4028235e38, testf3: 0.1,"
+                  " testhashu64_fnv1: 18446744073709551615,"
+                  " testhashs64_fnv1: -9223372036854775808,"
+                  " testarrayofbools: [ true, false, true ],"
+                  " unknown_field: [ { a: 1 } ],"
+                  " testempty: null }");
+  // Things handed to the Parser: hashes, nested FlatBuffers, comments, hex.
+  CheckJsonIngest(parser,
+                  "{ name: \"H\", testhashu32_fnv1: \"Hash\", "
+                  "testnestedflatbuffer: { name: \"N\" } }");
+  CheckJsonIngest(parser, "{ name: \"C\", /* comment */ hp: 0x10 }");
+  // Errors must be reported exactly like the Parser does.
+  CheckJsonIngest(parser, "{ hp: 1 }");
+  CheckJsonIngest(parser, "{ name: \"E\", hp: 100000 }");
+  CheckJsonIngest(parser, "{ name: \"E\", hp: 1.5 }");
+  CheckJsonIngest(parser, "{ name: \"E\", name: \"E\" }");
+  CheckJsonIngest(parser, "{ name: \"E\", color: Purple }");
+  CheckJsonIngest(parser, "{ name: \"E\\uDC00\" }");
+  CheckJsonIngest(parser, "{ name: \"E\", no_such_field: 1 }");
+  CheckJsonIngest(parser, "{ name: \"E\" } trailing");
+}
+
+void JsonLinesTest() {
+  flatbuffers::Parser parser;
+  TEST_EQ(parser.Parse("table T { name:string; id:int; v:[ushort]; }"
+                       "root_type T;"),
+          true);
+  // Enough lines to need several rounds over multiple threads.
+  std::string json;
+  const int kLines = 20000;
+  for (int i = 0; i < kLines; i++) {
+    json += "{ \"name\": \"record " + flatbuffers::NumToString(i) +
+            "\", \"id\": " + flatbuffers::NumToString(i) +
+            ", \"v\": [ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 ] }\n";
+    if (i % 1000 == 0) json += "\n";  // Blank lines are skipped.
+  }
+  flatbuffers::RecordStreamWriter writer;
+  std::string error;
+  TEST_EQ(flatbuffers::ParseJsonLines(parser, json.c_str(), json.length(), 4,
+                                      &writer, &error),
+          true);
+  writer.Finish();
+  flatbuffers::RecordStreamReader reader;
+  TEST_EQ(reader.Open(writer.data(), writer.size()), true);
+  TEST_EQ(reader.size(), static_cast<size_t>(kLines));
+  TEST_EQ(reader.ForEach(0, reader.size(),
+                         [](size_t i, const uint8_t *buf, size_t) {
+                           auto table = flatbuffers::GetSizePrefixedRoot<
+                               flatbuffers::Table>(buf);
+                           return table->GetField<int32_t>(6, 0) ==
+                                  static_cast<int32_t>(i);
+                         }),
+          true);
+
+  // Errors are reported with the line number in the whole input.
+  json += "{ \"name\": \"bad\", \"id\": \"x\" }\n";
+  flatbuffers::RecordStreamWriter bad_writer;
+  TEST_EQ(flatbuffers::ParseJsonLines(parser, json.c_str(), json.length(), 3,
+                                      &bad_writer, &error),
+          false);
+  auto line = flatbuffers::NumToString(kLines + kLines / 1000 + 1) + ":";
+  TEST_EQ(error.compare(0, line.length(), line), 0);
+  TEST_EQ(bad_writer.num_records(), static_cast<size_t>(kLines));
+}
+
+void CompiledSchemaTest() {
+  std::string schemafile;
+  std::string jsonfile;
+  TEST_EQ(flatbuffers::LoadFile((test_data_path + "monster_test.fbs").c_str(),
+                                false, &schemafile),
+          true);
+  TEST_EQ(flatbuffers::LoadFile(
+              (test_data_path + "monsterdata_test.golden").c_str(), false,
+              &jsonfile),
+          true);
+  flatbuffers::CompiledSchema schema;
+  auto include_test_path =
+      flatbuffers::ConCatPathFileName(test_data_path, "include_test");
+  const char *include_directories[] = { test_data_path.c_str(),
+                                        include_test_path.c_str(), nullptr };
+  TEST_EQ(schema.Load(schemafile.c_str(), include_directories), true);
+  TEST_NOTNULL(schema.root_struct_def());
+
+  // Each thread has its own contexts, sharing the schema.
+  auto round_trip = [&]() {
+    flatbuffers::JsonIngester ingester(schema.parser());
+    flatbuffers::JsonPrinter printer(schema);
+    for (int i = 0; i < 10; i++) {
+      if (!ingester.Parse(jsonfile.c_str()) ||
+          !printer.Print(ingester.builder_.GetBufferPointer()) ||
+          printer.text_ != jsonfile)
+        return false;
+    }
+    return true;
+  };
+  // clang-format off
+  #ifndef FLATBUFFERS_CPP98_STL
+    std::vector<std::thread> threads;
+    bool results[4];
+    for (int t = 0; t < 4; t++) {
+      threads.push_back(std::thread([&, t]() { results[t] = round_trip(); }));
+    }
+    for (auto it = threads.begin(); it != threads.end(); ++it) it->join();
+    for (int t = 0; t < 4; t++) TEST_EQ(results[t], true);
+  #else
+    TEST_EQ(round_trip(), true);
+  #endif
+  // clang-format on
+
+  flatbuffers::CompiledSchema data;
+  TEST_EQ(data.Load("table T { a:int; } root_type T; { a: 1 }"), false);
+  TEST_EQ_STR(data.error().c_str(), "schema contains JSON data");
+}
+
+void DeserializeSchemaTest() {
+  std::string schemafile;
+  std::string jsonfile;
+  TEST_EQ(flatbuffers::LoadFile((test_data_path + "monster_test.fbs").c_str(),
+                                false, &schemafile),
+          true);
+  TEST_EQ(flatbuffers::LoadFile(
+              (test_data_path + "monsterdata_test.golden").c_str(), false,
+              &jsonfile),
+          true);
+  flatbuffers::IDLOptions opts;
+  opts.binary_schema_builtins = true;
+  flatbuffers::Parser parser(opts);
+  auto include_test_path =
+      flatbuffers::ConCatPathFileName(test_data_path, "include_test");
+  const char *include_directories[] = { test_data_path.c_str(),
+                                        include_test_path.c_str(), nullptr };
+  TEST_EQ(parser.Parse(schemafile.c_str(), include_directories), true);
+  parser.Serialize();
+  std::string bfbs(
+      reinterpret_cast<const char *>(parser.builder_.GetBufferPointer()),
+      parser.builder_.GetSize());
+
+  flatbuffers::Parser deserialized(opts);
+  auto ok = deserialized.Deserialize(
+      reinterpret_cast<const uint8_t *>(bfbs.data()), bfbs.size());
+  if (!ok) TEST_OUTPUT_LINE("%s", deserialized.error_.c_str());
+  TEST_EQ(ok, true);
+  TEST_NOTNULL(deserialized.root_struct_def_);
+  TEST_EQ_STR(deserialized.root_struct_def_->name.c_str(), "Monster");
+  TEST_EQ_STR(deserialized.file_identifier_.c_str(), "MONS");
+
+  // Serializing again gives the same schema, though not byte for byte since
+  // definitions are stored in a different order.
+  deserialized.Serialize();
+  TEST_EQ(deserialized.builder_.GetSize(), bfbs.size());
+  auto schema1 = reflection::GetSchema(bfbs.data());
+  auto schema2 =
+      reflection::GetSchema(deserialized.builder_.GetBufferPointer());
+  TEST_EQ(schema1->objects()->size(), schema2->objects()->size());
+  for (flatbuffers::uoffset_t i = 0; i < schema1->objects()->size(); i++) {
+    auto object1 = schema1->objects()->Get(i);
+    auto object2 = schema2->objects()->Get(i);
+    TEST_EQ_STR(object1->name()->c_str(), object2->name()->c_str());
+    TEST_EQ(object1->bytesize(), object2->bytesize());
+    TEST_EQ(object1->fields()->size(), object2->fields()->size());
+    for (flatbuffers::uoffset_t j = 0; j < object1->fields()->size(); j++) {
+      auto field1 = object1->fields()->Get(j);
+      auto field2 = object2->fields()->Get(j);
+      TEST_EQ_STR(field1->name()->c_str(), field2->name()->c_str());
+      TEST_EQ(field1->offset(), field2->offset());
+      TEST_EQ(field1->type()->index(), field2->type()->index());
+      TEST_EQ(field1->default_integer(), field2->default_integer());
+      TEST_EQ(field1->default_real(), field2->default_real());
+    }
+  }
+  TEST_EQ(schema1->enums()->size(), schema2->enums()->size());
+
+  // JSON is parsed to the same binary, and generated the same way.
+  TEST_EQ(parser.Parse(jsonfile.c_str(), include_directories), true);
+  TEST_EQ(deserialized.Parse(jsonfile.c_str()), true);
+  TEST_EQ(deserialized.builder_.GetSize(), parser.builder_.GetSize());
+  TEST_EQ(memcmp(deserialized.builder_.GetBufferPointer(),
+                 parser.builder_.GetBufferPointer(), parser.builder_.GetSize()),
+          0);
+  std::string jsongen;
+  TEST_EQ(GenerateText(deserialized, deserialized.builder_.GetBufferPointer(),
+                       &jsongen),
+          true);
+  TEST_EQ_STR(jsongen.c_str(), jsonfile.c_str());
+
+  // Also through a CompiledSchema.
+  flatbuffers::CompiledSchema schema(opts);
+  TEST_EQ(schema.LoadBinary(reinterpret_cast<const uint8_t *>(bfbs.data()),
+                            bfbs.size()),
+          true);
+  flatbuffers::JsonIngester ingester(schema.parser());
+  TEST_EQ(ingester.Parse(jsonfile.c_str()), true);
+  TEST_EQ(ingester.builder_.GetSize(), parser.builder_.GetSize());
+
+  // Size prefixed data doesn't make the schema itself size prefixed.
+  flatbuffers::IDLOptions prefixed_opts = opts;
+  prefixed_opts.size_prefixed = true;
+  flatbuffers::Parser prefixed(prefixed_opts);
+  ok = prefixed.Deserialize(reinterpret_cast<const uint8_t *>(bfbs.data()),
+                            bfbs.size());
+  if (!ok) TEST_OUTPUT_LINE("%s", prefixed.error_.c_str());
+  TEST_EQ(ok, true);
+  TEST_EQ_STR(prefixed.root_struct_def_->name.c_str(), "Monster");
+
+  // Definitions must not clash with existing ones.
+  TEST_EQ(deserialized.Deserialize(
+              reinterpret_cast<const uint8_t *>(bfbs.data()), bfbs.size()),
+          false);
+}
+
+static bool AppendTextChunk(void *context, const char *data, size_t size) {
+  auto chunks = reinterpret_cast<std::vector<std::string> *>(context);
+  chunks->push_back(std::string(data, size));
+  return chunks->size() < 1000;
+}
+
+void TextSinkTest() {
+  std::string schemafile;
+  std::string jsonfile;
+  TEST_EQ(flatbuffers::LoadFile((test_data_path + "monster_test.fbs").c_str(),
+                                false, &schemafile),
+          true);
+  TEST_EQ(flatbuffers::LoadFile(
+              (test_data_path + "monsterdata_test.golden").c_str(), false,
+              &jsonfile),
+          true);
+  flatbuffers::Parser parser;
+  auto include_test_path =
+      flatbuffers::ConCatPathFileName(test_data_path, "include_test");
+  const char *include_directories[] = { test_data_path.c_str(),
+                                        include_test_path.c_str(), nullptr };
+  TEST_EQ(parser.Parse(schemafile.c_str(), include_directories), true);
+  TEST_EQ(parser.Parse(jsonfile.c_str(), include_directories), true);
+  auto buf = parser.builder_.GetBufferPointer();
+
+  // Small buffers split the text into many chunks, which add up to the same
+  // text as GenerateText into a string.
+  std::vector<std::string> chunks;
+  flatbuffers::CallbackTextSink sink(AppendTextChunk, &chunks, 64);
+  TEST_EQ(GenerateText(parser, buf, &sink), true);
+  TEST_EQ(chunks.size() > 10, true);
+  std::string text;
+  for (auto it = chunks.begin(); it != chunks.end(); ++it) {
+    TEST_EQ(it->size() < 64 + 64, true);
+    text += *it;
+  }
+  TEST_EQ_STR(text.c_str(), jsonfile.c_str());
+
+  // The sink can be reused without growing its buffer.
+  auto capacity = sink.buffer().capacity();
+  chunks.clear();
+  TEST_EQ(GenerateText(parser, buf, &sink), true);
+  TEST_EQ(sink.buffer().capacity(), capacity);
+  // And so is the printer, with the way each table is printed.
+  TEST_EQ(parser.text_printers_.size(), 1);
+
+  // A failing Write stops the generator.
+  chunks.resize(995);
+  TEST_EQ(GenerateText(parser, buf, &sink), false);
+  TEST_EQ(sink.buffer().empty(), true);
+
+  std::stringstream stream;
+  flatbuffers::StreamTextSink stream_sink(stream);
+  TEST_EQ(GenerateText(parser, buf, &stream_sink), true);
+  TEST_EQ_STR(stream.str().c_str(), jsonfile.c_str());
+}
+
+void ParallelTextTest() {
+  flatbuffers::Parser parser;
+  TEST_EQ(parser.Parse("table T { n:int; s:string; v:[T]; } root_type T;"),
+          true);
+  // Enough tables for several chunks, with nested vectors.
+  std::string json = "{ v: [";
+  for (int i = 0; i < 10000; i++) {
+    if (i) json += ",";
+    json += "{ n: " + flatbuffers::NumToString(i) + ", s: \"" +
+            flatbuffers::NumToString(i * 7) + "\", v: [{ n: 1 }, {}] }";
+  }
+  json += "] }";
+  TEST_EQ(parser.Parse(json.c_str()), true);
+  auto buf = parser.builder_.GetBufferPointer();
+
+  std::string serial;
+  TEST_EQ(GenerateText(parser, buf, &serial), true);
+  // Chunks of equal and unequal sizes.
+  for (size_t num_threads = 3; num_threads <= 4; num_threads++) {
+    parser.opts.num_threads = num_threads;
+    std::string parallel;
+    TEST_EQ(GenerateText(parser, buf, &parallel), true);
+    TEST_EQ(parallel == serial, true);
+  }
+
+  std::vector<std::string> chunks;
+  flatbuffers::CallbackTextSink sink(AppendTextChunk, &chunks, 16384);
+  TEST_EQ(GenerateText(parser, buf, &sink), true);
+  std::string text;
+  for (auto it = chunks.begin(); it != chunks.end(); ++it) text += *it;
+  TEST_EQ(text == serial, true);
+}
+
+void ArenaTest() {
+  flatbuffers::Arena arena(256);
+  TEST_EQ(arena.allocated(), 0);
+  auto a = arena.Allocate(1);
+  auto b = arena.Allocate(1000);  // Larger than a block.
+  TEST_EQ(reinterpret_cast<size_t>(a) % flatbuffers::Arena::kAlignment, 0);
+  TEST_EQ(reinterpret_cast<size_t>(b) % flatbuffers::Arena::kAlignment, 0);
+  TEST_EQ(arena.allocated(), 16 + 1008);
+  arena.Reset();
+  TEST_EQ(arena.allocated(), 0);
+  // Blocks are reused after a Reset.
+  TEST_EQ(arena.Allocate(1) == a, true);
+
+  typedef std::vector<int, flatbuffers::ArenaAllocator<int>> ArenaVector;
+  {
+    flatbuffers::ArenaScope scope(&arena);
+    TEST_EQ(flatbuffers::CurrentArena() == &arena, true);
+    ArenaVector v;
+    for (int i = 0; i < 100; i++) v.push_back(i);
+    flatbuffers::ArenaString s("an arena string that is too long for SSO");
+    TEST_EQ(v[99], 99);
+    TEST_EQ_STR(s.c_str(), "an arena string that is too long for SSO");
+    TEST_EQ(arena.allocated() > 400 + s.size(), true);
+    // Builders accept vectors with any allocator.
+    flatbuffers::FlatBufferBuilder fbb;
+    auto vec = fbb.CreateVector(v);
+    fbb.Finish(vec);
+    auto read = flatbuffers::GetRoot<flatbuffers::Vector<int>>(
+        fbb.GetBufferPointer());
+    TEST_EQ(read->size(), 100);
+    TEST_EQ(read->Get(42), 42);
+  }
+  TEST_EQ(flatbuffers::CurrentArena() == nullptr, true);
+  // Without a current arena, memory comes from (and goes back to) the heap.
+  auto allocated = arena.allocated();
+  ArenaVector heap(1000, 1);
+  TEST_EQ(arena.allocated(), allocated);
+  arena.Reset();
+}
+
+void ArenaObjectApiTest() {
+  using namespace MyGame::ArenaTest;
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<flatbuffers::Offset<Item>> items;
+  for (int i = 0; i < 20; i++) {
+    items.push_back(CreateItemDirect(
+        fbb, i, ("an item label too long for SSO " + flatbuffers::NumToString(i))
+                    .c_str()));
+  }
+  std::vector<int32_t> counts(100, 7);
+  std::vector<std::string> tags(10, "a tag that is too long for SSO");
+  FinishInventoryBuffer(
+      fbb, CreateInventory(fbb, fbb.CreateString("inventory"),
+                           fbb.CreateVector(items), fbb.CreateVector(counts),
+                           fbb.CreateVectorOfStrings(tags),
+                           CreateItemDirect(fbb, 42, "best")));
+  auto inventory = GetInventory(fbb.GetBufferPointer());
+
+  flatbuffers::Arena arena;
+  flatbuffers::FlatBufferBuilder repacked;
+  for (int round = 0; round < 3; round++) {
+    // Once the arena has its blocks and the builder its buffer, unpacking
+    // and packing again doesn't touch the heap.
+    auto allocations = heap_allocations;
+    auto unpacked = flatbuffers::UnPackInArena(inventory, &arena);
+    TEST_EQ(arena.allocated() > 0, true);
+    TEST_EQ_STR(unpacked->name.c_str(), "inventory");
+    TEST_EQ(unpacked->items.size(), 20);
+    TEST_EQ(unpacked->items[19]->id, 19);
+    TEST_EQ_STR(unpacked->items[19]->label.c_str(),
+                "an item label too long for SSO 19");
+    TEST_EQ(unpacked->counts.size(), 100);
+    TEST_EQ(unpacked->counts[99], 7);
+    TEST_EQ(unpacked->tags.size(), 10);
+    TEST_EQ_STR(unpacked->best->label.c_str(), "best");
+
+    repacked.Clear();
+    repacked.Finish(Inventory::Pack(repacked, unpacked));
+    flatbuffers::Verifier verifier(repacked.GetBufferPointer(),
+                                   repacked.GetSize());
+    TEST_EQ(VerifyInventoryBuffer(verifier), true);
+    TEST_EQ(GetInventory(repacked.GetBufferPointer())->Equals(*inventory),
+            true);
+
+    // The objects don't need to be destroyed, Reset frees them all.
+    arena.Reset();
+    if (round) TEST_EQ(heap_allocations, allocations);
+  }
+}
+
+void UnPackToResetTest() {
+  using namespace MyGame::CppTypesTest;
+  flatbuffers::FlatBufferBuilder full;
+  FinishNodeBuffer(full, CreateNodeDirect(full, CreateLeaf(full, 7), "label",
+                                          "name"));
+  flatbuffers::FlatBufferBuilder empty;
+  FinishNodeBuffer(empty, CreateNode(empty));
+
+  NodeT node;
+  GetNode(full.GetBufferPointer())->UnPackTo(&node);
+  TEST_NOTNULL(node.shared.get());
+  TEST_EQ(node.shared->id, 7);
+  TEST_EQ_STR(node.label.c_str(), "label");
+  TEST_EQ_STR(node.name.c_str(), "name");
+  // Unpacking a buffer without the fields into the same object resets them,
+  // whatever their pointer or string type.
+  GetNode(empty.GetBufferPointer())->UnPackTo(&node);
+  TEST_EQ(node.shared.get() == nullptr, true);
+  TEST_EQ(node.label.empty(), true);
+  TEST_EQ(node.name.empty(), true);
+}
+
+void ViewTypesTest() {
+  flatbuffers::FlatBufferBuilder fbb;
+  int16_t values[] = { 1, -2, 300 };
+  auto vec = fbb.CreateVector(values, 3);
+  fbb.Finish(vec);
+  auto read =
+      flatbuffers::GetRoot<flatbuffers::Vector<int16_t>>(fbb.GetBufferPointer());
+  flatbuffers::VectorView<int16_t> view(*read);
+  TEST_EQ(view.size(), 3);
+  TEST_EQ(view[2], 300);
+  TEST_EQ(view.data() == read->data(), true);
+  // Views are copied as-is into a new buffer.
+  flatbuffers::FlatBufferBuilder fbb2;
+  fbb2.Finish(fbb2.CreateVector(view));
+  auto copy = flatbuffers::GetRoot<flatbuffers::Vector<int16_t>>(
+      fbb2.GetBufferPointer());
+  TEST_EQ(flatbuffers::VectorView<int16_t>(*copy) == view, true);
+  TEST_EQ(copy->Get(1), -2);
+  TEST_EQ(flatbuffers::VectorView<int16_t>() == view, false);
+
+  std::string str = "hello";
+  flatbuffers::StringView sv(str);
+  TEST_EQ(sv.length(), 5);
+  TEST_EQ(sv == flatbuffers::StringView("hello"), true);
+  TEST_EQ(sv == flatbuffers::StringView("hell"), false);
+  TEST_EQ(flatbuffers::StringView().empty(), true);
+  flatbuffers::FlatBufferBuilder fbb3;
+  fbb3.Finish(fbb3.CreateString(sv));
+  TEST_EQ_STR(flatbuffers::GetRoot<flatbuffers::String>(fbb3.GetBufferPointer())
+                  ->c_str(),
+              "hello");
+}
+
+void ViewsObjectApiTest() {
+  using namespace MyGame::ViewsTest;
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<double> weights(50, 1.5);
+  std::vector<uint16_t> counts;
+  for (uint16_t i = 0; i < 100; i++) counts.push_back(i);
+  std::vector<uint8_t> flags(3, 1);
+  std::vector<int8_t> kinds(2, Kind_Large);
+  std::vector<flatbuffers::Offset<flatbuffers::String>> tags;
+  std::vector<flatbuffers::Offset<Part>> parts;
+  for (int i = 0; i < 5; i++) {
+    auto label = "part " + flatbuffers::NumToString(i);
+    tags.push_back(fbb.CreateString("tag " + label));
+    parts.push_back(CreatePartDirect(fbb, i, label.c_str()));
+  }
+  auto main = CreatePartDirect(fbb, 42, "main");
+  FinishAssemblyBuffer(
+      fbb, CreateAssemblyDirect(fbb, "assembly", &weights, &counts, &flags,
+                                &kinds, &tags, &parts, main));
+  auto assembly = GetAssembly(fbb.GetBufferPointer());
+
+  flatbuffers::unique_ptr<AssemblyT> unpacked(assembly->UnPack());
+  // Strings and vectors of plain scalars alias the buffer.
+  TEST_EQ_STR(unpacked->name.c_str(), "assembly");
+  TEST_EQ(unpacked->name.c_str(), assembly->name()->c_str());
+  TEST_EQ(unpacked->weights.size(), 50);
+  TEST_EQ(unpacked->weights[49], 1.5);
+  TEST_EQ(unpacked->weights.data(), assembly->weights()->data());
+  TEST_EQ(unpacked->counts.size(), 100);
+  TEST_EQ(unpacked->counts[99], 99);
+  TEST_EQ(unpacked->counts.data(), assembly->counts()->data());
+  TEST_EQ(unpacked->tags.size(), 5);
+  TEST_EQ_STR(unpacked->tags[3].c_str(), "tag part 3");
+  TEST_EQ(unpacked->tags[3].c_str(), assembly->tags()->Get(3)->c_str());
+  TEST_EQ(unpacked->parts.size(), 5);
+  TEST_EQ(unpacked->parts[4]->id, 4);
+  TEST_EQ(unpacked->parts[4]->label.c_str(),
+          assembly->parts()->Get(4)->label()->c_str());
+  TEST_EQ(unpacked->main->label.c_str(), assembly->main()->label()->c_str());
+  // Bools and enums are copied.
+  TEST_EQ(unpacked->flags.size(), 3);
+  TEST_EQ(unpacked->flags[2], true);
+  TEST_EQ(unpacked->kinds.size(), 2);
+  TEST_EQ(unpacked->kinds[1], Kind_Large);
+
+  // Mutating the buffer shows through the views.
+  GetMutableAssembly(fbb.GetBufferPointer())
+      ->mutable_counts()
+      ->Mutate(0, 1000);
+  TEST_EQ(unpacked->counts[0], 1000);
+
+  // Packing copies what the views refer to into the new buffer.
+  flatbuffers::FlatBufferBuilder repacked;
+  repacked.Finish(Assembly::Pack(repacked, unpacked.get()));
+  flatbuffers::Verifier verifier(repacked.GetBufferPointer(),
+                                 repacked.GetSize());
+  TEST_EQ(VerifyAssemblyBuffer(verifier), true);
+  auto repacked_assembly = GetAssembly(repacked.GetBufferPointer());
+  TEST_EQ(repacked_assembly->Equals(*assembly), true);
+  TEST_EQ(repacked_assembly->counts()->Get(0), 1000);
+
+  // Unpacking the new buffer gives equal views, of that buffer.
+  flatbuffers::unique_ptr<AssemblyT> unpacked_again(
+      repacked_assembly->UnPack());
+  TEST_EQ(unpacked_again->name == unpacked->name, true);
+  TEST_EQ(unpacked_again->weights == unpacked->weights, true);
+  TEST_EQ(unpacked_again->counts == unpacked->counts, true);
+  TEST_EQ(unpacked_again->tags == unpacked->tags, true);
+  TEST_EQ(unpacked_again->weights.data(),
+          repacked_assembly->weights()->data());
+
+  // Views can be pointed at other data, which Pack copies too.
+  std::string renamed = "renamed";
+  unpacked->name = flatbuffers::StringView(renamed);
+  const uint16_t few_counts[] = { 7, 8 };
+  unpacked->counts = flatbuffers::VectorView<uint16_t>(few_counts, 2);
+  repacked.Clear();
+  repacked.Finish(Assembly::Pack(repacked, unpacked.get()));
+  repacked_assembly = GetAssembly(repacked.GetBufferPointer());
+  TEST_EQ_STR(repacked_assembly->name()->c_str(), "renamed");
+  TEST_EQ(repacked_assembly->counts()->size(), 2);
+  TEST_EQ(repacked_assembly->counts()->Get(1), 8);
+}
+
 int FlatBufferTests() {
   // clang-format off
   #if defined(FLATBUFFERS_MEMORY_LEAK_TRACKING) && \
@@ -2399,11 +3925,20 @@ int FlatBufferTests() {
   MutateFlatBuffersTest(flatbuf.data(), flatbuf.size());
 
   ObjectFlatBuffersTest(flatbuf.data());
+  PackedSizeUpperBoundTest(flatbuf.data());
+  HashTest(flatbuf.data());
+  PresenceMaskTest(flatbuf.data());
+
+  VTableCacheTest(flatbuf.data());
 
   MiniReflectFlatBuffersTest(flatbuf.data());
 
   SizePrefixedTest();
 
+  RecordStreamTest();
+
+  JsonLinesTest();
+
   #ifndef FLATBUFFERS_NO_FILE_TESTS
     #ifdef FLATBUFFERS_TEST_PATH_PREFIX
       test_data_path = FLATBUFFERS_STRING(FLATBUFFERS_TEST_PATH_PREFIX) +
@@ -2411,9 +3946,16 @@ int FlatBufferTests() {
     #endif
     ParseAndGenerateTextTest();
     ReflectionTest(flatbuf.data(), flatbuf.size());
+    ColumnProjectionTest(flatbuf.data());
+    ReflectionDiffTest(flatbuf.data(), flatbuf.size());
     ParseProtoTest();
     UnionVectorTest();
     LoadVerifyBinaryTest();
+    MappedFileTest();
+    JsonIngesterTest();
+    CompiledSchemaTest();
+    DeserializeSchemaTest();
+    TextSinkTest();
   #endif
   // clang-format on
 
@@ -2423,6 +3965,7 @@ int FlatBufferTests() {
   ErrorTest();
   ValueTest();
   EnumStringsTest();
+  EnumLookupTest();
   EnumNamesTest();
   EnumOutOfRangeTest();
   IntegerOutOfRangeTest();
@@ -2440,10 +3983,21 @@ int FlatBufferTests() {
   TypeAliasesTest();
   EndianSwapTest();
   JsonDefaultTest();
+  JsonPrinterTest();
+  ParallelTextTest();
   FlexBuffersTest();
   UninitializedVectorTest();
   EqualOperatorTest();
+  ArenaTest();
+  ArenaObjectApiTest();
+  UnPackToResetTest();
+  ViewTypesTest();
+  ViewsObjectApiTest();
+  LookupByKeyTest();
+  HashIndexTest();
+  BufferTemplateTest();
   NumericUtilsTest();
+  NumToStringTest();
   IsAsciiUtilsTest();
   ValidFloatTest();
   InvalidFloatTest();
@@ -0,0 +1,147 @@
+/*
+ * Copyright 2018 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <new>
+#include <thread>
+
+#include "flatbuffers/idl.h"
+#include "flatbuffers/util.h"
+
+// Compares GenerateText into a string with GenerateText into a TextSink, and
+// with a JsonPrinter that is reused (on one thread and on all cores), on a
+// large FlatBuffer made of copies of monsterdata_test.golden, and counts the
+// memory allocations of each. Run from the root directory, or pass the path to
+// the tests directory:
+//   flatbenchmarktext [tests_dir] [copies] [threads]
+
+static size_t allocations = 0;
+
+void *operator new(size_t size) {
+  allocations++;
+  if (auto p = malloc(size ? size : 1)) return p;
+  throw std::bad_alloc();
+}
+void operator delete(void *p) noexcept { free(p); }
+
+static bool CountBytes(void *context, const char *, size_t size) {
+  *reinterpret_cast<size_t *>(context) += size;
+  return true;
+}
+
+template<typename F>
+double MegabytesPerSecond(size_t size, int runs, size_t *allocs, F f) {
+  auto start_allocations = allocations;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < runs; i++) {
+    if (!f()) return 0;
+  }
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  *allocs = (allocations - start_allocations) / runs;
+  return static_cast<double>(size) * runs / (1024 * 1024) / elapsed.count();
+}
+
+int main(int argc, const char *argv[]) {
+  std::string tests_dir = argc > 1 ? argv[1] : "tests/";
+  int copies = argc > 2 ? atoi(argv[2]) : 20000;
+  size_t threads = argc > 3 ? static_cast<size_t>(atoi(argv[3]))
+                            : std::thread::hardware_concurrency();
+  const int kRuns = 10;
+
+  std::string schemafile;
+  std::string jsonfile;
+  if (!flatbuffers::LoadFile((tests_dir + "monster_test.fbs").c_str(), false,
+                             &schemafile) ||
+      !flatbuffers::LoadFile((tests_dir + "monsterdata_test.golden").c_str(),
+                             false, &jsonfile)) {
+    printf("couldn't load files from %s\n", tests_dir.c_str());
+    return 1;
+  }
+  flatbuffers::Parser parser;
+  auto include_test_path =
+      flatbuffers::ConCatPathFileName(tests_dir, "include_test");
+  const char *include_directories[] = { tests_dir.c_str(),
+                                        include_test_path.c_str(), nullptr };
+  if (!parser.Parse(schemafile.c_str(), include_directories)) {
+    printf("%s\n", parser.error_.c_str());
+    return 1;
+  }
+  std::string json = "{\n  name: \"Root\",\n  testarrayoftables: [\n";
+  for (int i = 0; i < copies; i++) {
+    if (i) json += ",\n";
+    json += jsonfile.substr(0, jsonfile.find_last_of('}') + 1);
+  }
+  json += "\n  ]\n}\n";
+  if (!parser.Parse(json.c_str(), include_directories)) {
+    printf("%s\n", parser.error_.c_str());
+    return 1;
+  }
+  auto buf = parser.builder_.GetBufferPointer();
+
+  std::string text;
+  if (!GenerateText(parser, buf, &text)) return 1;
+  auto size = text.size();
+
+  size_t string_allocations = 0;
+  auto string_speed =
+      MegabytesPerSecond(size, kRuns, &string_allocations, [&]() {
+        std::string t;
+        return GenerateText(parser, buf, &t);
+      });
+  size_t written = 0;
+  flatbuffers::CallbackTextSink sink(CountBytes, &written);
+  size_t sink_allocations = 0;
+  auto sink_speed = MegabytesPerSecond(size, kRuns, &sink_allocations, [&]() {
+    return GenerateText(parser, buf, &sink);
+  });
+  flatbuffers::JsonPrinter printer(parser);
+  size_t printer_allocations = 0;
+  auto printer_speed =
+      MegabytesPerSecond(size, kRuns, &printer_allocations,
+                         [&]() { return printer.Print(buf, &sink); });
+  std::string parallel_text;
+  parser.opts.num_threads = std::max(threads, static_cast<size_t>(1));
+  if (!GenerateText(parser, buf, &parallel_text) || parallel_text != text) {
+    printf("parallel text differs\n");
+    return 1;
+  }
+  size_t parallel_allocations = 0;
+  auto parallel_speed =
+      MegabytesPerSecond(size, kRuns, &parallel_allocations,
+                         [&]() { return printer.Print(buf, &sink); });
+  if (written != size * kRuns * 3) {
+    printf("sink wrote %zu bytes, expected %zu\n", written,
+           size * kRuns * 3);
+    return 1;
+  }
+
+  printf("text:               %.1f MB\n",
+         static_cast<double>(size) / (1024 * 1024));
+  printf("std::string:        %.1f MB/s, %zu allocations\n", string_speed,
+         string_allocations);
+  printf("TextSink:           %.1f MB/s, %zu allocations\n", sink_speed,
+         sink_allocations);
+  printf("JsonPrinter:        %.1f MB/s, %zu allocations\n", printer_speed,
+         printer_allocations);
+  printf("JsonPrinter, %2zu threads: %.1f MB/s, %zu allocations\n",
+         parser.opts.num_threads, parallel_speed, parallel_allocations);
+  return string_speed > 0 && sink_speed > 0 && printer_speed > 0 &&
+                 parallel_speed > 0
+             ? 0
+             : 1;
+}
@@ -5,6 +5,7 @@
 #define FLATBUFFERS_GENERATED_UNIONVECTOR_H_
 
 #include "flatbuffers/flatbuffers.h"
+#include "flatbuffers/hash.h"
 
 struct Attacker;
 struct AttackerT;
@@ -92,7 +93,10 @@ struct CharacterUnion {
   void Reset();
 
   static void *UnPack(const void *obj, Character type, const flatbuffers::resolver_function_t *resolver);
+  void UnPackTo(const void *obj, Character _type, const flatbuffers::resolver_function_t *resolver);
   flatbuffers::Offset<void> Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
+  size_t GetPackedSizeUpperBound() const;
+  size_t Hash() const;
 
   AttackerT *AsMuLan() {
     return type == Character_MuLan ?
@@ -182,6 +186,8 @@ inline bool operator==(const CharacterUnion &lhs, const CharacterUnion &rhs) {
 }
 bool VerifyCharacter(flatbuffers::Verifier &verifier, const void *obj, Character type);
 bool VerifyCharacterVector(flatbuffers::Verifier &verifier, const flatbuffers::Vector<flatbuffers::Offset<void>> *values, const flatbuffers::Vector<uint8_t> *types);
+size_t HashCharacter(const void *obj, Character type);
+bool EqualsCharacter(const void *a, const void *b, Character type);
 
 FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) Rapunzel FLATBUFFERS_FINAL_CLASS {
  private:
@@ -236,6 +242,7 @@ inline bool operator==(const BookReader &lhs, const BookReader &rhs) {
 struct AttackerT : public flatbuffers::NativeTable {
   typedef Attacker TableType;
   int32_t sword_attack_damage;
+  size_t Hash() const;
   AttackerT()
       : sword_attack_damage(0) {
   }
@@ -260,14 +267,20 @@ struct Attacker FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   bool mutate_sword_attack_damage(int32_t _sword_attack_damage) {
     return SetField<int32_t>(VT_SWORD_ATTACK_DAMAGE, _sword_attack_damage, 0);
   }
+  flatbuffers::FieldPresence<1> PresenceMask() const {
+    return flatbuffers::FieldPresence<1>(this);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<int32_t>(verifier, VT_SWORD_ATTACK_DAMAGE) &&
            verifier.EndTable();
   }
+  size_t Hash() const;
+  bool Equals(const Attacker &_o) const;
   AttackerT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(AttackerT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static flatbuffers::Offset<Attacker> Pack(flatbuffers::FlatBufferBuilder &_fbb, const AttackerT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  static flatbuffers::Offset<Attacker> Pack(flatbuffers::FlatBufferBuilder &_fbb, const AttackerT &_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
 struct AttackerBuilder {
@@ -296,12 +309,31 @@ inline flatbuffers::Offset<Attacker> CreateAttacker(
   return builder_.Finish();
 }
 
+class AttackerBufferTemplate : public flatbuffers::BufferTemplate {
+ public:
+  AttackerBufferTemplate(const uint8_t *buf, size_t size)
+      : flatbuffers::BufferTemplate(buf, size) {
+    auto root = flatbuffers::GetRoot<Attacker>(data());
+    sword_attack_damage_ = FieldPosition(root, Attacker::VT_SWORD_ATTACK_DAMAGE);
+  }
+  bool mutate_sword_attack_damage(uint8_t *buf, int32_t _sword_attack_damage) const {
+    if (!sword_attack_damage_) return false;
+    flatbuffers::WriteScalar<int32_t>(buf + sword_attack_damage_, _sword_attack_damage);
+    return true;
+  }
+
+ private:
+  flatbuffers::uoffset_t sword_attack_damage_;
+};
+
 flatbuffers::Offset<Attacker> CreateAttacker(flatbuffers::FlatBufferBuilder &_fbb, const AttackerT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const AttackerT &_o);
 
 struct MovieT : public flatbuffers::NativeTable {
   typedef Movie TableType;
   CharacterUnion main_character;
   std::vector<CharacterUnion> characters;
+  size_t Hash() const;
   MovieT() {
   }
 };
@@ -365,6 +397,9 @@ struct Movie FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   flatbuffers::Vector<flatbuffers::Offset<void>> *mutable_characters() {
     return GetPointer<flatbuffers::Vector<flatbuffers::Offset<void>> *>(VT_CHARACTERS);
   }
+  flatbuffers::FieldPresence<4> PresenceMask() const {
+    return flatbuffers::FieldPresence<4>(this);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<uint8_t>(verifier, VT_MAIN_CHARACTER_TYPE) &&
@@ -377,9 +412,12 @@ struct Movie FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyCharacterVector(verifier, characters(), characters_type()) &&
            verifier.EndTable();
   }
+  size_t Hash() const;
+  bool Equals(const Movie &_o) const;
   MovieT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(MovieT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static flatbuffers::Offset<Movie> Pack(flatbuffers::FlatBufferBuilder &_fbb, const MovieT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  static flatbuffers::Offset<Movie> Pack(flatbuffers::FlatBufferBuilder &_fbb, const MovieT &_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 };
 
 struct MovieBuilder {
@@ -437,7 +475,15 @@ inline flatbuffers::Offset<Movie> CreateMovieDirect(
       characters ? _fbb.CreateVector<flatbuffers::Offset<void>>(*characters) : 0);
 }
 
+class MovieBufferTemplate : public flatbuffers::BufferTemplate {
+ public:
+  MovieBufferTemplate(const uint8_t *buf, size_t size)
+      : flatbuffers::BufferTemplate(buf, size) {
+  }
+};
+
 flatbuffers::Offset<Movie> CreateMovie(flatbuffers::FlatBufferBuilder &_fbb, const MovieT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const MovieT &_o);
 
 inline AttackerT *Attacker::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
   auto _o = new AttackerT();
@@ -455,6 +501,11 @@ inline flatbuffers::Offset<Attacker> Attacker::Pack(flatbuffers::FlatBufferBuild
   return CreateAttacker(_fbb, _o, _rehasher);
 }
 
+inline flatbuffers::Offset<Attacker> Attacker::Pack(flatbuffers::FlatBufferBuilder &_fbb, const AttackerT &_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(_o));
+  return CreateAttacker(_fbb, &_o, _rehasher);
+}
+
 inline flatbuffers::Offset<Attacker> CreateAttacker(flatbuffers::FlatBufferBuilder &_fbb, const AttackerT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
@@ -465,6 +516,28 @@ inline flatbuffers::Offset<Attacker> CreateAttacker(flatbuffers::FlatBufferBuild
       _sword_attack_damage);
 }
 
+inline size_t GetPackedSizeUpperBound(const AttackerT &_o) {
+  (void)_o;
+  size_t _size = 32;
+  return _size;
+}
+
+inline size_t Attacker::Hash() const {
+  uint64_t _h = 0;
+  { auto _e = GetField<int32_t>(VT_SWORD_ATTACK_DAMAGE, 0); if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_SWORD_ATTACK_DAMAGE), _e); }
+  return static_cast<size_t>(_h);
+}
+
+inline size_t AttackerT::Hash() const {
+  uint64_t _h = 0;
+  { auto _e = sword_attack_damage; if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, Attacker::VT_SWORD_ATTACK_DAMAGE), _e); }
+  return static_cast<size_t>(_h);
+}
+
+inline bool Attacker::Equals(const Attacker &_o) const {
+  return flatbuffers::ScalarEquals(GetField<int32_t>(VT_SWORD_ATTACK_DAMAGE, 0), _o.GetField<int32_t>(VT_SWORD_ATTACK_DAMAGE, 0));
+}
+
 inline MovieT *Movie::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
   auto _o = new MovieT();
   UnPackTo(_o, _resolver);
@@ -474,16 +547,19 @@ inline MovieT *Movie::UnPack(const flatbuffers::resolver_function_t *_resolver)
 inline void Movie::UnPackTo(MovieT *_o, const flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = main_character_type(); _o->main_character.type = _e; };
-  { auto _e = main_character(); if (_e) _o->main_character.value = CharacterUnion::UnPack(_e, main_character_type(), _resolver); };
-  { auto _e = characters_type(); if (_e) { _o->characters.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->characters[_i].type = static_cast<Character>(_e->Get(_i)); } } };
-  { auto _e = characters(); if (_e) { _o->characters.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->characters[_i].value = CharacterUnion::UnPack(_e->Get(_i), characters_type()->GetEnum<Character>(_i), _resolver); } } };
+  { auto _e = main_character(); if (_e) { _o->main_character.UnPackTo(_e, main_character_type(), _resolver); } else { _o->main_character.Reset(); } };
+  { auto _e = characters(); if (_e) { _o->characters.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->characters[_i].UnPackTo(_e->Get(_i), characters_type()->GetEnum<Character>(_i), _resolver); } } else { _o->characters.clear(); } };
 }
 
 inline flatbuffers::Offset<Movie> Movie::Pack(flatbuffers::FlatBufferBuilder &_fbb, const MovieT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
   return CreateMovie(_fbb, _o, _rehasher);
 }
 
+inline flatbuffers::Offset<Movie> Movie::Pack(flatbuffers::FlatBufferBuilder &_fbb, const MovieT &_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(_o));
+  return CreateMovie(_fbb, &_o, _rehasher);
+}
+
 inline flatbuffers::Offset<Movie> CreateMovie(flatbuffers::FlatBufferBuilder &_fbb, const MovieT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
@@ -500,6 +576,38 @@ inline flatbuffers::Offset<Movie> CreateMovie(flatbuffers::FlatBufferBuilder &_f
       _characters);
 }
 
+inline size_t GetPackedSizeUpperBound(const MovieT &_o) {
+  (void)_o;
+  size_t _size = 94;
+  _size += _o.main_character.GetPackedSizeUpperBound();
+  _size += _o.characters.size() * 1;
+  _size += _o.characters.size() * 4;
+  for (size_t _i = 0; _i < _o.characters.size(); _i++) {
+    _size += _o.characters[_i].GetPackedSizeUpperBound();
+  }
+  return _size;
+}
+
+inline size_t Movie::Hash() const {
+  uint64_t _h = 0;
+  { auto _t = main_character_type(); if (_t != Character_NONE) _h = flatbuffers::HashCombine(flatbuffers::HashCombine(flatbuffers::HashCombine(_h, VT_MAIN_CHARACTER), static_cast<uint64_t>(_t)), HashCharacter(main_character(), _t)); }
+  { auto _e = characters(); auto _t = characters_type(); if (_e && _t && _e->size()) _h = flatbuffers::HashUnions(flatbuffers::HashCombine(_h, VT_CHARACTERS), *_e, *_t, HashCharacter); }
+  return static_cast<size_t>(_h);
+}
+
+inline size_t MovieT::Hash() const {
+  uint64_t _h = 0;
+  if (main_character.type != Character_NONE) _h = flatbuffers::HashCombine(flatbuffers::HashCombine(flatbuffers::HashCombine(_h, Movie::VT_MAIN_CHARACTER), static_cast<uint64_t>(main_character.type)), main_character.Hash());
+  { auto &_e = characters; if (!_e.empty()) _h = flatbuffers::HashUnions(flatbuffers::HashCombine(_h, Movie::VT_CHARACTERS), _e); }
+  return static_cast<size_t>(_h);
+}
+
+inline bool Movie::Equals(const Movie &_o) const {
+  return main_character_type() == _o.main_character_type() &&
+         EqualsCharacter(main_character(), _o.main_character(), main_character_type()) &&
+         flatbuffers::UnionsEqual(characters(), characters_type(), _o.characters(), _o.characters_type(), EqualsCharacter);
+}
+
 inline bool VerifyCharacter(flatbuffers::Verifier &verifier, const void *obj, Character type) {
   switch (type) {
     case Character_NONE: {
@@ -542,6 +650,67 @@ inline bool VerifyCharacterVector(flatbuffers::Verifier &verifier, const flatbuf
   return true;
 }
 
+inline size_t HashCharacter(const void *obj, Character type) {
+  if (!obj) return 0;
+  switch (type) {
+    case Character_MuLan: {
+      auto ptr = reinterpret_cast<const Attacker *>(obj);
+      return ptr->Hash();
+    }
+    case Character_Rapunzel: {
+      auto ptr = reinterpret_cast<const Rapunzel *>(obj);
+      return static_cast<size_t>(flatbuffers::HashBytes(0, ptr, sizeof(*ptr)));
+    }
+    case Character_Belle: {
+      auto ptr = reinterpret_cast<const BookReader *>(obj);
+      return static_cast<size_t>(flatbuffers::HashBytes(0, ptr, sizeof(*ptr)));
+    }
+    case Character_BookFan: {
+      auto ptr = reinterpret_cast<const BookReader *>(obj);
+      return static_cast<size_t>(flatbuffers::HashBytes(0, ptr, sizeof(*ptr)));
+    }
+    case Character_Other: {
+      auto ptr = reinterpret_cast<const flatbuffers::String *>(obj);
+      return static_cast<size_t>(flatbuffers::HashBytes(0, ptr->c_str(), ptr->size()));
+    }
+    case Character_Unused: {
+      auto ptr = reinterpret_cast<const flatbuffers::String *>(obj);
+      return static_cast<size_t>(flatbuffers::HashBytes(0, ptr->c_str(), ptr->size()));
+    }
+    default: return 0;
+  }
+}
+
+inline bool EqualsCharacter(const void *a, const void *b, Character type) {
+  if (!a || !b) return a == b;
+  switch (type) {
+    case Character_MuLan: {
+      return reinterpret_cast<const Attacker *>(a)
+          ->Equals(*reinterpret_cast<const Attacker *>(b));
+    }
+    case Character_Rapunzel: {
+      return memcmp(a, b, sizeof(Rapunzel)) == 0;
+    }
+    case Character_Belle: {
+      return memcmp(a, b, sizeof(BookReader)) == 0;
+    }
+    case Character_BookFan: {
+      return memcmp(a, b, sizeof(BookReader)) == 0;
+    }
+    case Character_Other: {
+      return flatbuffers::StringEquals(
+          reinterpret_cast<const flatbuffers::String *>(a),
+          reinterpret_cast<const flatbuffers::String *>(b));
+    }
+    case Character_Unused: {
+      return flatbuffers::StringEquals(
+          reinterpret_cast<const flatbuffers::String *>(a),
+          reinterpret_cast<const flatbuffers::String *>(b));
+    }
+    default: return true;
+  }
+}
+
 inline void *CharacterUnion::UnPack(const void *obj, Character type, const flatbuffers::resolver_function_t *resolver) {
   switch (type) {
     case Character_MuLan: {
@@ -572,6 +741,47 @@ inline void *CharacterUnion::UnPack(const void *obj, Character type, const flatb
   }
 }
 
+inline void CharacterUnion::UnPackTo(const void *obj, Character _type, const flatbuffers::resolver_function_t *resolver) {
+  if (value && type == _type) {
+    switch (type) {
+      case Character_MuLan: {
+        auto ptr = reinterpret_cast<const Attacker *>(obj);
+        ptr->UnPackTo(reinterpret_cast<AttackerT *>(value), resolver);
+        return;
+      }
+      case Character_Rapunzel: {
+        auto ptr = reinterpret_cast<const Rapunzel *>(obj);
+        *reinterpret_cast<Rapunzel *>(value) = *ptr;
+        return;
+      }
+      case Character_Belle: {
+        auto ptr = reinterpret_cast<const BookReader *>(obj);
+        *reinterpret_cast<BookReader *>(value) = *ptr;
+        return;
+      }
+      case Character_BookFan: {
+        auto ptr = reinterpret_cast<const BookReader *>(obj);
+        *reinterpret_cast<BookReader *>(value) = *ptr;
+        return;
+      }
+      case Character_Other: {
+        auto ptr = reinterpret_cast<const flatbuffers::String *>(obj);
+        reinterpret_cast<std::string *>(value)->assign(ptr->c_str(), ptr->size());
+        return;
+      }
+      case Character_Unused: {
+        auto ptr = reinterpret_cast<const flatbuffers::String *>(obj);
+        reinterpret_cast<std::string *>(value)->assign(ptr->c_str(), ptr->size());
+        return;
+      }
+      default: break;
+    }
+  }
+  Reset();
+  type = _type;
+  value = UnPack(obj, _type, resolver);
+}
+
 inline flatbuffers::Offset<void> CharacterUnion::Pack(flatbuffers::FlatBufferBuilder &_fbb, const flatbuffers::rehasher_function_t *_rehasher) const {
   switch (type) {
     case Character_MuLan: {
@@ -602,6 +812,64 @@ inline flatbuffers::Offset<void> CharacterUnion::Pack(flatbuffers::FlatBufferBui
   }
 }
 
+inline size_t CharacterUnion::GetPackedSizeUpperBound() const {
+  switch (type) {
+    case Character_MuLan: {
+      auto ptr = reinterpret_cast<const AttackerT *>(value);
+      return ::GetPackedSizeUpperBound(*ptr);
+    }
+    case Character_Rapunzel: {
+      return 7;
+    }
+    case Character_Belle: {
+      return 7;
+    }
+    case Character_BookFan: {
+      return 7;
+    }
+    case Character_Other: {
+      auto ptr = reinterpret_cast<const std::string *>(value);
+      return ptr->length() + 8;
+    }
+    case Character_Unused: {
+      auto ptr = reinterpret_cast<const std::string *>(value);
+      return ptr->length() + 8;
+    }
+    default: return 0;
+  }
+}
+
+inline size_t CharacterUnion::Hash() const {
+  if (!value) return 0;
+  switch (type) {
+    case Character_MuLan: {
+      auto ptr = reinterpret_cast<const AttackerT *>(value);
+      return ptr->Hash();
+    }
+    case Character_Rapunzel: {
+      auto ptr = reinterpret_cast<const Rapunzel *>(value);
+      return static_cast<size_t>(flatbuffers::HashBytes(0, ptr, sizeof(*ptr)));
+    }
+    case Character_Belle: {
+      auto ptr = reinterpret_cast<const BookReader *>(value);
+      return static_cast<size_t>(flatbuffers::HashBytes(0, ptr, sizeof(*ptr)));
+    }
+    case Character_BookFan: {
+      auto ptr = reinterpret_cast<const BookReader *>(value);
+      return static_cast<size_t>(flatbuffers::HashBytes(0, ptr, sizeof(*ptr)));
+    }
+    case Character_Other: {
+      auto ptr = reinterpret_cast<const std::string *>(value);
+      return static_cast<size_t>(flatbuffers::HashBytes(0, ptr->c_str(), ptr->length()));
+    }
+    case Character_Unused: {
+      auto ptr = reinterpret_cast<const std::string *>(value);
+      return static_cast<size_t>(flatbuffers::HashBytes(0, ptr->c_str(), ptr->length()));
+    }
+    default: return 0;
+  }
+}
+
 inline CharacterUnion::CharacterUnion(const CharacterUnion &u) FLATBUFFERS_NOEXCEPT : type(u.type), value(nullptr) {
   switch (type) {
     case Character_MuLan: {
@@ -813,4 +1081,20 @@ inline flatbuffers::unique_ptr<MovieT> UnPackMovie(
   return flatbuffers::unique_ptr<MovieT>(GetMovie(buf)->UnPack(res));
 }
 
+namespace std {
+
+template<> struct hash<AttackerT> {
+  size_t operator()(const AttackerT &_o) const {
+    return _o.Hash();
+  }
+};
+
+template<> struct hash<MovieT> {
+  size_t operator()(const MovieT &_o) const {
+    return _o.Hash();
+  }
+};
+
+}  // namespace std
+
 #endif  // FLATBUFFERS_GENERATED_UNIONVECTOR_H_
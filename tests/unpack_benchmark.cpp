@@ -0,0 +1,88 @@
+/*
+ * Copyright 2018 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <new>
+
+#include "flatbuffers/util.h"
+#include "monster_test_generated.h"
+
+// Compares unpacking monsterdata_test.mon into a new MonsterT each time with
+// unpacking it into the same MonsterT over and over, as a decode loop would,
+// and counts the memory allocations of each. Run from the root directory, or
+// pass the path to the tests directory:
+//   flatbenchmarkunpack [tests_dir] [runs]
+
+static size_t allocations = 0;
+
+void *operator new(size_t size) {
+  allocations++;
+  if (auto p = malloc(size ? size : 1)) return p;
+  throw std::bad_alloc();
+}
+void operator delete(void *p) noexcept { free(p); }
+
+template<typename F>
+double NanosecondsPerRun(int runs, size_t *allocs, F f) {
+  auto start_allocations = allocations;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < runs; i++) f();
+  std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+  *allocs = (allocations - start_allocations) / runs;
+  return elapsed.count() / runs;
+}
+
+int main(int argc, const char *argv[]) {
+  std::string tests_dir = argc > 1 ? argv[1] : "tests/";
+  int runs = argc > 2 ? atoi(argv[2]) : 1000000;
+
+  std::string buf;
+  if (!flatbuffers::LoadFile((tests_dir + "monsterdata_test.mon").c_str(),
+                             true, &buf)) {
+    printf("couldn't load files from %s\n", tests_dir.c_str());
+    return 1;
+  }
+  auto monster = MyGame::Example::GetMonster(buf.data());
+
+  size_t unpack_allocations = 0;
+  auto unpack = NanosecondsPerRun(runs, &unpack_allocations, [&]() {
+    delete monster->UnPack();
+  });
+  MyGame::Example::MonsterT reused;
+  monster->UnPackTo(&reused);
+  size_t unpack_to_allocations = 0;
+  auto unpack_to = NanosecondsPerRun(runs, &unpack_to_allocations,
+                                     [&]() { monster->UnPackTo(&reused); });
+  // Both pack to the same buffer.
+  std::unique_ptr<MyGame::Example::MonsterT> fresh(monster->UnPack());
+  flatbuffers::FlatBufferBuilder fbb1, fbb2;
+  fbb1.Finish(MyGame::Example::Monster::Pack(fbb1, &reused));
+  fbb2.Finish(MyGame::Example::Monster::Pack(fbb2, fresh.get()));
+  if (fbb1.GetSize() != fbb2.GetSize() ||
+      memcmp(fbb1.GetBufferPointer(), fbb2.GetBufferPointer(),
+             fbb1.GetSize())) {
+    printf("unpacking into a reused object differs\n");
+    return 1;
+  }
+
+  printf("UnPack:             %.1f ns, %zu allocations\n", unpack,
+         unpack_allocations);
+  printf("UnPackTo (reused):  %.1f ns, %zu allocations\n", unpack_to,
+         unpack_to_allocations);
+  return unpack_to_allocations == 0 ? 0 : 1;
+}
@@ -0,0 +1,680 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_VIEWSTEST_MYGAME_VIEWSTEST_H_
+#define FLATBUFFERS_GENERATED_VIEWSTEST_MYGAME_VIEWSTEST_H_
+
+#include "flatbuffers/flatbuffers.h"
+#include "flatbuffers/hash.h"
+
+namespace MyGame {
+namespace ViewsTest {
+
+struct Part;
+struct PartT;
+
+struct Assembly;
+struct AssemblyT;
+
+bool operator==(const PartT &lhs, const PartT &rhs);
+bool operator==(const AssemblyT &lhs, const AssemblyT &rhs);
+
+inline const flatbuffers::TypeTable *PartTypeTable();
+
+inline const flatbuffers::TypeTable *AssemblyTypeTable();
+
+enum Kind {
+  Kind_Small = 0,
+  Kind_Large = 1,
+  Kind_MIN = Kind_Small,
+  Kind_MAX = Kind_Large
+};
+
+inline const Kind (&EnumValuesKind())[2] {
+  static const Kind values[] = {
+    Kind_Small,
+    Kind_Large
+  };
+  return values;
+}
+
+inline const char * const *EnumNamesKind() {
+  static const char * const names[] = {
+    "Small",
+    "Large",
+    nullptr
+  };
+  return names;
+}
+
+inline const char *EnumNameKind(Kind e) {
+  if (e < Kind_Small || e > Kind_Large) return "";
+  const size_t index = static_cast<int>(e);
+  return EnumNamesKind()[index];
+}
+
+struct PartT : public flatbuffers::NativeTable {
+  typedef Part TableType;
+  int32_t id;
+  flatbuffers::StringView label;
+  size_t Hash() const;
+  PartT()
+      : id(0) {
+  }
+};
+
+inline bool operator==(const PartT &lhs, const PartT &rhs) {
+  return
+      (lhs.id == rhs.id) &&
+      (lhs.label == rhs.label);
+}
+
+struct Part FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef PartT NativeTableType;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return PartTypeTable();
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_ID = 4,
+    VT_LABEL = 6
+  };
+  int32_t id() const {
+    return GetField<int32_t>(VT_ID, 0);
+  }
+  bool mutate_id(int32_t _id) {
+    return SetField<int32_t>(VT_ID, _id, 0);
+  }
+  const flatbuffers::String *label() const {
+    return GetPointer<const flatbuffers::String *>(VT_LABEL);
+  }
+  flatbuffers::String *mutable_label() {
+    return GetPointer<flatbuffers::String *>(VT_LABEL);
+  }
+  flatbuffers::FieldPresence<2> PresenceMask() const {
+    return flatbuffers::FieldPresence<2>(this);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int32_t>(verifier, VT_ID) &&
+           VerifyOffset(verifier, VT_LABEL) &&
+           verifier.VerifyString(label()) &&
+           verifier.EndTable();
+  }
+  size_t Hash() const;
+  bool Equals(const Part &_o) const;
+  PartT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(PartT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<Part> Pack(flatbuffers::FlatBufferBuilder &_fbb, const PartT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  static flatbuffers::Offset<Part> Pack(flatbuffers::FlatBufferBuilder &_fbb, const PartT &_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct PartBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_id(int32_t id) {
+    fbb_.AddElement<int32_t>(Part::VT_ID, id, 0);
+  }
+  void add_label(flatbuffers::Offset<flatbuffers::String> label) {
+    fbb_.AddOffset(Part::VT_LABEL, label);
+  }
+  explicit PartBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  PartBuilder &operator=(const PartBuilder &);
+  flatbuffers::Offset<Part> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Part>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Part> CreatePart(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    int32_t id = 0,
+    flatbuffers::Offset<flatbuffers::String> label = 0) {
+  PartBuilder builder_(_fbb);
+  builder_.add_label(label);
+  builder_.add_id(id);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Part> CreatePartDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    int32_t id = 0,
+    const char *label = nullptr) {
+  return MyGame::ViewsTest::CreatePart(
+      _fbb,
+      id,
+      label ? _fbb.CreateString(label) : 0);
+}
+
+class PartBufferTemplate : public flatbuffers::BufferTemplate {
+ public:
+  PartBufferTemplate(const uint8_t *buf, size_t size)
+      : flatbuffers::BufferTemplate(buf, size) {
+    auto root = flatbuffers::GetRoot<Part>(data());
+    id_ = FieldPosition(root, Part::VT_ID);
+  }
+  bool mutate_id(uint8_t *buf, int32_t _id) const {
+    if (!id_) return false;
+    flatbuffers::WriteScalar<int32_t>(buf + id_, _id);
+    return true;
+  }
+
+ private:
+  flatbuffers::uoffset_t id_;
+};
+
+flatbuffers::Offset<Part> CreatePart(flatbuffers::FlatBufferBuilder &_fbb, const PartT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const PartT &_o);
+
+struct AssemblyT : public flatbuffers::NativeTable {
+  typedef Assembly TableType;
+  flatbuffers::StringView name;
+  flatbuffers::VectorView<double> weights;
+  flatbuffers::VectorView<uint16_t> counts;
+  std::vector<bool> flags;
+  std::vector<Kind> kinds;
+  std::vector<flatbuffers::StringView> tags;
+  std::vector<flatbuffers::unique_ptr<PartT>> parts;
+  flatbuffers::unique_ptr<PartT> main;
+  size_t Hash() const;
+  AssemblyT() {
+  }
+};
+
+inline bool operator==(const AssemblyT &lhs, const AssemblyT &rhs) {
+  return
+      (lhs.name == rhs.name) &&
+      (lhs.weights == rhs.weights) &&
+      (lhs.counts == rhs.counts) &&
+      (lhs.flags == rhs.flags) &&
+      (lhs.kinds == rhs.kinds) &&
+      (lhs.tags == rhs.tags) &&
+      (lhs.parts == rhs.parts) &&
+      (lhs.main == rhs.main);
+}
+
+struct Assembly FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef AssemblyT NativeTableType;
+  static const flatbuffers::TypeTable *MiniReflectTypeTable() {
+    return AssemblyTypeTable();
+  }
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NAME = 4,
+    VT_WEIGHTS = 6,
+    VT_COUNTS = 8,
+    VT_FLAGS = 10,
+    VT_KINDS = 12,
+    VT_TAGS = 14,
+    VT_PARTS = 16,
+    VT_MAIN = 18
+  };
+  const flatbuffers::String *name() const {
+    return GetPointer<const flatbuffers::String *>(VT_NAME);
+  }
+  flatbuffers::String *mutable_name() {
+    return GetPointer<flatbuffers::String *>(VT_NAME);
+  }
+  const flatbuffers::Vector<double> *weights() const {
+    return GetPointer<const flatbuffers::Vector<double> *>(VT_WEIGHTS);
+  }
+  flatbuffers::Vector<double> *mutable_weights() {
+    return GetPointer<flatbuffers::Vector<double> *>(VT_WEIGHTS);
+  }
+  const flatbuffers::Vector<uint16_t> *counts() const {
+    return GetPointer<const flatbuffers::Vector<uint16_t> *>(VT_COUNTS);
+  }
+  flatbuffers::Vector<uint16_t> *mutable_counts() {
+    return GetPointer<flatbuffers::Vector<uint16_t> *>(VT_COUNTS);
+  }
+  const flatbuffers::Vector<uint8_t> *flags() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_FLAGS);
+  }
+  flatbuffers::Vector<uint8_t> *mutable_flags() {
+    return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_FLAGS);
+  }
+  const flatbuffers::Vector<int8_t> *kinds() const {
+    return GetPointer<const flatbuffers::Vector<int8_t> *>(VT_KINDS);
+  }
+  flatbuffers::Vector<int8_t> *mutable_kinds() {
+    return GetPointer<flatbuffers::Vector<int8_t> *>(VT_KINDS);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *tags() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_TAGS);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *mutable_tags() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_TAGS);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<Part>> *parts() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Part>> *>(VT_PARTS);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<Part>> *mutable_parts() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<Part>> *>(VT_PARTS);
+  }
+  const Part *main() const {
+    return GetPointer<const Part *>(VT_MAIN);
+  }
+  Part *mutable_main() {
+    return GetPointer<Part *>(VT_MAIN);
+  }
+  flatbuffers::FieldPresence<8> PresenceMask() const {
+    return flatbuffers::FieldPresence<8>(this);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           VerifyOffset(verifier, VT_WEIGHTS) &&
+           verifier.VerifyVector(weights()) &&
+           VerifyOffset(verifier, VT_COUNTS) &&
+           verifier.VerifyVector(counts()) &&
+           VerifyOffset(verifier, VT_FLAGS) &&
+           verifier.VerifyVector(flags()) &&
+           VerifyOffset(verifier, VT_KINDS) &&
+           verifier.VerifyVector(kinds()) &&
+           VerifyOffset(verifier, VT_TAGS) &&
+           verifier.VerifyVector(tags()) &&
+           verifier.VerifyVectorOfStrings(tags()) &&
+           VerifyOffset(verifier, VT_PARTS) &&
+           verifier.VerifyVector(parts()) &&
+           verifier.VerifyVectorOfTables(parts()) &&
+           VerifyOffset(verifier, VT_MAIN) &&
+           verifier.VerifyTable(main()) &&
+           verifier.EndTable();
+  }
+  size_t Hash() const;
+  bool Equals(const Assembly &_o) const;
+  AssemblyT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(AssemblyT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<Assembly> Pack(flatbuffers::FlatBufferBuilder &_fbb, const AssemblyT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  static flatbuffers::Offset<Assembly> Pack(flatbuffers::FlatBufferBuilder &_fbb, const AssemblyT &_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct AssemblyBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_name(flatbuffers::Offset<flatbuffers::String> name) {
+    fbb_.AddOffset(Assembly::VT_NAME, name);
+  }
+  void add_weights(flatbuffers::Offset<flatbuffers::Vector<double>> weights) {
+    fbb_.AddOffset(Assembly::VT_WEIGHTS, weights);
+  }
+  void add_counts(flatbuffers::Offset<flatbuffers::Vector<uint16_t>> counts) {
+    fbb_.AddOffset(Assembly::VT_COUNTS, counts);
+  }
+  void add_flags(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> flags) {
+    fbb_.AddOffset(Assembly::VT_FLAGS, flags);
+  }
+  void add_kinds(flatbuffers::Offset<flatbuffers::Vector<int8_t>> kinds) {
+    fbb_.AddOffset(Assembly::VT_KINDS, kinds);
+  }
+  void add_tags(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> tags) {
+    fbb_.AddOffset(Assembly::VT_TAGS, tags);
+  }
+  void add_parts(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Part>>> parts) {
+    fbb_.AddOffset(Assembly::VT_PARTS, parts);
+  }
+  void add_main(flatbuffers::Offset<Part> main) {
+    fbb_.AddOffset(Assembly::VT_MAIN, main);
+  }
+  explicit AssemblyBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  AssemblyBuilder &operator=(const AssemblyBuilder &);
+  flatbuffers::Offset<Assembly> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Assembly>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Assembly> CreateAssembly(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> name = 0,
+    flatbuffers::Offset<flatbuffers::Vector<double>> weights = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint16_t>> counts = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> flags = 0,
+    flatbuffers::Offset<flatbuffers::Vector<int8_t>> kinds = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> tags = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Part>>> parts = 0,
+    flatbuffers::Offset<Part> main = 0) {
+  AssemblyBuilder builder_(_fbb);
+  builder_.add_main(main);
+  builder_.add_parts(parts);
+  builder_.add_tags(tags);
+  builder_.add_kinds(kinds);
+  builder_.add_flags(flags);
+  builder_.add_counts(counts);
+  builder_.add_weights(weights);
+  builder_.add_name(name);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Assembly> CreateAssemblyDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    const std::vector<double> *weights = nullptr,
+    const std::vector<uint16_t> *counts = nullptr,
+    const std::vector<uint8_t> *flags = nullptr,
+    const std::vector<int8_t> *kinds = nullptr,
+    const std::vector<flatbuffers::Offset<flatbuffers::String>> *tags = nullptr,
+    const std::vector<flatbuffers::Offset<Part>> *parts = nullptr,
+    flatbuffers::Offset<Part> main = 0) {
+  return MyGame::ViewsTest::CreateAssembly(
+      _fbb,
+      name ? _fbb.CreateString(name) : 0,
+      weights ? _fbb.CreateVector<double>(*weights) : 0,
+      counts ? _fbb.CreateVector<uint16_t>(*counts) : 0,
+      flags ? _fbb.CreateVector<uint8_t>(*flags) : 0,
+      kinds ? _fbb.CreateVector<int8_t>(*kinds) : 0,
+      tags ? _fbb.CreateVector<flatbuffers::Offset<flatbuffers::String>>(*tags) : 0,
+      parts ? _fbb.CreateVector<flatbuffers::Offset<Part>>(*parts) : 0,
+      main);
+}
+
+class AssemblyBufferTemplate : public flatbuffers::BufferTemplate {
+ public:
+  AssemblyBufferTemplate(const uint8_t *buf, size_t size)
+      : flatbuffers::BufferTemplate(buf, size) {
+  }
+};
+
+flatbuffers::Offset<Assembly> CreateAssembly(flatbuffers::FlatBufferBuilder &_fbb, const AssemblyT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+size_t GetPackedSizeUpperBound(const AssemblyT &_o);
+
+inline PartT *Part::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new PartT();
+  UnPackTo(_o, _resolver);
+  return _o;
+}
+
+inline void Part::UnPackTo(PartT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = id(); _o->id = _e; };
+  { auto _e = label(); if (_e) { _o->label = flatbuffers::StringView(_e->c_str(), _e->size()); } else { _o->label.clear(); } };
+}
+
+inline flatbuffers::Offset<Part> Part::Pack(flatbuffers::FlatBufferBuilder &_fbb, const PartT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreatePart(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<Part> Part::Pack(flatbuffers::FlatBufferBuilder &_fbb, const PartT &_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(_o));
+  return CreatePart(_fbb, &_o, _rehasher);
+}
+
+inline flatbuffers::Offset<Part> CreatePart(flatbuffers::FlatBufferBuilder &_fbb, const PartT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const PartT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _id = _o->id;
+  auto _label = _o->label.empty() ? 0 : _fbb.CreateString(_o->label);
+  return MyGame::ViewsTest::CreatePart(
+      _fbb,
+      _id,
+      _label);
+}
+
+inline size_t GetPackedSizeUpperBound(const PartT &_o) {
+  (void)_o;
+  size_t _size = 57;
+  _size += _o.label.length();
+  return _size;
+}
+
+inline size_t Part::Hash() const {
+  uint64_t _h = 0;
+  { auto _e = GetField<int32_t>(VT_ID, 0); if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, VT_ID), _e); }
+  { auto _e = label(); if (_e && _e->size()) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, VT_LABEL), _e->c_str(), _e->size()); }
+  return static_cast<size_t>(_h);
+}
+
+inline size_t PartT::Hash() const {
+  uint64_t _h = 0;
+  { auto _e = id; if (_e != 0) _h = flatbuffers::HashScalar(flatbuffers::HashCombine(_h, Part::VT_ID), _e); }
+  { auto &_e = label; if (_e.length()) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, Part::VT_LABEL), _e.c_str(), _e.length()); }
+  return static_cast<size_t>(_h);
+}
+
+inline bool Part::Equals(const Part &_o) const {
+  return flatbuffers::ScalarEquals(GetField<int32_t>(VT_ID, 0), _o.GetField<int32_t>(VT_ID, 0)) &&
+         flatbuffers::StringEquals(label(), _o.label());
+}
+
+inline AssemblyT *Assembly::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new AssemblyT();
+  UnPackTo(_o, _resolver);
+  return _o;
+}
+
+inline void Assembly::UnPackTo(AssemblyT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = name(); if (_e) { _o->name = flatbuffers::StringView(_e->c_str(), _e->size()); } else { _o->name.clear(); } };
+  { auto _e = weights(); if (_e) { _o->weights = flatbuffers::VectorView<double>(*_e); } else { _o->weights.clear(); } };
+  { auto _e = counts(); if (_e) { _o->counts = flatbuffers::VectorView<uint16_t>(*_e); } else { _o->counts.clear(); } };
+  { auto _e = flags(); if (_e) { _o->flags.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->flags[_i] = _e->Get(_i) != 0; } } else { _o->flags.clear(); } };
+  { auto _e = kinds(); if (_e) { _o->kinds.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->kinds[_i] = static_cast<Kind>(_e->Get(_i)); } } else { _o->kinds.clear(); } };
+  { auto _e = tags(); if (_e) { _o->tags.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->tags[_i] = flatbuffers::StringView(_e->Get(_i)->c_str(), _e->Get(_i)->size()); } } else { _o->tags.clear(); } };
+  { auto _e = parts(); if (_e) { _o->parts.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if (_o->parts[_i]) { _e->Get(_i)->UnPackTo(_o->parts[_i].get(), _resolver); } else { _o->parts[_i] = flatbuffers::unique_ptr<PartT>(_e->Get(_i)->UnPack(_resolver)); } } } else { _o->parts.clear(); } };
+  { auto _e = main(); if (_e) { if (_o->main) { _e->UnPackTo(_o->main.get(), _resolver); } else { _o->main = flatbuffers::unique_ptr<PartT>(_e->UnPack(_resolver)); } } else { _o->main.reset(); } };
+}
+
+inline flatbuffers::Offset<Assembly> Assembly::Pack(flatbuffers::FlatBufferBuilder &_fbb, const AssemblyT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateAssembly(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<Assembly> Assembly::Pack(flatbuffers::FlatBufferBuilder &_fbb, const AssemblyT &_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(GetPackedSizeUpperBound(_o));
+  return CreateAssembly(_fbb, &_o, _rehasher);
+}
+
+inline flatbuffers::Offset<Assembly> CreateAssembly(flatbuffers::FlatBufferBuilder &_fbb, const AssemblyT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const AssemblyT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _name = _o->name.empty() ? 0 : _fbb.CreateString(_o->name);
+  auto _weights = _o->weights.size() ? _fbb.CreateVector(_o->weights) : 0;
+  auto _counts = _o->counts.size() ? _fbb.CreateVector(_o->counts) : 0;
+  auto _flags = _o->flags.size() ? _fbb.CreateVector(_o->flags) : 0;
+  auto _kinds = _o->kinds.size() ? _fbb.CreateVectorScalarCast<int8_t>(flatbuffers::data(_o->kinds), _o->kinds.size()) : 0;
+  auto _tags = _o->tags.size() ? _fbb.CreateVectorOfStrings(_o->tags) : 0;
+  auto _parts = _o->parts.size() ? _fbb.CreateVector<flatbuffers::Offset<Part>> (_o->parts.size(), [](size_t i, _VectorArgs *__va) { return CreatePart(*__va->__fbb, __va->__o->parts[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _main = _o->main ? CreatePart(_fbb, _o->main.get(), _rehasher) : 0;
+  return MyGame::ViewsTest::CreateAssembly(
+      _fbb,
+      _name,
+      _weights,
+      _counts,
+      _flags,
+      _kinds,
+      _tags,
+      _parts,
+      _main);
+}
+
+inline size_t GetPackedSizeUpperBound(const AssemblyT &_o) {
+  (void)_o;
+  size_t _size = 215;
+  _size += _o.name.length();
+  _size += _o.weights.size() * 8;
+  _size += _o.counts.size() * 2;
+  _size += _o.flags.size() * 1;
+  _size += _o.kinds.size() * 1;
+  _size += _o.tags.size() * 4;
+  for (size_t _i = 0; _i < _o.tags.size(); _i++) {
+    _size += _o.tags[_i].length() + 8;
+  }
+  _size += _o.parts.size() * 4;
+  for (size_t _i = 0; _i < _o.parts.size(); _i++) {
+    _size += GetPackedSizeUpperBound(*_o.parts[_i]);
+  }
+  if (_o.main) _size += GetPackedSizeUpperBound(*_o.main);
+  return _size;
+}
+
+inline size_t Assembly::Hash() const {
+  uint64_t _h = 0;
+  { auto _e = name(); if (_e && _e->size()) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, VT_NAME), _e->c_str(), _e->size()); }
+  { auto _e = weights(); if (_e && _e->size()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, VT_WEIGHTS), *_e); }
+  { auto _e = counts(); if (_e && _e->size()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, VT_COUNTS), *_e); }
+  { auto _e = flags(); if (_e && _e->size()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, VT_FLAGS), *_e); }
+  { auto _e = kinds(); if (_e && _e->size()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, VT_KINDS), *_e); }
+  { auto _e = tags(); if (_e && _e->size()) _h = flatbuffers::HashStrings(flatbuffers::HashCombine(_h, VT_TAGS), *_e); }
+  { auto _e = parts(); if (_e && _e->size()) _h = flatbuffers::HashTables(flatbuffers::HashCombine(_h, VT_PARTS), *_e); }
+  { auto _e = main(); if (_e) _h = flatbuffers::HashCombine(flatbuffers::HashCombine(_h, VT_MAIN), _e->Hash()); }
+  return static_cast<size_t>(_h);
+}
+
+inline size_t AssemblyT::Hash() const {
+  uint64_t _h = 0;
+  { auto &_e = name; if (_e.length()) _h = flatbuffers::HashBytes(flatbuffers::HashCombine(_h, Assembly::VT_NAME), _e.c_str(), _e.length()); }
+  { auto &_e = weights; if (!_e.empty()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, Assembly::VT_WEIGHTS), _e); }
+  { auto &_e = counts; if (!_e.empty()) _h = flatbuffers::HashScalars(flatbuffers::HashCombine(_h, Assembly::VT_COUNTS), _e); }
+  { auto &_e = flags; if (!_e.empty()) _h = flatbuffers::HashScalarsAs<uint8_t>(flatbuffers::HashCombine(_h, Assembly::VT_FLAGS), _e); }
+  { auto &_e = kinds; if (!_e.empty()) _h = flatbuffers::HashScalarsAs<int8_t>(flatbuffers::HashCombine(_h, Assembly::VT_KINDS), _e); }
+  { auto &_e = tags; if (!_e.empty()) _h = flatbuffers::HashStrings(flatbuffers::HashCombine(_h, Assembly::VT_TAGS), _e); }
+  { auto &_e = parts; if (!_e.empty()) _h = flatbuffers::HashTables(flatbuffers::HashCombine(_h, Assembly::VT_PARTS), _e); }
+  { auto _e = main.get(); if (_e) _h = flatbuffers::HashCombine(flatbuffers::HashCombine(_h, Assembly::VT_MAIN), _e->Hash()); }
+  return static_cast<size_t>(_h);
+}
+
+inline bool Assembly::Equals(const Assembly &_o) const {
+  return flatbuffers::StringEquals(name(), _o.name()) &&
+         flatbuffers::VectorEquals(weights(), _o.weights()) &&
+         flatbuffers::VectorEquals(counts(), _o.counts()) &&
+         flatbuffers::VectorEquals(flags(), _o.flags()) &&
+         flatbuffers::VectorEquals(kinds(), _o.kinds()) &&
+         flatbuffers::VectorEquals(tags(), _o.tags()) &&
+         flatbuffers::VectorEquals(parts(), _o.parts()) &&
+         flatbuffers::TableEquals(main(), _o.main());
+}
+
+inline const flatbuffers::TypeTable *KindTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_CHAR, 0, 0 },
+    { flatbuffers::ET_CHAR, 0, 0 }
+  };
+  static const flatbuffers::TypeFunction type_refs[] = {
+    KindTypeTable
+  };
+  static const char * const names[] = {
+    "Small",
+    "Large"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_ENUM, 2, type_codes, type_refs, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *PartTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_INT, 0, -1 },
+    { flatbuffers::ET_STRING, 0, -1 }
+  };
+  static const char * const names[] = {
+    "id",
+    "label"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 2, type_codes, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline const flatbuffers::TypeTable *AssemblyTypeTable() {
+  static const flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_DOUBLE, 1, -1 },
+    { flatbuffers::ET_USHORT, 1, -1 },
+    { flatbuffers::ET_BOOL, 1, -1 },
+    { flatbuffers::ET_CHAR, 1, 0 },
+    { flatbuffers::ET_STRING, 1, -1 },
+    { flatbuffers::ET_SEQUENCE, 1, 1 },
+    { flatbuffers::ET_SEQUENCE, 0, 1 }
+  };
+  static const flatbuffers::TypeFunction type_refs[] = {
+    KindTypeTable,
+    PartTypeTable
+  };
+  static const char * const names[] = {
+    "name",
+    "weights",
+    "counts",
+    "flags",
+    "kinds",
+    "tags",
+    "parts",
+    "main"
+  };
+  static const flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 8, type_codes, type_refs, nullptr, names
+  };
+  return &tt;
+}
+
+inline const MyGame::ViewsTest::Assembly *GetAssembly(const void *buf) {
+  return flatbuffers::GetRoot<MyGame::ViewsTest::Assembly>(buf);
+}
+
+inline const MyGame::ViewsTest::Assembly *GetSizePrefixedAssembly(const void *buf) {
+  return flatbuffers::GetSizePrefixedRoot<MyGame::ViewsTest::Assembly>(buf);
+}
+
+inline Assembly *GetMutableAssembly(void *buf) {
+  return flatbuffers::GetMutableRoot<Assembly>(buf);
+}
+
+inline bool VerifyAssemblyBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<MyGame::ViewsTest::Assembly>(nullptr);
+}
+
+inline bool VerifySizePrefixedAssemblyBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<MyGame::ViewsTest::Assembly>(nullptr);
+}
+
+inline void FinishAssemblyBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<MyGame::ViewsTest::Assembly> root) {
+  fbb.Finish(root);
+}
+
+inline void FinishSizePrefixedAssemblyBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<MyGame::ViewsTest::Assembly> root) {
+  fbb.FinishSizePrefixed(root);
+}
+
+inline flatbuffers::unique_ptr<AssemblyT> UnPackAssembly(
+    const void *buf,
+    const flatbuffers::resolver_function_t *res = nullptr) {
+  return flatbuffers::unique_ptr<AssemblyT>(GetAssembly(buf)->UnPack(res));
+}
+
+}  // namespace ViewsTest
+}  // namespace MyGame
+
+namespace std {
+
+template<> struct hash<MyGame::ViewsTest::PartT> {
+  size_t operator()(const MyGame::ViewsTest::PartT &_o) const {
+    return _o.Hash();
+  }
+};
+
+template<> struct hash<MyGame::ViewsTest::AssemblyT> {
+  size_t operator()(const MyGame::ViewsTest::AssemblyT &_o) const {
+    return _o.Hash();
+  }
+};
+
+}  // namespace std
+
+#endif  // FLATBUFFERS_GENERATED_VIEWSTEST_MYGAME_VIEWSTEST_H_